@@ -30,6 +30,8 @@ class CacheEntryClass
     const string& get_resource_bundle_path() const property";
     int           get_number() const property";              
     bool          get_deleted() const property";             
+    /// Name of the preview image in resource group 'Cache'; the file is only extracted there once the image is displayed,
+    /// use `CacheSystemClass::fetchThumbnail()` to get the image.
     const string& get_filecachename() const property";       
     const string& get_resource_group() const property";      
 }
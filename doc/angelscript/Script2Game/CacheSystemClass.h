@@ -35,6 +35,12 @@ class CacheSystemClass
     * @returns A dictionary representing the Query Results of `RoR::CacheQuery` 
     */
     dictionary@ query(dictionary@ query);
+
+    /**
+    * Gets the entry's preview image; the image is extracted and decoded in the background on first request.
+    * @returns Null until the image is ready (keep calling each frame), or if the entry has no preview image.
+    */
+    Ogre::TexturePtr fetchThumbnail(CacheEntryClass @entry);
 }
 
 /// @}    //addtogroup Script2Game
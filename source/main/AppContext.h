@@ -28,6 +28,7 @@
 
 #include "Application.h"
 #include "ForceFeedback.h"
+#include "FramePacer.h"
 
 #include <Bites/OgreWindowEventUtilities.h>
 #include <Ogre.h>
@@ -69,6 +70,7 @@ public:
     Ogre::Viewport*      GetViewport() { return m_viewport; }
     Ogre::RenderWindow*  GetRenderWindow() { return m_render_window; }
     RoR::ForceFeedback&  GetForceFeedback() { return m_force_feedback; }
+    RoR::FramePacer&     GetFramePacer() { return m_frame_pacer; }
     std::thread::id      GetMainThreadID() { return m_mainthread_id; }
 
 private:
@@ -107,6 +109,7 @@ private:
     int                  m_prev_screenshot_index = 1;
 
     RoR::ForceFeedback   m_force_feedback;
+    RoR::FramePacer      m_frame_pacer;
 
     std::thread::id      m_mainthread_id;
 };
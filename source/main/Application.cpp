@@ -87,6 +87,7 @@ CVar* app_rendersys_override;
 CVar* app_extra_mod_path;
 CVar* app_force_cache_purge;
 CVar* app_force_cache_update;
+CVar* app_watch_mod_dirs;
 CVar* app_disable_online_api;
 CVar* app_config_long_names;
 CVar* app_custom_scripts;
@@ -161,6 +162,7 @@ CVar* diag_use_mygui_logfile;
 CVar* diag_load_devel_scripts;
 CVar* diag_profiler_enabled;
 CVar* diag_profiler_rate;
+CVar* diag_truckc_verify;
 
 // System
 CVar* sys_process_dir;
@@ -261,6 +263,7 @@ CVar* gfx_fixed_cam_tracking;
 CVar* gfx_fps_limit;
 CVar* gfx_speedo_imperial;
 CVar* gfx_flexbody_cache;
+CVar* gfx_flexbody_lod;
 CVar* gfx_reduce_shadows;
 CVar* gfx_enable_rtshaders;
 CVar* gfx_alt_actor_materials;
@@ -178,7 +178,7 @@ namespace RigDef
 {
 enum class Keyword
 {
-    // IMPORTANT! If you add a value here, you must also modify `RigDef::Regexes::IDENTIFY_KEYWORD`, it relies on numeric values of this enum.
+    // IMPORTANT! If you add a value here, you must also modify `RIGDEF_KEYWORD_LIST` in RigDef_Keywords.h
 
     INVALID = 0,
 
@@ -634,6 +634,7 @@ extern CVar* app_rendersys_override;
 extern CVar* app_extra_mod_path;
 extern CVar* app_force_cache_purge;
 extern CVar* app_force_cache_update;
+extern CVar* app_watch_mod_dirs;
 extern CVar* app_disable_online_api;
 extern CVar* app_config_long_names;
 extern CVar* app_custom_scripts;
@@ -708,6 +709,7 @@ extern CVar* diag_use_mygui_logfile;
 extern CVar* diag_load_devel_scripts;
 extern CVar* diag_profiler_enabled;
 extern CVar* diag_profiler_rate;
+extern CVar* diag_truckc_verify;
 
 // System
 extern CVar* sys_process_dir;
@@ -808,6 +810,7 @@ extern CVar* gfx_fixed_cam_tracking;
 extern CVar* gfx_fps_limit;
 extern CVar* gfx_speedo_imperial;
 extern CVar* gfx_flexbody_cache;
+extern CVar* gfx_flexbody_lod;
 extern CVar* gfx_reduce_shadows;
 extern CVar* gfx_enable_rtshaders;
 extern CVar* gfx_alt_actor_materials;
@@ -128,6 +128,7 @@ namespace RoR
     class  FlexBody;
     class  FlexBodyFileIO;
     struct FlexBodyCacheData;
+    class  FlexBodyCacheFile;
     class  FlexFactory;
     class  FlexMeshWheel;
     class  FlexObj;
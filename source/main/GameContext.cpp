@@ -106,6 +106,31 @@ Message GameContext::PopMessage()
     return m;
 }
 
+void GameContext::PushSimMessage(MsgType type, void* payload)
+{
+    SimMessage sm;
+    sm.type = type;
+    sm.payload = payload;
+    if (!m_sim_msg_ring.TryPush(sm))
+    {
+        this->PushMessage(Message(type, payload)); // Ring full - rare, take the slow path.
+    }
+}
+
+void GameContext::FlushSimMessages()
+{
+    SimMessage sm;
+    if (!m_sim_msg_ring.TryPop(sm))
+        return;
+
+    std::lock_guard<std::mutex> lock(m_msg_mutex);
+    do
+    {
+        m_msg_queue.push(Message(sm.type, sm.payload));
+        m_msg_chain_end = &m_msg_queue.back();
+    } while (m_sim_msg_ring.TryPop(sm));
+}
+
 // --------------------------------
 // Terrain
 
@@ -375,6 +400,9 @@ void GameContext::ModifyActor(ActorModifyRequest& rq)
         return;
     }
 
+    // Resets and respawns move nodes between physics steps; lock/tie/rope searches in the same frame must see it.
+    m_actor_manager.InvalidateLockTargets();
+
     if (rq.amr_type == ActorModifyRequest::Type::SOFT_RESET)
     {
         actor->SoftReset();
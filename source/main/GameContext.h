@@ -28,13 +28,14 @@
 #include "ActorManager.h"
 #include "CacheSystem.h"
 #include "CharacterFactory.h"
+#include "LockFreeRing.h"
 #include "RaceSystem.h"
 #include "RepairMode.h"
 #include "SceneMouse.h"
 #include "SimData.h"
 #include "Terrain.h"
 
-#include <list>
+#include <deque>
 #include <mutex>
 #include <queue>
 #include <string>
@@ -60,7 +61,14 @@ struct Message
     std::vector<Message> chain; //!< Posted after the message is processed
 };
 
-typedef std::queue < Message, std::list<Message>> GameMsgQueue;
+typedef std::queue < Message, std::deque<Message>> GameMsgQueue; // deque: no per-message allocation, references to elements stay valid on push/pop.
+
+/// Compact message posted from physics worker threads; see `GameContext::PushSimMessage()`.
+struct SimMessage
+{
+    MsgType     type         = MSG_INVALID;
+    void*       payload      = nullptr;
+};
 
 /// @} // addtogroup MsgQueue
 
@@ -107,6 +115,13 @@ public:
     void                ChainMessage(Message m); //!< Add to last pushed message's chain
     bool                HasMessages();
     Message             PopMessage();
+    void                PushSimMessage(MsgType type, void* payload); //!< Lock-free, for physics worker threads; falls back to `PushMessage()` if the ring is full.
+    void                FlushSimMessages(); //!< Main thread only: moves messages posted by `PushSimMessage()` to the regular queue.
+
+    ActorModifyRequest* AcquireActorModifyRequest()            { return m_modify_request_pool.Acquire(); } //!< Thread-safe; return it with `ReleaseActorModifyRequest()`.
+    void                ReleaseActorModifyRequest(ActorModifyRequest* rq) { m_modify_request_pool.Release(rq); } //!< Also accepts requests created by `new`.
+    ActorLinkingRequest* AcquireActorLinkingRequest()          { return m_linking_request_pool.Acquire(); } //!< Thread-safe; return it with `ReleaseActorLinkingRequest()`.
+    void                ReleaseActorLinkingRequest(ActorLinkingRequest* rq) { m_linking_request_pool.Release(rq); } //!< Also accepts requests created by `new`.
 
     /// @}
     /// @name Terrain
@@ -185,6 +200,9 @@ private:
     GameMsgQueue        m_msg_queue;
     Message*            m_msg_chain_end = nullptr;
     std::mutex          m_msg_mutex;
+    LockFreeRing<SimMessage, 1024> m_sim_msg_ring;    //!< Producers: physics workers; consumer: main thread.
+    LockFreePool<ActorModifyRequest, 64> m_modify_request_pool;
+    LockFreePool<ActorLinkingRequest, 256> m_linking_request_pool;
 
     // Terrain
     TerrainPtr          m_terrain;
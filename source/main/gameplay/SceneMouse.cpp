@@ -133,27 +133,19 @@ bool SceneMouse::handleMouseMoved()
             if (actor->ar_state == ActorState::LOCAL_SIMULATED)
             {
                 // check if our ray intersects with the bounding box of the truck
-                std::pair<bool, Real> pair = mouseRay.intersects(actor->ar_bounding_box);
+                GfxActor* gfx_actor = actor->GetGfxActor();
+                std::pair<bool, Real> pair = mouseRay.intersects(gfx_actor->GetSimDataBuffer().simbuf_aabb);
                 if (!pair.first)
                     continue;
 
-                for (int j = 0; j < actor->ar_num_nodes; j++)
+                // find the nearest node hit by the ray (nodes are 0.1m spheres)
+                NodeBvh::RayHit hit = gfx_actor->GetNodeBvh().CastRay(mouseRay, gfx_actor->GetSimNodePositions(), 0.1f, mindist,
+                    [&actor](NodeNum_t n) { return !actor->ar_nodes[n].nd_no_mouse_grab; });
+                if (hit.nbh_node != NODENUM_INVALID)
                 {
-                    if (actor->ar_nodes[j].nd_no_mouse_grab)
-                        continue;
-
-                    // check if our ray intersects with the node
-                    std::pair<bool, Real> pair = mouseRay.intersects(Sphere(actor->ar_nodes[j].AbsPosition, 0.1f));
-                    if (pair.first)
-                    {
-                        // we hit it, check if its the nearest node
-                        if (pair.second < mindist)
-                        {
-                            mindist = pair.second;
-                            minnode = (NodeNum_t)j;
-                            grab_truck = actor;
-                        }
-                    }
+                    mindist = hit.nbh_distance;
+                    minnode = hit.nbh_node;
+                    grab_truck = actor;
                 }
             }
         }
@@ -220,7 +212,7 @@ void SceneMouse::UpdateVisuals()
         pickLineNode->setVisible(true);   // Show the line
         // update visual line
         pickLine->beginUpdate(0);
-        pickLine->position(grab_truck->GetGfxActor()->GetSimNodeBuffer()[minnode].AbsPosition);
+        pickLine->position(grab_truck->GetGfxActor()->GetSimNodePositions()[minnode]);
         pickLine->position(lastgrabpos);
         pickLine->end();
     }
@@ -277,21 +269,19 @@ bool SceneMouse::handleMousePressed()
             Real nearest_ray_distance = std::numeric_limits<float>::max();
             NodeNum_t nearest_node_index = NODENUM_INVALID;
 
-            for (int i = 0; i < player_actor->ar_num_nodes; i++)
-            {
-                Vector3 pos = player_actor->ar_nodes[i].AbsPosition;
-                std::pair<bool, Real> pair = mouseRay.intersects(Sphere(pos, 0.25f));
-                if (pair.first)
+            const Ogre::Vector3* nodes = player_actor->GetGfxActor()->GetSimNodePositions();
+            player_actor->GetGfxActor()->GetNodeBvh().ForEachRayHit(mouseRay, nodes, 0.25f,
+                [&](NodeNum_t i, float camera_distance)
                 {
-                    Real ray_distance = mouseRay.getDirection().crossProduct(pos - mouseRay.getOrigin()).length();
-                    if (ray_distance < nearest_ray_distance || (ray_distance == nearest_ray_distance && pair.second < nearest_camera_distance))
+                    Real ray_distance = mouseRay.getDirection().crossProduct(nodes[i] - mouseRay.getOrigin()).length();
+                    if (ray_distance < nearest_ray_distance || (ray_distance == nearest_ray_distance && camera_distance < nearest_camera_distance)
+                        || (ray_distance == nearest_ray_distance && camera_distance == nearest_camera_distance && i < nearest_node_index))
                     {
-                        nearest_camera_distance = pair.second;
+                        nearest_camera_distance = camera_distance;
                         nearest_ray_distance = ray_distance;
-                        nearest_node_index = (NodeNum_t)i;
+                        nearest_node_index = i;
                     }
-                }
-            }
+                });
             if (player_actor->ar_custom_camera_node != nearest_node_index)
             {
                 player_actor->ar_custom_camera_node = nearest_node_index;
@@ -38,6 +38,9 @@
 using namespace Ogre;
 using namespace RoR;
 
+static const float AI_STOP_DISTANCE = 5.f;  //!< Meters; min. gap to other actors before the AI hits the parking brake.
+static const float AI_STOP_LOOKAHEAD = 1.f; //!< Seconds; how far ahead to predict the gap.
+
 VehicleAI::VehicleAI(ActorPtr b) :
     is_waiting(false),
     wait_time(0.0f)
@@ -437,18 +440,17 @@ void VehicleAI::update(float dt, int doUpdate)
                         beam->ar_engine->autoSetAcc(0);
                     }
 
-                    for (int i = 0; i < beam->ar_num_nodes; i++)
+                    // Broadphase: only look closer if the predicted bounding boxes (current + 1 sec ahead) come near each other
+                    Ogre::AxisAlignedBox own_box = beam->ar_predicted_bounding_box;
+                    own_box.setExtents(own_box.getMinimum() - AI_STOP_DISTANCE, own_box.getMaximum() + AI_STOP_DISTANCE);
+                    if (!own_box.intersects(actor->ar_predicted_bounding_box))
+                        continue;
+
+                    // Too close (now or within the lookahead window), stop
+                    if (CoarseSphereTree::PredictProximity(beam->GetCoarseSphereTree(), actor->GetCoarseSphereTree(), AI_STOP_DISTANCE, AI_STOP_LOOKAHEAD))
                     {
-                        for (int k = 0; k < actor->ar_num_nodes; k++)
-                        {
-                            // Too close, stop
-                            if (beam->getNodePosition(i).distance(actor->getNodePosition(k)) < 5)
-                            {
-                                beam->ar_parking_brake = true;
-                                beam->toggleHeadlights();
-                                break;
-                            }
-                        }
+                        beam->ar_parking_brake = true;
+                        beam->toggleHeadlights();
                     }
                 }
             }
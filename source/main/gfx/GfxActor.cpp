@@ -48,6 +48,7 @@
 #include "SkyManager.h"
 #include "SoundScriptManager.h"
 #include "Terrain.h"
+#include "TraceRecorder.h"
 #include "TurboJet.h"
 #include "TurboProp.h"
 #include "Utils.h"
@@ -511,14 +512,14 @@ void RoR::GfxActor::UpdateVideoCameras(float dt)
             vidcam.vcam_render_window->update();
 
         // get the normal of the camera plane now
-        const Ogre::Vector3 abs_pos_center = m_simbuf.simbuf_nodes[vidcam.vcam_node_center].AbsPosition;
-        const Ogre::Vector3 abs_pos_z = m_simbuf.simbuf_nodes[vidcam.vcam_node_dir_z].AbsPosition;
-        const Ogre::Vector3 abs_pos_y = m_simbuf.simbuf_nodes[vidcam.vcam_node_dir_y].AbsPosition;
+        const Ogre::Vector3 abs_pos_center = m_simbuf.simbuf_nodes.nbs_positions[vidcam.vcam_node_center];
+        const Ogre::Vector3 abs_pos_z = m_simbuf.simbuf_nodes.nbs_positions[vidcam.vcam_node_dir_z];
+        const Ogre::Vector3 abs_pos_y = m_simbuf.simbuf_nodes.nbs_positions[vidcam.vcam_node_dir_y];
         Ogre::Vector3 normal = (-(abs_pos_center - abs_pos_z)).crossProduct(-(abs_pos_center - abs_pos_y));
         normal.normalise();
 
         // add user set offset
-        Ogre::Vector3 pos = m_simbuf.simbuf_nodes[vidcam.vcam_node_alt_pos].AbsPosition +
+        Ogre::Vector3 pos = m_simbuf.simbuf_nodes.nbs_positions[vidcam.vcam_node_alt_pos] +
             (vidcam.vcam_pos_offset.x * normal) +
             (vidcam.vcam_pos_offset.y * (abs_pos_center - abs_pos_y)) +
             (vidcam.vcam_pos_offset.z * (abs_pos_center - abs_pos_z));
@@ -550,7 +551,7 @@ void RoR::GfxActor::UpdateVideoCameras(float dt)
         else if (vidcam.vcam_role == VCAM_ROLE_TRACKING_VIDEOCAM 
             || vidcam.vcam_role == VCAM_ROLE_TRACKING_MIRROR || vidcam.vcam_role == VCAM_ROLE_TRACKING_MIRROR_NOFLIP)
         {
-            normal = m_simbuf.simbuf_nodes[vidcam.vcam_node_lookat].AbsPosition - pos;
+            normal = m_simbuf.simbuf_nodes.nbs_positions[vidcam.vcam_node_lookat] - pos;
             normal.normalise();
             Ogre::Vector3 refx = abs_pos_z - abs_pos_center;
             refx.normalise();
@@ -804,10 +805,12 @@ void RoR::GfxActor::UpdateDebugView()
 
         if (!App::diag_hide_nodes->getBool())
         {
-            // Nodes
+            // Nodes - only those in node BVH leaves intersecting the camera frustum
             const node_t* nodes = m_actor->ar_nodes;
-            const size_t num_nodes = static_cast<size_t>(m_actor->ar_num_nodes);
-            for (size_t i = 0; i < num_nodes; ++i)
+            m_debug_visible_nodes.clear();
+            this->GetNodeBvh().ForEachInFrustum(App::GetCameraManager()->GetCamera(),
+                [this](NodeNum_t n) { m_debug_visible_nodes.push_back(n); });
+            for (NodeNum_t i : m_debug_visible_nodes)
             {
                 if (App::diag_hide_wheels->getBool() && (nodes[i].nd_tyre_node || nodes[i].nd_rim_node))
                     continue;
@@ -831,7 +834,7 @@ void RoR::GfxActor::UpdateDebugView()
             // Node info; drawn after nodes to have higher Z-order
             if ((m_debug_view == DebugViewType::DEBUGVIEW_NODES) || (m_debug_view == DebugViewType::DEBUGVIEW_BEAMS))
             {
-                for (size_t i = 0; i < num_nodes; ++i)
+                for (NodeNum_t i : m_debug_visible_nodes)
                 {
                     if ((App::diag_hide_wheels->getBool() || App::diag_hide_wheel_info->getBool()) && 
                             (nodes[i].nd_tyre_node || nodes[i].nd_rim_node))
@@ -1666,10 +1669,10 @@ void RoR::GfxActor::UpdateRods()
         if (!rod.rod_is_visible)
             continue;
 
-        NodeSB* nodes1 = this->GetSimNodeBuffer();
-        Ogre::Vector3 pos1 = nodes1[rod.rod_node1].AbsPosition;
-        NodeSB* nodes2 = rod.rod_target_actor->GetGfxActor()->GetSimNodeBuffer();
-        Ogre::Vector3 pos2 = nodes2[rod.rod_node2].AbsPosition;
+        const Ogre::Vector3* nodes1 = this->GetSimNodePositions();
+        Ogre::Vector3 pos1 = nodes1[rod.rod_node1];
+        const Ogre::Vector3* nodes2 = rod.rod_target_actor->GetGfxActor()->GetSimNodePositions();
+        Ogre::Vector3 pos2 = nodes2[rod.rod_node2];
 
         // Classic method
         float beam_diameter = rod.rod_diameter;
@@ -1742,6 +1745,16 @@ void RoR::GfxActor::SetRodsVisible(bool visible)
     }
 }
 
+const RoR::NodeBvh& RoR::GfxActor::GetNodeBvh()
+{
+    if (m_node_bvh_dirty)
+    {
+        m_node_bvh.Refresh(m_simbuf.simbuf_nodes.nbs_positions.data(), m_simbuf.simbuf_nodes.GetNumNodes());
+        m_node_bvh_dirty = false;
+    }
+    return m_node_bvh;
+}
+
 void RoR::GfxActor::UpdateSimDataBuffer()
 {
     // PLEASE maintain the same order as in `struct ActorSB`
@@ -1769,18 +1782,29 @@ void RoR::GfxActor::UpdateSimDataBuffer()
     }
 
     // Elements: nodes
-    m_simbuf.simbuf_nodes.resize(m_actor->ar_num_nodes);
-    for (int i = 0; i < m_actor->ar_num_nodes; ++i)
+    // Prefer the snapshot published by the sim thread (a buffer swap); copy live state only if
+    // there's none or if the actor was modified on main thread since (see `ActorManager::InvalidateSimSnapshots()`).
+    ActorSimSnapshotBuffer& snapshots = m_actor->GetSimSnapshots();
+    if (snapshots.AcquireLatest() &&
+        snapshots.GetReadBuffer().ass_epoch == App::GetGameContext()->GetActorManager()->GetSimSnapshotEpoch() &&
+        snapshots.GetReadBuffer().ass_nodes.GetNumNodes() == static_cast<size_t>(m_actor->ar_num_nodes))
+    {
+        std::swap(m_simbuf.simbuf_nodes, snapshots.GetReadBuffer().ass_nodes);
+    }
+    else
     {
-        auto node = m_actor->ar_nodes[i];
-        m_simbuf.simbuf_nodes[i].AbsPosition = node.AbsPosition;
-        m_simbuf.simbuf_nodes[i].nd_has_contact = node.nd_has_ground_contact || node.nd_has_mesh_contact;
+        m_simbuf.simbuf_nodes.FillFrom(m_actor->ar_nodes, m_actor->ar_num_nodes);
     }
 
+    std::fill(m_simbuf.simbuf_nodes.nbs_wet_bits.begin(), m_simbuf.simbuf_nodes.nbs_wet_bits.end(), 0);
     for (NodeGfx& nx: m_gfx_nodes)
     {
-        m_simbuf.simbuf_nodes[nx.nx_node_idx].nd_is_wet = (nx.nx_wet_time_sec != -1.f);
+        if (nx.nx_wet_time_sec != -1.f)
+        {
+            m_simbuf.simbuf_nodes.SetWet(nx.nx_node_idx);
+        }
     }
+    m_node_bvh_dirty = true;
 
     // Elements: beams
     for (BeamGfx& rod: m_gfx_beams)
@@ -1936,6 +1960,7 @@ void RoR::GfxActor::UpdateWheelVisuals()
         {
             auto func = std::function<void()>([this, w]()
                 {
+                    ROR_TRACE_SCOPE("Flexwheel");
                     w.wx_flex_mesh->flexitCompute();
                 });
             auto task_handle = App::GetThreadPool()->RunTask(func);
@@ -1986,9 +2011,9 @@ void RoR::GfxActor::UpdateAirbrakes()
         AirbrakeGfx abx = m_gfx_airbrakes[i];
         const float ratio = m_simbuf.simbuf_airbrakes[i].simbuf_ab_ratio;
         const float maxangle = m_actor->ar_airbrakes[i]->getMaxAngle();
-        Ogre::Vector3 ref_node_pos = m_simbuf.simbuf_nodes[m_gfx_airbrakes[i].abx_ref_node].AbsPosition;
-        Ogre::Vector3 x_node_pos   = m_simbuf.simbuf_nodes[m_gfx_airbrakes[i].abx_x_node].AbsPosition;
-        Ogre::Vector3 y_node_pos   = m_simbuf.simbuf_nodes[m_gfx_airbrakes[i].abx_y_node].AbsPosition;
+        Ogre::Vector3 ref_node_pos = m_simbuf.simbuf_nodes.nbs_positions[m_gfx_airbrakes[i].abx_ref_node];
+        Ogre::Vector3 x_node_pos   = m_simbuf.simbuf_nodes.nbs_positions[m_gfx_airbrakes[i].abx_x_node];
+        Ogre::Vector3 y_node_pos   = m_simbuf.simbuf_nodes.nbs_positions[m_gfx_airbrakes[i].abx_y_node];
 
         // -- Ported from `AirBrake::updatePosition()` --
         Ogre::Vector3 normal = (y_node_pos - ref_node_pos).crossProduct(x_node_pos - ref_node_pos);
@@ -2011,8 +2036,8 @@ void RoR::GfxActor::UpdateCParticles()
     for (CParticle& cparticle: m_cparticles)
     {
         App::GetGfxScene()->AdjustParticleSystemTimeFactor(cparticle.psys);
-        const Ogre::Vector3 pos = m_simbuf.simbuf_nodes[cparticle.emitterNode].AbsPosition;
-        const Ogre::Vector3 dir = fast_normalise(pos - m_simbuf.simbuf_nodes[cparticle.directionNode].AbsPosition);
+        const Ogre::Vector3 pos = m_simbuf.simbuf_nodes.nbs_positions[cparticle.emitterNode];
+        const Ogre::Vector3 dir = fast_normalise(pos - m_simbuf.simbuf_nodes.nbs_positions[cparticle.directionNode]);
         cparticle.snode->setPosition(pos);
 
         for (unsigned short j = 0; j < cparticle.psys->getNumEmitters(); j++)
@@ -2034,8 +2059,8 @@ void RoR::GfxActor::UpdateExhausts()
             continue;
 
         App::GetGfxScene()->AdjustParticleSystemTimeFactor(exhaust.smoker);
-        const Ogre::Vector3 pos = m_simbuf.simbuf_nodes[exhaust.emitterNode].AbsPosition;
-        const Ogre::Vector3 dir = pos - m_simbuf.simbuf_nodes[exhaust.directionNode].AbsPosition;
+        const Ogre::Vector3 pos = m_simbuf.simbuf_nodes.nbs_positions[exhaust.emitterNode];
+        const Ogre::Vector3 dir = pos - m_simbuf.simbuf_nodes.nbs_positions[exhaust.directionNode];
         exhaust.smokeNode->setPosition(pos);
 
         const bool active = m_simbuf.simbuf_smoke_enabled && m_simbuf.simbuf_engine_smoke != -1.f;
@@ -2083,11 +2108,11 @@ void RoR::GfxActor::CalculateDriverPos(Ogre::Vector3& out_pos, Ogre::Quaternion&
     ROR_ASSERT(m_driverseat_prop_index != -1);
     Prop* driverseat_prop = &m_props[m_driverseat_prop_index];
 
-    NodeSB* nodes = this->GetSimNodeBuffer();
+    const Ogre::Vector3* nodes = this->GetSimNodePositions();
 
-    const Ogre::Vector3 x_pos = nodes[driverseat_prop->pp_node_x].AbsPosition;
-    const Ogre::Vector3 y_pos = nodes[driverseat_prop->pp_node_y].AbsPosition;
-    const Ogre::Vector3 center_pos = nodes[driverseat_prop->pp_node_ref].AbsPosition;
+    const Ogre::Vector3 x_pos = nodes[driverseat_prop->pp_node_x];
+    const Ogre::Vector3 y_pos = nodes[driverseat_prop->pp_node_y];
+    const Ogre::Vector3 center_pos = nodes[driverseat_prop->pp_node_ref];
 
     const Ogre::Vector3 x_vec = x_pos - center_pos;
     const Ogre::Vector3 y_vec = y_pos - center_pos;
@@ -2115,7 +2140,7 @@ void RoR::GfxActor::UpdateBeaconFlare(Prop & prop, float dt, bool is_player_acto
     using namespace Ogre;
 
     bool enableAll = !((App::gfx_flares_mode->getEnum<GfxFlaresMode>() == GfxFlaresMode::CURR_VEHICLE_HEAD_ONLY) && !is_player_actor);
-    NodeSB* nodes = this->GetSimNodeBuffer();
+    const Ogre::Vector3* nodes = this->GetSimNodePositions();
 
     if (prop.pp_beacon_type == 'b')
     {
@@ -2229,7 +2254,7 @@ void RoR::GfxActor::UpdateBeaconFlare(Prop & prop, float dt, bool is_player_acto
     }
     else if (prop.pp_beacon_type == 'R' || prop.pp_beacon_type == 'L') // Avionic navigation lights (red/green)
     {
-        Vector3 mposition = nodes[prop.pp_node_ref].AbsPosition + prop.pp_offset.x * (nodes[prop.pp_node_x].AbsPosition - nodes[prop.pp_node_ref].AbsPosition) + prop.pp_offset.y * (nodes[prop.pp_node_y].AbsPosition - nodes[prop.pp_node_ref].AbsPosition);
+        Vector3 mposition = nodes[prop.pp_node_ref] + prop.pp_offset.x * (nodes[prop.pp_node_x] - nodes[prop.pp_node_ref]) + prop.pp_offset.y * (nodes[prop.pp_node_y] - nodes[prop.pp_node_ref]);
         //billboard
         Vector3 vdir = mposition - App::GetCameraManager()->GetCameraNode()->getPosition();
         float vlen = vdir.length();
@@ -2244,7 +2269,7 @@ void RoR::GfxActor::UpdateBeaconFlare(Prop & prop, float dt, bool is_player_acto
     }
     else if (prop.pp_beacon_type == 'w') // Avionic navigation lights (white rotating beacon)
     {
-        Vector3 mposition = nodes[prop.pp_node_ref].AbsPosition + prop.pp_offset.x * (nodes[prop.pp_node_x].AbsPosition - nodes[prop.pp_node_ref].AbsPosition) + prop.pp_offset.y * (nodes[prop.pp_node_y].AbsPosition - nodes[prop.pp_node_ref].AbsPosition);
+        Vector3 mposition = nodes[prop.pp_node_ref] + prop.pp_offset.x * (nodes[prop.pp_node_x] - nodes[prop.pp_node_ref]) + prop.pp_offset.y * (nodes[prop.pp_node_y] - nodes[prop.pp_node_ref]);
         prop.pp_beacon_light[0]->setPosition(mposition);
         prop.pp_beacon_rot_angle[0] += dt * prop.pp_beacon_rot_rate[0];//rotate baby!
         //billboard
@@ -2274,7 +2299,7 @@ void RoR::GfxActor::UpdateProps(float dt, bool is_player_actor)
 {
     using namespace Ogre;
 
-    NodeSB* nodes = this->GetSimNodeBuffer();
+    const Ogre::Vector3* nodes = this->GetSimNodePositions();
 
     // Update prop meshes
     for (Prop& prop: m_props)
@@ -2304,12 +2329,12 @@ void RoR::GfxActor::UpdateProps(float dt, bool is_player_actor)
 
         // Update position and orientation
         // -- quick ugly port from `Actor::updateProps()` --- ~ 06/2018
-        Vector3 diffX = nodes[prop.pp_node_x].AbsPosition - nodes[prop.pp_node_ref].AbsPosition;
-        Vector3 diffY = nodes[prop.pp_node_y].AbsPosition - nodes[prop.pp_node_ref].AbsPosition;
+        Vector3 diffX = nodes[prop.pp_node_x] - nodes[prop.pp_node_ref];
+        Vector3 diffY = nodes[prop.pp_node_y] - nodes[prop.pp_node_ref];
 
         Vector3 normal = (diffY.crossProduct(diffX)).normalisedCopy();
 
-        Vector3 mposition = nodes[prop.pp_node_ref].AbsPosition + prop.pp_offset.x * diffX + prop.pp_offset.y * diffY;
+        Vector3 mposition = nodes[prop.pp_node_ref] + prop.pp_offset.x * diffX + prop.pp_offset.y * diffY;
         prop.pp_scene_node->setPosition(mposition + normal * prop.pp_offset.z);
 
         Vector3 refx = diffX.normalisedCopy();
@@ -2791,7 +2816,7 @@ void RoR::GfxActor::CalcPropAnimation(PropAnim& anim, float& cstate, int& div, f
         }
     }
 
-    const Ogre::Vector3 node0_pos = this->GetSimNodeBuffer()[0].AbsPosition;
+    const Ogre::Vector3 node0_pos = this->GetSimNodePositions()[0];
     const Ogre::Vector3 node0_velo = m_simbuf.simbuf_node0_velo;
 
     //airspeed indicator
@@ -2870,9 +2895,9 @@ void RoR::GfxActor::CalcPropAnimation(PropAnim& anim, float& cstate, int& div, f
         div++;
     }
 
-    Ogre::Vector3 cam_pos  = this->GetSimNodeBuffer()[m_actor->ar_main_camera_node_pos ].AbsPosition;
-    Ogre::Vector3 cam_roll = this->GetSimNodeBuffer()[m_actor->ar_main_camera_node_roll].AbsPosition;
-    Ogre::Vector3 cam_dir  = this->GetSimNodeBuffer()[m_actor->ar_main_camera_node_dir ].AbsPosition;
+    Ogre::Vector3 cam_pos  = this->GetSimNodePositions()[m_actor->ar_main_camera_node_pos ];
+    Ogre::Vector3 cam_roll = this->GetSimNodePositions()[m_actor->ar_main_camera_node_roll];
+    Ogre::Vector3 cam_dir  = this->GetSimNodePositions()[m_actor->ar_main_camera_node_dir ];
 
     // roll
     if (anim.animFlags & PROP_ANIM_FLAG_ROLL)
@@ -3143,9 +3168,30 @@ void RoR::GfxActor::SortFlexbodies()
     std::sort(m_flexbodies.begin(), m_flexbodies.end(), [](FlexBody* a, FlexBody* b) { return a->getVertexCount() > b->getVertexCount(); });
 }
 
+const int FLEXBODY_TASK_MAX_VERTICES = 32768; //!< Larger flexbodies are computed as multiple tasks.
+const int FLEXBODY_LOD_MAX_INTERVAL = 8;      //!< Max. frames between full updates of small on-screen flexbodies.
+const float FLEXBODY_LOD_FULL_RATE_SIZE = 0.2f; //!< Bounding radius relative to half the screen height; bigger flexbodies update every frame.
+
+/// @return Number of frames a full flexbody update may be deferred by; INT_MAX = until it's on screen again.
+static int CalcFlexbodyLodInterval(FlexBody* fb, Ogre::Camera* camera, float& out_max_error)
+{
+    const Ogre::Sphere bounds(fb->getFlexitCenter(), fb->getEntity()->getBoundingRadius());
+    const float distance = camera->getDerivedPosition().distance(bounds.getCenter());
+    out_max_error = std::max(0.01f, distance * 0.002f); // Roughly a pixel.
+
+    if (!camera->isVisible(bounds))
+        return INT_MAX;
+
+    const float screen_size = bounds.getRadius() / std::max(distance * std::tan(camera->getFOVy().valueRadians() * 0.5f), 0.001f);
+    if (screen_size >= FLEXBODY_LOD_FULL_RATE_SIZE)
+        return 1;
+    return std::min(FLEXBODY_LOD_MAX_INTERVAL, static_cast<int>(FLEXBODY_LOD_FULL_RATE_SIZE / screen_size));
+}
+
 void RoR::GfxActor::UpdateFlexbodies()
 {
     m_flexbody_tasks.clear();
+    Ogre::Camera* camera = App::GetCameraManager()->GetCamera();
 
     for (FlexBody* fb: m_flexbodies)
     {
@@ -3156,12 +3202,44 @@ void RoR::GfxActor::UpdateFlexbodies()
         // Update visible on background thread
         if (fb->isVisible())
         {
-            auto func = std::function<void()>([fb]()
+            // Update LOD: distant and off-screen bodies just follow their node frame, unless they deformed.
+            if (App::gfx_flexbody_lod->getBool())
+            {
+                float max_error = 0.f;
+                const int interval = CalcFlexbodyLodInterval(fb, camera, max_error);
+                if (fb->getFramesSinceFullUpdate() < interval - 1 && fb->updateRigidTransform(max_error))
                 {
-                    fb->computeFlexbody();
-                });
-            auto task_handle = App::GetThreadPool()->RunTask(func);
-            m_flexbody_tasks.push_back(task_handle);
+                    continue; // `FinishFlexbodyTasks()` only moves the scene node.
+                }
+            }
+
+            const int num_verts = fb->getVertexCount();
+            if (num_verts <= FLEXBODY_TASK_MAX_VERTICES)
+            {
+                auto func = std::function<void()>([fb]()
+                    {
+                        ROR_TRACE_SCOPE("Flexbody");
+                        fb->computeFlexbody();
+                    });
+                auto task_handle = App::GetThreadPool()->RunTask(func);
+                m_flexbody_tasks.push_back(task_handle);
+            }
+            else
+            {
+                // Big meshes would be the critical path of the frame - split into vertex ranges.
+                fb->computeFlexbodyCenter();
+                for (int begin = 0; begin < num_verts; begin += FLEXBODY_TASK_MAX_VERTICES)
+                {
+                    const int end = std::min(begin + FLEXBODY_TASK_MAX_VERTICES, num_verts);
+                    auto func = std::function<void()>([fb, begin, end]()
+                        {
+                            ROR_TRACE_SCOPE("Flexbody range");
+                            fb->computeFlexbodyRange(begin, end);
+                        });
+                    auto task_handle = App::GetThreadPool()->RunTask(func);
+                    m_flexbody_tasks.push_back(task_handle);
+                }
+            }
         }
     }
 }
@@ -3218,7 +3296,7 @@ void RoR::GfxActor::UpdateFlares(float dt, bool is_player)
     // Flare states are determined in simulation, this function only applies them to OGRE objects
     // ------------------------------------------------------------------------------------------
 
-    NodeSB* nodes = this->GetSimNodeBuffer();
+    const Ogre::Vector3* nodes = this->GetSimNodePositions();
 
     int num_flares = static_cast<int>(m_actor->ar_flares.size());
     for (int i=0; i<num_flares; ++i)
@@ -3251,9 +3329,9 @@ void RoR::GfxActor::UpdateFlares(float dt, bool is_player)
             flare.light->setVisible(flare.intensity > 0 && ShouldEnableLightSource(flare.fl_type, is_player));
         }
 
-        Ogre::Vector3 normal = (nodes[flare.nodey].AbsPosition - nodes[flare.noderef].AbsPosition).crossProduct(nodes[flare.nodex].AbsPosition - nodes[flare.noderef].AbsPosition);
+        Ogre::Vector3 normal = (nodes[flare.nodey] - nodes[flare.noderef]).crossProduct(nodes[flare.nodex] - nodes[flare.noderef]);
         normal.normalise();
-        Ogre::Vector3 mposition = nodes[flare.noderef].AbsPosition + flare.offsetx * (nodes[flare.nodex].AbsPosition - nodes[flare.noderef].AbsPosition) + flare.offsety * (nodes[flare.nodey].AbsPosition - nodes[flare.noderef].AbsPosition);
+        Ogre::Vector3 mposition = nodes[flare.noderef] + flare.offsetx * (nodes[flare.nodex] - nodes[flare.noderef]) + flare.offsety * (nodes[flare.nodey] - nodes[flare.noderef]);
         Ogre::Vector3 vdir = mposition - App::GetCameraManager()->GetCameraNode()->getPosition();
         float vlen = vdir.length();
         // not visible from 500m distance
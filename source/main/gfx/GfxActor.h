@@ -30,6 +30,7 @@
 #include "Differentials.h"
 #include "ForwardDeclarations.h"
 #include "GfxData.h"
+#include "NodeBvh.h"
 #include "RigDef_Prerequisites.h"
 #include "SimBuffers.h"
 #include "SurveyMapEntity.h"
@@ -123,7 +124,9 @@ public:
 
     void                 UpdateSimDataBuffer(); //!< Copies sim. data from `Actor` to `GfxActor` for later update
     ActorSB&             GetSimDataBuffer() { return m_simbuf; }
-    NodeSB*              GetSimNodeBuffer() { return m_simbuf.simbuf_nodes.data(); }
+    const NodeBufferSB&  GetSimNodeBuffer() { return m_simbuf.simbuf_nodes; }
+    const Ogre::Vector3* GetSimNodePositions() { return m_simbuf.simbuf_nodes.nbs_positions.data(); } //!< Indexed by `NodeNum_t`
+    const NodeBvh&       GetNodeBvh();       //!< Node BVH refitted from the simbuffer on first use after each `UpdateSimDataBuffer()`
 
     // Internal updates
 
@@ -212,6 +215,9 @@ private:
     SurveyMapEntity             m_surveymap_entity;
 
     ActorSB                     m_simbuf;
+    NodeBvh                     m_node_bvh;
+    bool                        m_node_bvh_dirty = true;
+    std::vector<NodeNum_t>      m_debug_visible_nodes; //!< Scratch buffer for `UpdateDebugView()`
 };
 
 /// @} // addtogroup Gfx
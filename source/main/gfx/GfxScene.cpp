@@ -535,8 +535,8 @@ void GfxScene::UpdateFreeBeamGfx(float dt)
         ROR_ASSERT(freeforce.ffc_target_node < freeforce.ffc_target_actor->ar_num_nodes);
 
         // Get node positions
-        Ogre::Vector3 basenode_pos = gfx_actor_base->GetSimNodeBuffer()[freeforce.ffc_base_node].AbsPosition;
-        Ogre::Vector3 targetnode_pos = gfx_actor_target->GetSimNodeBuffer()[freeforce.ffc_target_node].AbsPosition;
+        Ogre::Vector3 basenode_pos = gfx_actor_base->GetSimNodePositions()[freeforce.ffc_base_node];
+        Ogre::Vector3 targetnode_pos = gfx_actor_target->GetSimNodePositions()[freeforce.ffc_target_node];
 
         // Do the transforms
         freebeam.fbx_scenenode->setPosition(basenode_pos.midPoint(targetnode_pos));
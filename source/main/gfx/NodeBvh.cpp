@@ -0,0 +1,129 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "NodeBvh.h"
+
+#include <algorithm>
+
+using namespace Ogre;
+using namespace RoR;
+
+void NodeBvh::Refresh(const Ogre::Vector3* nodes, size_t num_nodes)
+{
+    if (m_indices.size() != num_nodes)
+    {
+        this->Build(nodes, num_nodes);
+        return;
+    }
+
+    // Refit bottom-up; children always have higher indices than their parent.
+    for (int i = static_cast<int>(m_tree.size()) - 1; i >= 0; i--)
+    {
+        TreeNode& tn = m_tree[i];
+        if (tn.tn_count > 0)
+        {
+            tn.tn_min = nodes[m_indices[tn.tn_first]];
+            tn.tn_max = tn.tn_min;
+            for (int j = tn.tn_first + 1; j < tn.tn_first + tn.tn_count; j++)
+            {
+                tn.tn_min.makeFloor(nodes[m_indices[j]]);
+                tn.tn_max.makeCeil(nodes[m_indices[j]]);
+            }
+        }
+        else
+        {
+            const TreeNode& left = m_tree[tn.tn_first];
+            const TreeNode& right = m_tree[tn.tn_first + 1];
+            tn.tn_min = left.tn_min;
+            tn.tn_min.makeFloor(right.tn_min);
+            tn.tn_max = left.tn_max;
+            tn.tn_max.makeCeil(right.tn_max);
+        }
+    }
+}
+
+AxisAlignedBox NodeBvh::GetBoundingBox() const
+{
+    if (m_tree.empty())
+        return AxisAlignedBox::BOX_NULL;
+    return AxisAlignedBox(m_tree[0].tn_min, m_tree[0].tn_max);
+}
+
+void NodeBvh::Build(const Ogre::Vector3* nodes, size_t num_nodes)
+{
+    m_tree.clear();
+    m_indices.resize(num_nodes);
+    for (size_t i = 0; i < num_nodes; i++)
+    {
+        m_indices[i] = static_cast<NodeNum_t>(i);
+    }
+
+    if (num_nodes == 0)
+        return;
+
+    m_tree.reserve(2 * (num_nodes / LEAF_SIZE + 1));
+    m_tree.emplace_back();
+    this->BuildRecursive(nodes, 0, 0, static_cast<int>(num_nodes));
+}
+
+void NodeBvh::BuildRecursive(const Ogre::Vector3* nodes, int tree_index, int first, int count)
+{
+    Vector3 bb_min = nodes[m_indices[first]];
+    Vector3 bb_max = bb_min;
+    for (int i = first + 1; i < first + count; i++)
+    {
+        bb_min.makeFloor(nodes[m_indices[i]]);
+        bb_max.makeCeil(nodes[m_indices[i]]);
+    }
+    m_tree[tree_index].tn_min = bb_min;
+    m_tree[tree_index].tn_max = bb_max;
+
+    if (count <= LEAF_SIZE)
+    {
+        m_tree[tree_index].tn_first = first;
+        m_tree[tree_index].tn_count = count;
+        return;
+    }
+
+    // Median split along the longest axis.
+    const Vector3 extent = bb_max - bb_min;
+    const int axis = (extent.x >= extent.y && extent.x >= extent.z) ? 0 : ((extent.y >= extent.z) ? 1 : 2);
+    const int half = count / 2;
+    std::nth_element(m_indices.begin() + first, m_indices.begin() + first + half, m_indices.begin() + first + count,
+        [nodes, axis](NodeNum_t a, NodeNum_t b) { return nodes[a][axis] < nodes[b][axis]; });
+
+    // Children are allocated after the parent, so a reverse pass can refit bottom-up.
+    const int left = static_cast<int>(m_tree.size());
+    m_tree.emplace_back();
+    m_tree.emplace_back();
+    m_tree[tree_index].tn_first = left;
+    m_tree[tree_index].tn_count = 0;
+
+    this->BuildRecursive(nodes, left, first, half);
+    this->BuildRecursive(nodes, left + 1, first + half, count - half);
+}
+
+bool NodeBvh::IntersectRay(const Ray& ray, const TreeNode& tn, float radius, float max_distance) const
+{
+    const AxisAlignedBox box(tn.tn_min - radius, tn.tn_max + radius);
+    if (box.contains(ray.getOrigin()))
+        return true;
+    std::pair<bool, Real> result = ray.intersects(box);
+    return result.first && result.second < max_distance;
+}
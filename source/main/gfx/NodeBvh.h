@@ -0,0 +1,149 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+/// @brief  Bounding volume hierarchy over an actor's simbuffer nodes (mouse picking, debug views).
+
+#pragma once
+
+#include "Application.h"
+#include "SimBuffers.h"
+
+#include <OgreAxisAlignedBox.h>
+#include <OgreFrustum.h>
+#include <OgreRay.h>
+#include <OgreSphere.h>
+#include <limits>
+#include <vector>
+
+namespace RoR {
+
+/// @addtogroup Gfx
+/// @{
+
+/// Binary AABB tree over simbuffer node positions. The topology is built once (median splits)
+/// and then only refitted from the simbuffer - softbodies deform but rarely tear apart,
+/// so the tree quality stays reasonable while the refresh is a single linear pass.
+class NodeBvh
+{
+public:
+
+    struct RayHit
+    {
+        NodeNum_t  nbh_node = NODENUM_INVALID;
+        float      nbh_distance = std::numeric_limits<float>::max(); //!< Distance along the ray.
+    };
+
+    void Refresh(const Ogre::Vector3* nodes, size_t num_nodes); //!< Refits boxes; (re)builds topology if the node count changed.
+    bool IsEmpty() const { return m_tree.empty(); }
+    Ogre::AxisAlignedBox GetBoundingBox() const;
+
+    /// Finds the closest node whose sphere of `radius` the ray hits, closer than `max_distance`.
+    /// @param filter `bool(NodeNum_t)`; return false to skip a node.
+    template <typename Filter> RayHit CastRay(const Ogre::Ray& ray, const Ogre::Vector3* nodes, float radius, float max_distance, Filter filter) const
+    {
+        RayHit hit;
+        hit.nbh_distance = max_distance;
+        this->Traverse(
+            [&](const TreeNode& tn) { return this->IntersectRay(ray, tn, radius, hit.nbh_distance); },
+            [&](NodeNum_t n)
+            {
+                std::pair<bool, Ogre::Real> result = ray.intersects(Ogre::Sphere(nodes[n], radius));
+                // On equal distance, prefer the lower node number (same as a linear scan would).
+                if (result.first && (result.second < hit.nbh_distance || (result.second == hit.nbh_distance && hit.nbh_node != NODENUM_INVALID && n < hit.nbh_node)) && filter(n))
+                {
+                    hit.nbh_distance = result.second;
+                    hit.nbh_node = n;
+                }
+            });
+        return hit;
+    }
+
+    /// Invokes `func(NodeNum_t, float distance)` for every node whose sphere of `radius` the ray hits.
+    template <typename Func> void ForEachRayHit(const Ogre::Ray& ray, const Ogre::Vector3* nodes, float radius, Func func) const
+    {
+        const float max_distance = std::numeric_limits<float>::max();
+        this->Traverse(
+            [&](const TreeNode& tn) { return this->IntersectRay(ray, tn, radius, max_distance); },
+            [&](NodeNum_t n)
+            {
+                std::pair<bool, Ogre::Real> result = ray.intersects(Ogre::Sphere(nodes[n], radius));
+                if (result.first)
+                    func(n, result.second);
+            });
+    }
+
+    /// Invokes `func(NodeNum_t)` for every node in a leaf which intersects the frustum (coarse - may include nodes slightly outside).
+    template <typename Func> void ForEachInFrustum(const Ogre::Frustum* frustum, Func func) const
+    {
+        this->Traverse(
+            [&](const TreeNode& tn) { return frustum->isVisible(Ogre::AxisAlignedBox(tn.tn_min, tn.tn_max)); },
+            func);
+    }
+
+private:
+
+    static const int LEAF_SIZE = 4;
+
+    struct TreeNode
+    {
+        Ogre::Vector3  tn_min;
+        Ogre::Vector3  tn_max;
+        int            tn_first = 0;  //!< Leaf: index into `m_indices`; inner: index of left child (right = left + 1).
+        int            tn_count = 0;  //!< Leaf: number of nodes; inner: 0.
+    };
+
+    void Build(const Ogre::Vector3* nodes, size_t num_nodes);
+    void BuildRecursive(const Ogre::Vector3* nodes, int tree_index, int first, int count);
+    bool IntersectRay(const Ogre::Ray& ray, const TreeNode& tn, float radius, float max_distance) const;
+
+    template <typename Visit, typename Emit> void Traverse(Visit visit, Emit emit) const
+    {
+        if (m_tree.empty())
+            return;
+
+        int stack[64];
+        int stack_size = 0;
+        stack[stack_size++] = 0;
+        while (stack_size > 0)
+        {
+            const TreeNode& tn = m_tree[stack[--stack_size]];
+            if (!visit(tn))
+                continue;
+
+            if (tn.tn_count > 0)
+            {
+                for (int i = tn.tn_first; i < tn.tn_first + tn.tn_count; i++)
+                    emit(m_indices[i]);
+            }
+            else
+            {
+                stack[stack_size++] = tn.tn_first + 1;
+                stack[stack_size++] = tn.tn_first;
+            }
+        }
+    }
+
+    std::vector<TreeNode>   m_tree;     //!< Root at index 0.
+    std::vector<NodeNum_t>  m_indices;  //!< Node numbers, grouped by leaf.
+};
+
+/// @} // addtogroup Gfx
+
+} // namespace RoR
@@ -25,6 +25,42 @@
 
 using namespace RoR;
 
+void NodeBufferSB::Resize(size_t num_nodes)
+{
+    if (nbs_positions.size() == num_nodes)
+        return;
+
+    const size_t num_words = (num_nodes + 63) / 64;
+    nbs_positions.resize(num_nodes);
+    nbs_contact_bits.assign(num_words, 0);
+    nbs_wet_bits.assign(num_words, 0);
+}
+
+void NodeBufferSB::FillFrom(const node_t* nodes, int num_nodes)
+{
+    this->Resize(static_cast<size_t>(num_nodes));
+
+    // Single sequential pass: positions are written out contiguously and the contact
+    // flags are accumulated in a register, storing one word per 64 nodes.
+    Ogre::Vector3* positions = nbs_positions.data();
+    uint64_t* contact_bits = nbs_contact_bits.data();
+    uint64_t bits = 0;
+    for (int i = 0; i < num_nodes; ++i)
+    {
+        positions[i] = nodes[i].AbsPosition;
+        bits |= uint64_t(nodes[i].nd_has_ground_contact || nodes[i].nd_has_mesh_contact) << (i & 63);
+        if ((i & 63) == 63)
+        {
+            contact_bits[i >> 6] = bits;
+            bits = 0;
+        }
+    }
+    if ((num_nodes & 63) != 0)
+    {
+        contact_bits[num_nodes >> 6] = bits;
+    }
+}
+
 GameContextSB::GameContextSB()
 {
     // Constructs `ActorPtr` - doesn't compile without `#include Actor.h` - not pretty if in header (even if auto-generated by C++).
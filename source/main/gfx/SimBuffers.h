@@ -25,6 +25,7 @@
 #include "CameraManager.h"
 #include "Differentials.h"
 #include "SimData.h"
+#include "TripleBuffer.h"
 #include <Ogre.h>
 
 /*
@@ -40,6 +41,8 @@
        It only updates positons and forces, it doesn't deal with graphics at all.
     2. When time comes for rendering, simulation is halted and all data relevant to graphics
        are copied-out to simbuffers. Then, simulation is resumed.
+       The bulkiest part, node positions, is instead published by the sim thread itself
+       at the end of each step (see `ActorSimSnapshot`), so the halted window only swaps buffers.
     3. The rendering thread processes the simbuffers and updates visual objects.
 
     OVERVIEW OF GAMEPLAY OBJECTS
@@ -51,7 +54,7 @@
 
         GameContext (gamecontext.h)  /  GameContextSB  /  GfxScene    (gfxscene.h)
         Actor       (actor.h)        /  ActorSB        /  GfxActor    (gfxactor.h)
-        node_t      (simdata.h)      /  NodeSB         /  NodeGfx     (gfxdata.h)
+        node_t      (simdata.h)      /  NodeBufferSB   /  NodeGfx     (gfxdata.h)
         beam_t      (simdata.h)      /  -              /  BeamGfx         (gfxdata.h)
         command_t   (simdata.h)      /  CommandKeySB   /  -
         wheel_t     (simdata.h)      /  -              /  WheelGfx    (gfxdata.h)
@@ -64,13 +67,31 @@
 
 namespace RoR {
 
-struct NodeSB
+/// All nodes of an actor, structure-of-arrays: readers mostly want just positions, so those are
+/// a contiguous array (no stride over unused fields); flags are packed 64 nodes per word.
+struct NodeBufferSB
 {
-    Ogre::Vector3     AbsPosition; // classic name
-    bool              nd_has_contact:1;
-    bool              nd_is_wet:1;
+    std::vector<Ogre::Vector3> nbs_positions;
+    std::vector<uint64_t>      nbs_contact_bits;
+    std::vector<uint64_t>      nbs_wet_bits;     //!< Filled by `GfxActor`, not by the simulation.
+
+    void              Resize(size_t num_nodes);  //!< Only reallocates if the node count changed.
+    void              FillFrom(const node_t* nodes, int num_nodes); //!< Positions + contact flags.
+    size_t            GetNumNodes() const                { return nbs_positions.size(); }
+    bool              HasContact(NodeNum_t n) const      { return (nbs_contact_bits[n >> 6] >> (n & 63)) & 1; }
+    bool              IsWet(NodeNum_t n) const           { return (nbs_wet_bits[n >> 6] >> (n & 63)) & 1; }
+    void              SetWet(NodeNum_t n)                { nbs_wet_bits[n >> 6] |= (uint64_t(1) << (n & 63)); }
 };
 
+/// Published by the simulation thread at the end of each step, consumed by `GfxActor::UpdateSimDataBuffer()`.
+struct ActorSimSnapshot
+{
+    NodeBufferSB      ass_nodes;
+    uint32_t          ass_epoch = 0; //!< `ActorManager::GetSimSnapshotEpoch()` at publish time; older snapshots are discarded.
+};
+
+typedef TripleBuffer<ActorSimSnapshot> ActorSimSnapshotBuffer;
+
 struct ScrewpropSB
 {
     float             simbuf_sp_rudder;
@@ -131,7 +152,7 @@ struct ActorSB
     NodeNum_t         simbuf_camera0_roll_node        = 0; // Node#0
 
     // Elements
-    std::vector<NodeSB>       simbuf_nodes;
+    NodeBufferSB              simbuf_nodes;
     std::vector<ScrewpropSB>  simbuf_screwprops;
     std::array<CommandKeySB, MAX_COMMANDS+1> simbuf_commandkey; //!< BEWARE: commandkeys are indexed 1-MAX_COMMANDS!
     std::vector<PropAnimKeySB> simbuf_prop_anim_keys;
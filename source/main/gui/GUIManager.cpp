@@ -138,6 +138,7 @@ bool GUIManager::AreStaticMenusAllowed() //!< i.e. top menubar / vehicle UI butt
             !this->TextureToolWindow.IsHovered() &&
             !this->NodeBeamUtils.IsHovered() &&
             !this->CollisionsDebug.IsHovered() &&
+            !this->PhysicsProfilerView.IsHovered() &&
             !this->MainSelector.IsHovered() &&
             !this->SurveyMap.IsHovered() &&
             !this->FlexbodyDebug.IsHovered());
@@ -178,6 +179,11 @@ void GUIManager::DrawSimulationGui(float dt)
         this->CollisionsDebug.Draw();
     }
 
+    if (this->PhysicsProfilerView.IsVisible())
+    {
+        this->PhysicsProfilerView.Draw();
+    }
+
     if (this->MessageBoxDialog.IsVisible())
     {
         this->MessageBoxDialog.Draw();
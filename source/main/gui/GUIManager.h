@@ -45,6 +45,7 @@
 #include "GUI_MultiplayerClientList.h"
 #include "GUI_MainSelector.h"
 #include "GUI_NodeBeamUtils.h"
+#include "GUI_PhysicsProfilerView.h"
 #include "GUI_DirectionArrow.h"
 #include "GUI_VehicleInfoTPanel.h"
 #include "GUI_SimPerfStats.h"
@@ -129,6 +130,7 @@ public:
     GUI::GameControls           GameControls;
     GUI::RepositorySelector     RepositorySelector;
     GUI::NodeBeamUtils          NodeBeamUtils;
+    GUI::PhysicsProfilerView    PhysicsProfilerView;
     GUI::LoadingWindow          LoadingWindow;
     GUI::TopMenubar             TopMenubar;
     GUI::ConsoleWindow          ConsoleWindow;
@@ -742,7 +742,7 @@ void OverlayWrapper::UpdateLandVehicleHUD(RoR::GfxActor* ga)
 void OverlayWrapper::UpdateAerialHUD(RoR::GfxActor* gfx_actor)
 {
     RoR::ActorSB& simbuf = gfx_actor->GetSimDataBuffer();
-    RoR::NodeSB* nodes = gfx_actor->GetSimNodeBuffer();
+    const Ogre::Vector3* nodes = gfx_actor->GetSimNodePositions();
 
     auto const& simbuf_ae = simbuf.simbuf_aeroengines;
     int num_ae = static_cast<int>( simbuf_ae.size() );
@@ -764,7 +764,7 @@ void OverlayWrapper::UpdateAerialHUD(RoR::GfxActor* gfx_actor)
     float ground_speed_kt = simbuf.simbuf_node0_velo.length() * 1.9438; // 1.943 = m/s in knots/s
 
     //tropospheric model valid up to 11.000m (33.000ft)
-    float altitude = nodes[0].AbsPosition.y;
+    float altitude = nodes[0].y;
     //float sea_level_temperature=273.15+15.0; //in Kelvin
     float sea_level_pressure = 101325; //in Pa
     //float airtemperature=sea_level_temperature-altitude*0.0065; //in Kelvin
@@ -807,15 +807,15 @@ void OverlayWrapper::UpdateAerialHUD(RoR::GfxActor* gfx_actor)
     m_aerial_dashboard.aoatexture->setTextureRotate(Degree(-angle * 4.7 + 90.0));
 
     // altimeter
-    angle = nodes[0].AbsPosition.y * 1.1811;
+    angle = nodes[0].y * 1.1811;
     m_aerial_dashboard.altimetertexture->setTextureRotate(Degree(-angle));
     char altc[10];
-    sprintf(altc, "%03u", (int)(nodes[0].AbsPosition.y / 30.48));
+    sprintf(altc, "%03u", (int)(nodes[0].y / 30.48));
     m_aerial_dashboard.alt_value_textarea->setCaption(altc);
 
     //adi
     //roll
-    Vector3 rollv = nodes[simbuf.simbuf_camera0_pos_node].AbsPosition - nodes[simbuf.simbuf_camera0_roll_node].AbsPosition;
+    Vector3 rollv = nodes[simbuf.simbuf_camera0_pos_node] - nodes[simbuf.simbuf_camera0_roll_node];
     rollv.normalise();
     float rollangle = asin(rollv.dotProduct(Vector3::UNIT_Y));
 
@@ -290,7 +290,7 @@ const ImVec4 MEMGRAPH_NODEY_COLOR_V4(0.27f, 0.76f, 1.f, 1.f);
 void FlexbodyDebug::DrawDebugView(FlexBody* flexbody, Prop* prop, NodeNum_t node_ref, NodeNum_t node_x, NodeNum_t node_y)
 {
     ROR_ASSERT(App::GetGameContext()->GetPlayerActor() != nullptr);
-    NodeSB* nodes = App::GetGameContext()->GetPlayerActor()->GetGfxActor()->GetSimNodeBuffer();
+    const Ogre::Vector3* nodes = App::GetGameContext()->GetPlayerActor()->GetGfxActor()->GetSimNodePositions();
 
     // Var
     ImVec2 screen_size = ImGui::GetIO().DisplaySize;
@@ -307,9 +307,9 @@ void FlexbodyDebug::DrawDebugView(FlexBody* flexbody, Prop* prop, NodeNum_t node
     if (this->show_base_nodes)
     {
         drawlist->ChannelsSetCurrent(LAYER_NODES);
-        Ogre::Vector3 refnode_pos = world2screen.Convert(nodes[node_ref].AbsPosition);
-        Ogre::Vector3 xnode_pos = world2screen.Convert(nodes[node_x].AbsPosition);
-        Ogre::Vector3 ynode_pos = world2screen.Convert(nodes[node_y].AbsPosition);
+        Ogre::Vector3 refnode_pos = world2screen.Convert(nodes[node_ref]);
+        Ogre::Vector3 xnode_pos = world2screen.Convert(nodes[node_x]);
+        Ogre::Vector3 ynode_pos = world2screen.Convert(nodes[node_y]);
         // (z < 0) means "in front of the camera"
         if (refnode_pos.z < 0.f) {drawlist->AddCircleFilled(ImVec2(refnode_pos.x, refnode_pos.y), BASENODE_RADIUS, BASENODE_COLOR); }
         if (xnode_pos.z < 0.f) { drawlist->AddCircleFilled(ImVec2(xnode_pos.x, xnode_pos.y), BASENODE_RADIUS, BASENODE_COLOR); }
@@ -333,7 +333,7 @@ void FlexbodyDebug::DrawDebugView(FlexBody* flexbody, Prop* prop, NodeNum_t node
         for (NodeNum_t node : flexbody->getForsetNodes())
         {
             drawlist->ChannelsSetCurrent(LAYER_NODES);
-            Ogre::Vector3 pos = world2screen.Convert(nodes[node].AbsPosition);
+            Ogre::Vector3 pos = world2screen.Convert(nodes[node]);
             if (pos.z < 0.f) { drawlist->AddCircleFilled(ImVec2(pos.x, pos.y), FORSETNODE_RADIUS, FORSETNODE_COLOR); }
 
             drawlist->ChannelsSetCurrent(LAYER_TEXT);
@@ -407,10 +407,10 @@ void FlexbodyDebug::DrawDebugView(FlexBody* flexbody, Prop* prop, NodeNum_t node
                 }
 
                 // The locator nodes
-                Locator_t& loc = flexbody->getVertexLocator(i);
-                Ogre::Vector3 refnode_pos = world2screen.Convert(nodes[loc.ref].AbsPosition);
-                Ogre::Vector3 xnode_pos = world2screen.Convert(nodes[loc.nx].AbsPosition);
-                Ogre::Vector3 ynode_pos = world2screen.Convert(nodes[loc.ny].AbsPosition);
+                const Locator_t& loc = flexbody->getVertexLocator(i);
+                Ogre::Vector3 refnode_pos = world2screen.Convert(nodes[loc.ref]);
+                Ogre::Vector3 xnode_pos = world2screen.Convert(nodes[loc.nx]);
+                Ogre::Vector3 ynode_pos = world2screen.Convert(nodes[loc.ny]);
                 if (!this->show_forset_nodes) // don't draw twice
                 {
                     // (z < 0) means "in front of the camera"
@@ -537,7 +537,7 @@ void FlexbodyDebug::DrawLocatorsTable(FlexBody* flexbody, bool& locators_visible
     for (int i = 0; i < flexbody->getVertexCount(); i++)
     {
         ImGui::PushID(i);
-        Locator_t& loc = flexbody->getVertexLocator(i);
+        const Locator_t& loc = flexbody->getVertexLocator(i);
         ImGui::TextDisabled("%d", i);
         ImGui::NextColumn();
         ImGui::Text("%d", (int)loc.ref);
@@ -633,7 +633,7 @@ void FlexbodyDebug::DrawMemoryOrderGraph(FlexBody* flexbody)
     for (int i = 0; i < num_verts; i++)
     {
         const int NUM_SEGMENTS = 5;
-        Locator_t& loc = flexbody->getVertexLocator(i);
+        const Locator_t& loc = flexbody->getVertexLocator(i);
         ImVec2 bottom_x_pos = top_left_pos + ImVec2(i * x_step, size.y);
 
         drawlist->AddCircleFilled(bottom_x_pos - ImVec2(0, (loc.ref - forset_min) * y_step), MEMGRAPH_NODE_RADIUS, ImColor(MEMGRAPH_NODEREF_COLOR_V4), NUM_SEGMENTS);
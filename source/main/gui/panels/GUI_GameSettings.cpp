@@ -440,6 +440,7 @@ void GameSettings::DrawGraphicsSettings()
     DrawGIntCheck(App::gfx_skidmarks_mode,   _LC("GameSettings", "Enable skidmarks"));
 
     DrawGCheckbox(App::gfx_auto_lod,      _LC("GameSettings", "Enable automatic mesh LOD generator (Increases loading times)"));
+    DrawGCheckbox(App::gfx_flexbody_lod,  _LC("GameSettings", "Reduce flexbody updates when distant or off-screen"));
 
     DrawGCheckbox(App::gfx_envmap_enabled,   _LC("GameSettings", "Realtime reflections"));
     if (App::gfx_envmap_enabled->getBool())
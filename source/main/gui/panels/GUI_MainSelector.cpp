@@ -100,6 +100,24 @@ void MainSelector::Draw()
 
     App::GetGuiManager()->RequestGuiCaptureKeyboard(true);
 
+    // Mods were added/removed in the background - refresh, keep the selection
+    if (m_cache_revision != App::GetCacheSystem()->GetEntriesRevision())
+    {
+        CacheEntryPtr selected_entry;
+        if (m_selected_entry >= 0 && m_selected_entry < static_cast<int>(m_display_entries.size()))
+        {
+            selected_entry = m_display_entries[m_selected_entry].sde_entry;
+        }
+        this->UpdateDisplayLists();
+        for (size_t i = 0; i < m_display_entries.size(); i++)
+        {
+            if (m_display_entries[i].sde_entry == selected_entry)
+            {
+                m_selected_entry = static_cast<int>(i);
+            }
+        }
+    }
+
     // category keyboard control
     const int num_categories = static_cast<int>(m_display_categories.size());
     if (!m_searchbox_was_active || m_search_input == "")
@@ -261,37 +279,25 @@ void MainSelector::Draw()
         DisplayEntry& sd_entry = m_display_entries[m_selected_entry];
 
         // Preview image
-        if (!sd_entry.sde_entry->filecachename.empty())
+        Ogre::TexturePtr preview_tex = App::GetCacheSystem()->FetchThumbnail(sd_entry.sde_entry);
+        if (preview_tex)
         {
             ImVec2 cursor_pos = ImGui::GetCursorPos();
-            try
+            // Scale the image (for dashboards only shrink but don't enlarge so players see actual in-game size).
+            ImVec2 max_size = (ImGui::GetWindowSize() * PREVIEW_SIZE_RATIO);
+            ImVec2 size(preview_tex->getWidth(), preview_tex->getHeight());
+            if (m_loader_type != LT_DashBoard || size.x > max_size.x)
             {
-                Ogre::TexturePtr preview_tex =
-                    Ogre::TextureManager::getSingleton().load(
-                        sd_entry.sde_entry->filecachename, Ogre::RGN_DEFAULT);
-                if (preview_tex)
+                size *= max_size.x / size.x; // Fit size along X
+                if (size.y > max_size.y) // Reduce size along Y if needed
                 {
-                    // Scale the image (for dashboards only shrink but don't enlarge so players see actual in-game size).
-                    ImVec2 max_size = (ImGui::GetWindowSize() * PREVIEW_SIZE_RATIO);
-                    ImVec2 size(preview_tex->getWidth(), preview_tex->getHeight());
-                    if (m_loader_type != LT_DashBoard || size.x > max_size.x)
-                    {
-                        size *= max_size.x / size.x; // Fit size along X
-                        if (size.y > max_size.y) // Reduce size along Y if needed
-                        {
-                            size *= max_size.y / size.y;
-                        }
-                    }
-                    // Draw the image
-                    ImGui::SetCursorPos((cursor_pos + ImGui::GetWindowSize()) - size);
-                    ImGui::Image(reinterpret_cast<ImTextureID>(preview_tex->getHandle()), size);
-                    ImGui::SetCursorPos(cursor_pos);
+                    size *= max_size.y / size.y;
                 }
             }
-            catch(...)
-            {
-                // Invalid texture file - OGRE exception already logged
-            }
+            // Draw the image
+            ImGui::SetCursorPos((cursor_pos + ImGui::GetWindowSize()) - size);
+            ImGui::Image(reinterpret_cast<ImTextureID>(preview_tex->getHandle()), size);
+            ImGui::SetCursorPos(cursor_pos);
         }
 
         // Title and description
@@ -478,6 +484,7 @@ void MainSelector::UpdateDisplayLists()
     }
 
     App::GetCacheSystem()->Query(query);
+    m_cache_revision = App::GetCacheSystem()->GetEntriesRevision();
 
     m_selected_entry = -1;
     for (CacheQueryResult const& res: query.cqy_results)
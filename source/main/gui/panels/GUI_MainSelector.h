@@ -96,6 +96,7 @@ private:
     bool               m_searchbox_was_active = false;
     CacheEntryPtr      m_advertised_entry; //!< Always shown on top, even if not existing in modcache (i.e. dummy default skin)
     bool               m_is_hovered = false;
+    size_t             m_cache_revision = 0;     //!< To pick up mods added/removed in the background, see `CacheSystem::UpdateWatchedContent()`
 
     int                m_selected_category = 0;    //!< Combobox position (uses display list)
     int                m_selected_cid = 0;         //!< Category ID
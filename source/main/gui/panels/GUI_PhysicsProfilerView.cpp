@@ -0,0 +1,154 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+
+#include "GUI_PhysicsProfilerView.h"
+
+#include "ActorManager.h"
+#include "GameContext.h"
+#include "Language.h"
+
+#include <algorithm>
+#include <imgui.h>
+
+using namespace RoR;
+using namespace GUI;
+
+void PhysicsProfilerView::Draw()
+{
+    ImGui::SetNextWindowPosCenter(ImGuiCond_FirstUseEver);
+    ImGuiWindowFlags win_flags = ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_AlwaysAutoResize;
+    bool keep_open = true;
+    ImGui::Begin(_LC("PhysicsProfiler", "Physics profiler"), &keep_open, win_flags);
+
+    PhysicsProfiler& profiler = App::GetGameContext()->GetActorManager()->GetPhysicsProfiler();
+
+    bool enabled = PhysicsProfiler::IsEnabled();
+    if (ImGui::Checkbox(_LC("PhysicsProfiler", "Enabled"), &enabled))
+    {
+        PhysicsProfiler::SetEnabled(enabled);
+    }
+    ImGui::SameLine();
+    if (ImGui::Button(_LC("PhysicsProfiler", "Reset")))
+    {
+        profiler.Reset();
+        m_selected_actor = ACTORINSTANCEID_INVALID;
+    }
+    ImGui::TextDisabled("%s", _LC("PhysicsProfiler", "Console: 'physprof csv' writes totals to the logs directory."));
+    ImGui::Separator();
+
+    // Sort actors by smoothed time per frame
+    std::vector<const PhysicsProfiler::ActorRecord*> records;
+    for (const PhysicsProfiler::ActorRecord& record : profiler.GetRecords())
+    {
+        if (record.ppr_alive)
+            records.push_back(&record);
+    }
+    std::sort(records.begin(), records.end(),
+        [](const PhysicsProfiler::ActorRecord* a, const PhysicsProfiler::ActorRecord* b) { return a->GetFrameMsTotal() > b->GetFrameMsTotal(); });
+
+    this->DrawActorsTable(records);
+    ImGui::Separator();
+
+    const PhysicsProfiler::ActorRecord* selected = nullptr;
+    for (const PhysicsProfiler::ActorRecord* record : records)
+    {
+        if (record->ppr_actor_id == m_selected_actor)
+            selected = record;
+    }
+    this->DrawPhasesTable(selected);
+
+    m_is_hovered = ImGui::IsWindowHovered(ImGuiHoveredFlags_RootAndChildWindows);
+    ImGui::End();
+    if (!keep_open)
+    {
+        this->SetVisible(false);
+    }
+}
+
+void PhysicsProfilerView::DrawActorsTable(const std::vector<const PhysicsProfiler::ActorRecord*>& records)
+{
+    ImGui::Text("%s", _LC("PhysicsProfiler", "Top actors (ms/frame, smoothed):"));
+    ImGui::Columns(4, "PhysProfActors");
+    ImGui::Text("%s", _LC("PhysicsProfiler", "ID"));      ImGui::NextColumn();
+    ImGui::Text("%s", _LC("PhysicsProfiler", "Actor"));   ImGui::NextColumn();
+    ImGui::Text("%s", _LC("PhysicsProfiler", "ms"));      ImGui::NextColumn();
+    ImGui::Text("%s", _LC("PhysicsProfiler", "Worst phase")); ImGui::NextColumn();
+    ImGui::Separator();
+
+    const int num_rows = std::min(static_cast<int>(records.size()), TOP_ACTORS);
+    for (int i = 0; i < num_rows; i++)
+    {
+        const PhysicsProfiler::ActorRecord* record = records[i];
+        int worst_phase = 0;
+        for (int p = 1; p < PHYSICSPHASE_COUNT; p++)
+        {
+            if (record->ppr_frame_ms[p] > record->ppr_frame_ms[worst_phase])
+                worst_phase = p;
+        }
+
+        ImGui::PushID(static_cast<int>(record->ppr_actor_id));
+        if (ImGui::Selectable(std::to_string(record->ppr_actor_id).c_str(), m_selected_actor == record->ppr_actor_id, ImGuiSelectableFlags_SpanAllColumns))
+        {
+            m_selected_actor = (m_selected_actor == record->ppr_actor_id) ? ACTORINSTANCEID_INVALID : record->ppr_actor_id;
+        }
+        ImGui::NextColumn();
+        ImGui::Text("%s", record->ppr_actor_name.c_str());                                ImGui::NextColumn();
+        ImGui::Text("%.3f", record->GetFrameMsTotal());                                   ImGui::NextColumn();
+        ImGui::Text("%s", PhysicsPhaseToString(static_cast<PhysicsPhase>(worst_phase)));  ImGui::NextColumn();
+        ImGui::PopID();
+    }
+    ImGui::Columns(1);
+}
+
+void PhysicsProfilerView::DrawPhasesTable(const PhysicsProfiler::ActorRecord* record)
+{
+    // Either the selected actor, or sum of all live actors.
+    float frame_ms[PHYSICSPHASE_COUNT] = {};
+    if (record)
+    {
+        ImGui::Text(_LC("PhysicsProfiler", "Phases of '%s' (ms/frame):"), record->ppr_actor_name.c_str());
+        std::copy(record->ppr_frame_ms, record->ppr_frame_ms + PHYSICSPHASE_COUNT, frame_ms);
+    }
+    else
+    {
+        ImGui::Text("%s", _LC("PhysicsProfiler", "Phases of all actors (ms/frame); click an actor above for details:"));
+        for (const PhysicsProfiler::ActorRecord& r : App::GetGameContext()->GetActorManager()->GetPhysicsProfiler().GetRecords())
+        {
+            if (!r.ppr_alive)
+                continue;
+            for (int p = 0; p < PHYSICSPHASE_COUNT; p++)
+                frame_ms[p] += r.ppr_frame_ms[p];
+        }
+    }
+
+    int order[PHYSICSPHASE_COUNT];
+    for (int p = 0; p < PHYSICSPHASE_COUNT; p++)
+        order[p] = p;
+    std::sort(order, order + PHYSICSPHASE_COUNT, [&frame_ms](int a, int b) { return frame_ms[a] > frame_ms[b]; });
+
+    float max_ms = std::max(frame_ms[order[0]], 0.001f);
+    for (int p : order)
+    {
+        ImGui::ProgressBar(frame_ms[p] / max_ms, ImVec2(100.f, 0.f), "");
+        ImGui::SameLine();
+        ImGui::Text("%7.3f  %s", frame_ms[p], PhysicsPhaseToString(static_cast<PhysicsPhase>(p)));
+    }
+}
@@ -0,0 +1,54 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+
+#pragma once
+
+#include "Application.h"
+#include "PhysicsProfiler.h"
+
+#include <vector>
+
+namespace RoR {
+namespace GUI {
+
+/// Shows which actors and which physics phases take the most time, see `PhysicsProfiler`.
+class PhysicsProfilerView
+{
+public:
+    const int TOP_ACTORS = 10;
+
+    bool IsVisible() const { return m_is_visible; }
+    bool IsHovered() const { return IsVisible() && m_is_hovered; }
+    void SetVisible(bool value) { m_is_visible = value; m_is_hovered = false; }
+    void Draw();
+
+private:
+
+    void DrawActorsTable(const std::vector<const PhysicsProfiler::ActorRecord*>& records);
+    void DrawPhasesTable(const PhysicsProfiler::ActorRecord* record);
+
+    ActorInstanceID_t m_selected_actor = ACTORINSTANCEID_INVALID; //!< Phases breakdown; invalid = all actors
+    bool m_is_visible = false;
+    bool m_is_hovered = false;
+};
+
+} // namespace GUI
+} // namespace RoR
@@ -23,6 +23,7 @@
 
 #include "Actor.h"
 #include "AppContext.h"
+#include "GameContext.h"
 #include "GUIManager.h"
 #include "Language.h"
 #include <iomanip>
@@ -79,6 +80,19 @@ void SimPerfStats::Draw()
     ImGui::SameLine();
     ImGui::PlotHistogram("", &stats.bestFPS, 1, 0, this->Convert(stats.bestFPS).c_str(), 0.f, stats.bestFPS, histogram_size);
 
+    ImGui::Separator();
+#ifdef USE_ALLOCATION_COUNTER
+    // Heap allocations on the physics hot path (see `AllocationCounter`); ideally 0 in steady state.
+    ImGui::Text("%s %u", _LC("SimPerfStats", "Physics allocations/frame:"),
+        static_cast<unsigned>(App::GetGameContext()->GetActorManager()->GetPhysicsAllocations()));
+#endif
+
+    // Frame pacing quality: a steady frame rate has p99 close to p50.
+    const FramePacer::FrameTimeStats frame_stats = App::GetAppContext()->GetFramePacer().GetFrameTimeStats();
+    ImGui::Text("%s %.2f ms", _LC("SimPerfStats", "Frame time p50:"), frame_stats.fts_p50_ms);
+    ImGui::Text("%s %.2f ms", _LC("SimPerfStats", "Frame time p99:"), frame_stats.fts_p99_ms);
+    ImGui::Text("%s %.2f ms", _LC("SimPerfStats", "Frame jitter (p99 - p50):"), frame_stats.fts_jitter_ms);
+
     ImGui::End();
     ImGui::PopStyleColor(1); // WindowBg
 }
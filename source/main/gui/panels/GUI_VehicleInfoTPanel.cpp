@@ -23,6 +23,7 @@
 
 #include "Application.h"
 #include "Actor.h"
+#include "CacheSystem.h"
 #include "SimData.h"
 #include "Language.h"
 #include "Engine.h"
@@ -147,10 +148,9 @@ void VehicleInfoTPanel::Draw(RoR::GfxActor* actorx)
 
     ImVec2 name_pos = ImGui::GetCursorPos();
     ImVec2 tabs_pos;
-    if (actorx->GetActor()->getUsedActorEntry()->filecachename != "")
+    Ogre::TexturePtr preview_tex = App::GetCacheSystem()->FetchThumbnail(actorx->GetActor()->getUsedActorEntry());
+    if (preview_tex)
     {
-        Ogre::TexturePtr preview_tex = Ogre::TextureManager::getSingleton().load(
-            actorx->GetActor()->getUsedActorEntry()->filecachename, RGN_CACHE);
         // Scale the image
         ImVec2 MAX_PREVIEW_SIZE(100.f, 100.f);
         ImVec2 size(preview_tex->getWidth(), preview_tex->getHeight());
@@ -171,7 +171,7 @@ void VehicleInfoTPanel::Draw(RoR::GfxActor* actorx)
 
     // === DRAW TAB BAR ===
     
-    if (actorx->GetActor()->getUsedActorEntry()->filecachename != "")
+    if (preview_tex)
     {
         ImGui::SetCursorPos(tabs_pos);
     }
@@ -517,7 +517,7 @@ void VehicleInfoTPanel::DrawVehicleStatsUI(RoR::GfxActor* actorx)
 
         if (actorx->GetSimDataBuffer().simbuf_driveable == AIRPLANE)
         {
-            const float altitude = actorx->GetSimNodeBuffer()[0].AbsPosition.y / 30.48 * 100;
+            const float altitude = actorx->GetSimNodePositions()[0].y / 30.48 * 100;
             DrawStatsLine(_LC("SimActorStats", "Altitude: "), fmt::format("{:.0f} feet ({:.0f} meters)", Round(altitude), Round(altitude * 0.30480)));
 
             int engine_num = 1; // UI; count from 1
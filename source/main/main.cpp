@@ -55,6 +55,7 @@
 #include "Skidmark.h"
 #include "SoundScriptManager.h"
 #include "Terrain.h"
+#include "TraceRecorder.h"
 #include "Utils.h"
 #include <Overlay/OgreOverlaySystem.h>
 #include <ctime>
@@ -324,6 +325,7 @@ int main(int argc, char *argv[])
         // --------------------------------------------------------------
 
         auto start_time = std::chrono::high_resolution_clock::now();
+        TraceRecorder::SetThreadName("Main");
 
         while (App::app_state->getEnum<AppState>() != AppState::SHUTDOWN)
         {
@@ -335,9 +337,15 @@ int main(int argc, char *argv[])
             {
                 App::GetGameContext()->GetActorManager()->SyncWithSimThread();
             }
+            App::GetGameContext()->FlushSimMessages(); // Requests posted by physics workers
+            if (App::GetGameContext()->HasMessages() && App::app_state->getEnum<AppState>() == AppState::SIMULATION)
+            {
+                // Handlers may move/modify actors; the snapshots published by the sim thread are outdated.
+                App::GetGameContext()->GetActorManager()->InvalidateSimSnapshots();
+            }
 
             // Game events
-            OgreProfileBegin("RoR message queue");
+            ROR_PROFILE_BEGIN("RoR message queue");
             while (App::GetGameContext()->HasMessages())
             {
                 Message m = App::GetGameContext()->PopMessage();
@@ -1148,7 +1156,7 @@ int main(int argc, char *argv[])
                     {
                         HandleMsgQueueException(m.type);
                     }
-                    delete rq;
+                    App::GetGameContext()->ReleaseActorModifyRequest(rq);
                     break;
                 }
 
@@ -1389,7 +1397,7 @@ int main(int argc, char *argv[])
                     {
                         HandleMsgQueueException(m.type);
                     }
-                    delete request;
+                    App::GetGameContext()->ReleaseActorLinkingRequest(request);
                     break;
                 }
 
@@ -1971,25 +1979,29 @@ int main(int argc, char *argv[])
                 }
 
             } // Game events block
-            OgreProfileEnd("RoR message queue");
+            ROR_PROFILE_END("RoR message queue");
+
+            // Pick up mods installed while the game runs
+            if (App::GetCacheSystem()->IsModCacheLoaded())
+            {
+                App::GetCacheSystem()->UpdateWatchedContent();
+            }
 
             // Check FPS limit
             if (App::gfx_fps_limit->getInt() > 0)
             {
-                OgreProfile("RoR FPS limiter");
+                ROR_PROFILE("RoR FPS limiter");
                 const float min_frame_time = 1.0f / Ogre::Math::Clamp(App::gfx_fps_limit->getInt(), 5, 240);
-                float dt = std::chrono::duration<float>(std::chrono::high_resolution_clock::now() - start_time).count();
-                while (dt < min_frame_time)
-                {
-                    dt = std::chrono::duration<float>(std::chrono::high_resolution_clock::now() - start_time).count();
-                }
+                const auto deadline = start_time + std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(std::chrono::duration<float>(min_frame_time));
+                App::GetAppContext()->GetFramePacer().WaitUntil(deadline);
             } // Check FPS limit block
 
-            OgreProfileBegin("RoR Main Loop");
+            ROR_PROFILE_BEGIN("RoR Main Loop");
             // Calculate delta time
             const auto now = std::chrono::high_resolution_clock::now();
             const float dt = std::chrono::duration<float>(now - start_time).count();
             start_time = now;
+            App::GetAppContext()->GetFramePacer().RecordFrameTime(dt);
 
 #ifdef USE_SOCKETW
             // Process incoming network traffic
@@ -2022,7 +2034,7 @@ int main(int argc, char *argv[])
             }
 
             // Process input events
-            OgreProfileBegin("Input processing");
+            ROR_PROFILE_BEGIN("Input processing");
             if (dt != 0.f)
             {
                 App::GetInputEngine()->Capture();
@@ -2094,12 +2106,12 @@ int main(int argc, char *argv[])
                     } // app state SIMULATION
                 } // interactive key binding mode
             } // dt != 0
-            OgreProfileEnd("Input processing");
+            ROR_PROFILE_END("Input processing");
 
             // Update OutGauge device
             if (App::io_outgauge_mode->getInt() > 0)
             {
-                OgreProfile("OutGauge");
+                ROR_PROFILE("OutGauge");
                 App::GetOutGauge()->Update(dt, App::GetGameContext()->GetPlayerActor());
             }
 
@@ -2107,7 +2119,7 @@ int main(int argc, char *argv[])
             App::GetGuiManager()->NewImGuiFrame(dt);
             if (App::app_state->getEnum<AppState>() == AppState::SIMULATION)
             {
-                OgreProfile("Scene and GUI");
+                ROR_PROFILE("Scene and GUI");
                 App::GetGuiManager()->DrawSimulationGui(dt);
                 for (ActorPtr& actor : App::GetGameContext()->GetActorManager()->GetActors())
                 {
@@ -2126,31 +2138,31 @@ int main(int argc, char *argv[])
 #ifdef USE_MUMBLE
             if (App::GetMumble())
             {
-                OgreProfile("Mumble");
+                ROR_PROFILE("Mumble");
                 App::GetMumble()->Update(); // 3d voice over network
             }
 #endif // USE_MUMBLE
 
 #ifdef USE_OPENAL
-            OgreProfileBegin("3D audio");
+            ROR_PROFILE_BEGIN("3D audio");
             App::GetSoundScriptManager()->update(dt); // update 3d audio listener position
-            OgreProfileEnd("3D audio");
+            ROR_PROFILE_END("3D audio");
 #endif // USE_OPENAL
 
 #ifdef USE_ANGELSCRIPT
-            OgreProfileBegin("Scripting");
+            ROR_PROFILE_BEGIN("Scripting");
             App::GetScriptEngine()->framestep(dt);
-            OgreProfileEnd("Scripting");
+            ROR_PROFILE_END("Scripting");
 #endif // USE_ANGELSCRIPT
 
             if (App::io_ffb_enabled->getBool() &&
                 App::sim_state->getEnum<SimState>() == SimState::RUNNING)
             {
-                OgreProfile("Force Feedback");
+                ROR_PROFILE("Force Feedback");
                 App::GetAppContext()->GetForceFeedback().Update();
             }
 
-            OgreProfileBegin("Simulation");
+            ROR_PROFILE_BEGIN("Simulation");
             if (App::sim_state->getEnum<SimState>() == SimState::RUNNING)
             {
                 App::GetGameContext()->GetSceneMouse().UpdateSimulation();
@@ -2180,10 +2192,10 @@ int main(int argc, char *argv[])
                 }
                 App::GetGameContext()->UpdateActors(); // *** Start new physics tasks. No reading from Actor N/B beyond this point.
             }
-            OgreProfileEnd("Simulation");
+            ROR_PROFILE_END("Simulation");
 
             // Scene and GUI updates
-            OgreProfileBegin("Scene and GUI"); // Adds up to existing profile
+            ROR_PROFILE_BEGIN("Scene and GUI"); // Adds up to existing profile
             if (App::app_state->getEnum<AppState>() == AppState::MAIN_MENU)
             {
                 App::GetGuiManager()->DrawMainMenuGui();
@@ -2192,9 +2204,9 @@ int main(int argc, char *argv[])
             {
                 App::GetGfxScene()->UpdateScene(dt_sim); // Draws GUI as well
             }
-            OgreProfileEnd("Scene and GUI");
+            ROR_PROFILE_END("Scene and GUI");
 
-            OgreProfileEnd("RoR Main Loop");
+            ROR_PROFILE_END("RoR Main Loop");
 
             // Render!
             Ogre::RenderWindow* render_window = RoR::App::GetAppContext()->GetRenderWindow();
@@ -33,6 +33,7 @@
 #include "Language.h"
 #include "RoRVersion.h"
 #include "ScriptEngine.h"
+#include "TraceRecorder.h"
 #include "Utils.h"
 
 #include <Ogre.h>
@@ -214,6 +215,7 @@ int Network::ReceiveMessage(RoRnet::Header *head, char* content, int bufferlen)
 void Network::SendThread()
 {
     LOG("[RoR|Networking] SendThread started");
+    TraceRecorder::SetThreadName("Network send");
     while (!m_shutdown)
     {
         NetSendPacket packet;
@@ -230,6 +232,7 @@ void Network::SendThread()
             packet = m_send_packet_buffer.front();
             m_send_packet_buffer.pop_front();
         }
+        ROR_TRACE_SCOPE("Send packet");
         SendMessageRaw(packet.buffer, packet.size);
     }
     LOG("[RoR|Networking] SendThread stopped");
@@ -238,6 +241,7 @@ void Network::SendThread()
 void Network::RecvThread()
 {
     LOG_THREAD("[RoR|Networking] RecvThread starting...");
+    TraceRecorder::SetThreadName("Network receive");
 
     RoRnet::Header header;
 
@@ -255,6 +259,8 @@ void Network::RecvThread()
             continue; // Stop receiving data
         }
 
+        ROR_TRACE_SCOPE("Process packet");
+
         if (header.command == MSG2_STREAM_REGISTER)
         {
             if (header.source == m_uid)
@@ -1192,14 +1192,34 @@ void Actor::calculateAveragePosition()
     }
 }
 
+void Actor::PublishSimSnapshot(uint32_t epoch)
+{
+    ActorSimSnapshot& snap = m_sim_snapshots.GetWriteBuffer();
+    snap.ass_nodes.FillFrom(ar_nodes, ar_num_nodes);
+    snap.ass_epoch = epoch;
+    m_sim_snapshots.Publish();
+}
+
 inline void PadBoundingBox(Ogre::AxisAlignedBox& box) // Internal helper
 {
     box.setMinimum(box.getMinimum() - BOUNDING_BOX_PADDING);
     box.setMaximum(box.getMaximum() + BOUNDING_BOX_PADDING);
 }
 
+const CoarseSphereTree& Actor::GetCoarseSphereTree()
+{
+    if (m_coarse_sphere_tree_dirty)
+    {
+        m_coarse_sphere_tree.Build(ar_nodes, ar_num_nodes, COARSE_SPHERE_TREE_CELL_SIZE);
+        m_coarse_sphere_tree_dirty = false;
+    }
+    return m_coarse_sphere_tree;
+}
+
 void Actor::UpdateBoundingBoxes()
 {
+    m_coarse_sphere_tree_dirty = true;
+
     // Reset
     ar_bounding_box = AxisAlignedBox::BOX_NULL;
     ar_predicted_bounding_box = AxisAlignedBox::BOX_NULL;
@@ -1292,6 +1312,8 @@ void Actor::updateInitPosition()
 
 void Actor::resetPosition(float px, float pz, bool setInitPosition, float miny)
 {
+    App::GetGameContext()->GetActorManager()->InvalidateLockTargets(); // Nodes were moved outside of physics step.
+
     // horizontal displacement
     Vector3 offset = Vector3(px, ar_nodes[0].AbsPosition.y, pz) - ar_nodes[0].AbsPosition;
     for (int i = 0; i < ar_num_nodes; i++)
@@ -1350,6 +1372,8 @@ void Actor::resetPosition(float px, float pz, bool setInitPosition, float miny)
 
 void Actor::resetPosition(Ogre::Vector3 translation, bool setInitPosition)
 {
+    App::GetGameContext()->GetActorManager()->InvalidateLockTargets(); // Nodes were moved outside of physics step.
+
     // total displacement
     if (translation != Vector3::ZERO)
     {
@@ -1656,6 +1680,8 @@ void Actor::SoftReset()
 
 void Actor::SyncReset(bool reset_position)
 {
+    App::GetGameContext()->GetActorManager()->InvalidateLockTargets(); // Nodes are moved outside of physics step.
+
     TRIGGER_EVENT_ASYNC(SE_TRUCK_RESET, ar_instance_id);
 
     m_reset_timer.reset();
@@ -1977,6 +2003,7 @@ void Actor::HandleInputEvents(float dt)
         m_rotation_request = 0.0f;
         this->UpdateBoundingBoxes();
         calculateAveragePosition();
+        App::GetGameContext()->GetActorManager()->InvalidateLockTargets();
     }
 
     if (m_translation_request != Vector3::ZERO)
@@ -1990,6 +2017,7 @@ void Actor::HandleInputEvents(float dt)
         m_translation_request = Vector3::ZERO;
         UpdateBoundingBoxes();
         calculateAveragePosition();
+        App::GetGameContext()->GetActorManager()->InvalidateLockTargets();
     }
 }
 
@@ -2800,11 +2828,11 @@ void Actor::CalcTriggers(int i, Real difftoBeamL, bool trigger_hooks)
                         {
                             //autolock hooktoggle unlock
                             //hookToggle(ar_beams[i].shock->trigger_cmdlong, HOOK_UNLOCK, NODENUM_INVALID);
-                            ActorLinkingRequest* rq = new ActorLinkingRequest();
+                            ActorLinkingRequest* rq = App::GetGameContext()->AcquireActorLinkingRequest();
                             rq->alr_type = ActorLinkingRequestType::HOOK_UNLOCK;
                             rq->alr_actor_instance_id = ar_instance_id;
                             rq->alr_hook_group = ar_beams[i].shock->trigger_cmdlong;
-                            App::GetGameContext()->PushMessage(Message(MSG_SIM_ACTOR_LINKING_REQUESTED, rq));
+                            App::GetGameContext()->PushSimMessage(MSG_SIM_ACTOR_LINKING_REQUESTED, rq);
                         }
                     }
                     else if (ar_beams[i].shock->flags & SHOCK_FLAG_TRG_HOOK_LOCK)
@@ -2813,11 +2841,11 @@ void Actor::CalcTriggers(int i, Real difftoBeamL, bool trigger_hooks)
                         {
                             //autolock hooktoggle lock
                             //hookToggle(ar_beams[i].shock->trigger_cmdlong, HOOK_LOCK, NODENUM_INVALID);
-                            ActorLinkingRequest* rq = new ActorLinkingRequest();
+                            ActorLinkingRequest* rq = App::GetGameContext()->AcquireActorLinkingRequest();
                             rq->alr_type = ActorLinkingRequestType::HOOK_LOCK;
                             rq->alr_actor_instance_id = ar_instance_id;
                             rq->alr_hook_group = ar_beams[i].shock->trigger_cmdlong;
-                            App::GetGameContext()->PushMessage(Message(MSG_SIM_ACTOR_LINKING_REQUESTED, rq));
+                            App::GetGameContext()->PushSimMessage(MSG_SIM_ACTOR_LINKING_REQUESTED, rq);
                         }
                     }
                     else if (ar_beams[i].shock->flags & SHOCK_FLAG_TRG_ENGINE)
@@ -2849,11 +2877,11 @@ void Actor::CalcTriggers(int i, Real difftoBeamL, bool trigger_hooks)
                         {
                             //autolock hooktoggle unlock
                             //hookToggle(ar_beams[i].shock->trigger_cmdshort, HOOK_UNLOCK, NODENUM_INVALID);
-                            ActorLinkingRequest* rq = new ActorLinkingRequest();
+                            ActorLinkingRequest* rq = App::GetGameContext()->AcquireActorLinkingRequest();
                             rq->alr_type = ActorLinkingRequestType::HOOK_UNLOCK;
                             rq->alr_actor_instance_id = ar_instance_id;
                             rq->alr_hook_group = ar_beams[i].shock->trigger_cmdshort;
-                            App::GetGameContext()->PushMessage(Message(MSG_SIM_ACTOR_LINKING_REQUESTED, rq));
+                            App::GetGameContext()->PushSimMessage(MSG_SIM_ACTOR_LINKING_REQUESTED, rq);
                         }
                     }
                     else if (ar_beams[i].shock->flags & SHOCK_FLAG_TRG_HOOK_LOCK)
@@ -2862,11 +2890,11 @@ void Actor::CalcTriggers(int i, Real difftoBeamL, bool trigger_hooks)
                         {
                             //autolock hooktoggle lock
                             //hookToggle(ar_beams[i].shock->trigger_cmdshort, HOOK_LOCK, NODENUM_INVALID);
-                            ActorLinkingRequest* rq = new ActorLinkingRequest();
+                            ActorLinkingRequest* rq = App::GetGameContext()->AcquireActorLinkingRequest();
                             rq->alr_type = ActorLinkingRequestType::HOOK_LOCK;
                             rq->alr_actor_instance_id = ar_instance_id;
                             rq->alr_hook_group = ar_beams[i].shock->trigger_cmdshort;
-                            App::GetGameContext()->PushMessage(Message(MSG_SIM_ACTOR_LINKING_REQUESTED, rq));
+                            App::GetGameContext()->PushSimMessage(MSG_SIM_ACTOR_LINKING_REQUESTED, rq);
                         }
                     }
                     else if (ar_beams[i].shock->flags & SHOCK_FLAG_TRG_ENGINE)
@@ -3587,12 +3615,24 @@ void Actor::DisjoinInterActorBeams()
     this->tieToggle(-1, ActorLinkingRequestType::TIE_RESET); // OK to be invoked here - DisjoinInterActorBeams() - `processing MSG_SIM_MODIFY/DELETE_ACTOR_REQUESTED`
 
     // Remove any possible links from other actors to this actor.
-    for (ActorPtr& other_actor : App::GetGameContext()->GetActorManager()->GetActors())
+    // Only actors which actually own a link to us need to be visited - look them up in the global linkage table.
+    ActorPtrVec linking_actors;
+    for (auto& entry : App::GetGameContext()->GetActorManager()->inter_actor_links)
+    {
+        const ActorPtr& owner = entry.second.first;
+        if (entry.second.second == this && owner != this
+            && std::find(linking_actors.begin(), linking_actors.end(), owner) == linking_actors.end())
+        {
+            linking_actors.push_back(owner);
+        }
+    }
+
+    for (ActorPtr& other_actor : linking_actors)
     {
         if (other_actor->ar_state != ActorState::LOCAL_SIMULATED)
             continue;
 
-        // Use the new `unlock_filter` param to only unlock the links to this actor (brute force but safe approach).
+        // Use the `unlock_filter` param to only unlock the links to this actor.
         other_actor->hookToggle(-1, ActorLinkingRequestType::HOOK_RESET, NODENUM_INVALID, /*unlock_filter:*/ar_instance_id); // OK to be invoked here - DisjoinInterActorBeams() - `processing MSG_SIM_MODIFY/DELETE_ACTOR_REQUESTED`
         other_actor->tieToggle(-1, ActorLinkingRequestType::TIE_RESET, /*unlock_filter:*/ar_instance_id); // OK to be invoked here - DisjoinInterActorBeams() - `processing MSG_SIM_MODIFY/DELETE_ACTOR_REQUESTED`
         other_actor->ropeToggle(-1, ActorLinkingRequestType::ROPE_RESET, /*unlock_filter:*/ar_instance_id); // OK to be invoked here - DisjoinInterActorBeams() - `processing MSG_SIM_MODIFY/DELETE_ACTOR_REQUESTED`
@@ -3657,25 +3697,25 @@ void Actor::tieToggle(int group, ActorLinkingRequestType mode, ActorInstanceID_t
                 node_t* nearest_node = 0;
                 ActorPtr nearest_actor = 0;
                 ropable_t* locktedto = 0;
-                // iterate over all actors
-                for (ActorPtr& actor : App::GetGameContext()->GetActorManager()->GetActors())
-                {
-                    if (actor->ar_state == ActorState::LOCAL_SLEEPING ||
-                        (actor == this && it->ti_no_self_lock))
+                // query ropables of all actors within range
+                App::GetGameContext()->GetActorManager()->GetRopablesHash().ForEachInRadius(it->ti_beam->p1->AbsPosition, mindist,
+                    [&](const NodeSpatialHash::Entry& entry)
                     {
-                        continue;
-                    }
+                        Actor* actor = entry.nsh_actor;
+                        if (actor->ar_state == ActorState::LOCAL_SLEEPING ||
+                            (actor == this && it->ti_no_self_lock))
+                        {
+                            return;
+                        }
 
-                    // and their ropables
-                    for (std::vector<ropable_t>::iterator itr = actor->ar_ropables.begin(); itr != actor->ar_ropables.end(); itr++)
-                    {
                         // if the ropable is not multilock and used, then discard this ropable
+                        ropable_t* itr = entry.nsh_ropable;
                         if (!itr->multilock && itr->attached_ties > 0)
-                            continue;
+                            return;
 
                         // skip if tienode is ropable too (no selflock)
-                        if (this == actor.GetRef() && itr->node->pos == it->ti_beam->p1->pos)
-                            continue;
+                        if (this == actor && itr->node->pos == it->ti_beam->p1->pos)
+                            return;
 
                         // calculate the distance and record the nearest ropable
                         float dist = (it->ti_beam->p1->AbsPosition - itr->node->AbsPosition).length();
@@ -3684,10 +3724,9 @@ void Actor::tieToggle(int group, ActorLinkingRequestType mode, ActorInstanceID_t
                             mindist = dist;
                             nearest_node = itr->node;
                             nearest_actor = actor;
-                            locktedto = &(*itr);
+                            locktedto = itr;
                         }
-                    }
-                }
+                    });
                 // if we found a ropable, then tie towards it
                 if (nearest_node)
                 {
@@ -3755,28 +3794,27 @@ void Actor::ropeToggle(int group, ActorLinkingRequestType mode, ActorInstanceID_
             float mindist = it->rp_beam->L;
             ActorPtr nearest_actor = nullptr;
             ropable_t* rop = 0;
-            // iterate over all actor_slots
-            for (ActorPtr& actor : App::GetGameContext()->GetActorManager()->GetActors())
-            {
-                if (actor->ar_state == ActorState::LOCAL_SLEEPING)
-                    continue;
-                // and their ropables
-                for (std::vector<ropable_t>::iterator itr = actor->ar_ropables.begin(); itr != actor->ar_ropables.end(); itr++)
+            // query ropables of all actors within range
+            App::GetGameContext()->GetActorManager()->GetRopablesHash().ForEachInRadius(it->rp_beam->p1->AbsPosition, mindist,
+                [&](const NodeSpatialHash::Entry& entry)
                 {
+                    if (entry.nsh_actor->ar_state == ActorState::LOCAL_SLEEPING)
+                        return;
+
                     // if the ropable is not multilock and used, then discard this ropable
+                    ropable_t* itr = entry.nsh_ropable;
                     if (!itr->multilock && itr->attached_ropes > 0)
-                        continue;
+                        return;
 
                     // calculate the distance and record the nearest ropable
                     float dist = (it->rp_beam->p1->AbsPosition - itr->node->AbsPosition).length();
                     if (dist < mindist)
                     {
                         mindist = dist;
-                        nearest_actor = actor;
-                        rop = &(*itr);
+                        nearest_actor = entry.nsh_actor;
+                        rop = itr;
                     }
-                }
-            }
+                });
             // if we found a ropable, then lock it
             if (nearest_actor)
             {
@@ -3857,56 +3895,54 @@ void Actor::hookToggle(int group, ActorLinkingRequestType mode, NodeNum_t mousen
             // search new remote ropable to lock to
             float mindist = it->hk_lockrange;
             float distance = 100000000.0f;
-            // iterate over all actor_slots
-            for (ActorPtr& actor : App::GetGameContext()->GetActorManager()->GetActors())
-            {
-                if (actor->ar_state == ActorState::LOCAL_SLEEPING)
-                    continue;
-                if (this == actor.GetRef() && !it->hk_selflock)
-                    continue; // don't lock to self
-
-                node_t* nearest_node = nullptr;
-                for (int i = 0; i < actor->ar_num_nodes; i++)
+            node_t* nearest_node = nullptr;
+            Actor* nearest_actor = nullptr;
+            // query lockable nodes of all actors within range
+            App::GetGameContext()->GetActorManager()->GetLockableNodesHash().ForEachInRadius(it->hk_hook_node->AbsPosition, mindist,
+                [&](const NodeSpatialHash::Entry& entry)
                 {
-                    // skip all nodes with lockgroup 9999 (deny lock)
-                    if (actor->ar_nodes[i].nd_lockgroup == 9999)
-                        continue;
+                    Actor* actor = entry.nsh_actor;
+                    if (actor->ar_state == ActorState::LOCAL_SLEEPING)
+                        return;
+                    if (this == actor && !it->hk_selflock)
+                        return; // don't lock to self
 
                     // exclude this truck and its current hooknode from the locking search
-                    if (this == actor.GetRef() && i == it->hk_hook_node->pos)
-                        continue;
+                    if (this == actor && entry.nsh_node->pos == it->hk_hook_node->pos)
+                        return;
 
                     // a lockgroup for this hooknode is set -> skip all nodes that do not have the same lockgroup (-1 = default(all nodes))
-                    if (it->hk_lockgroup != -1 && it->hk_lockgroup != actor->ar_nodes[i].nd_lockgroup)
-                        continue;
+                    if (it->hk_lockgroup != -1 && it->hk_lockgroup != entry.nsh_node->nd_lockgroup)
+                        return;
 
                     // measure distance
-                    float n2n_distance = (it->hk_hook_node->AbsPosition - actor->ar_nodes[i].AbsPosition).length();
+                    float n2n_distance = (it->hk_hook_node->AbsPosition - entry.nsh_node->AbsPosition).length();
                     if (n2n_distance < mindist)
                     {
                         if (distance >= n2n_distance)
                         {
                             // located a node that is closer
                             distance = n2n_distance;
-                            nearest_node = &actor->ar_nodes[i];
+                            nearest_node = entry.nsh_node;
+                            nearest_actor = actor;
                         }
                     }
-                }
-                if (nearest_node)
+                });
+
+            if (nearest_node)
+            {
+                // we found a node, lock to it
+                it->hk_lock_node = nearest_node;
+                it->hk_locked_actor = nearest_actor;
+                it->hk_locked = PRELOCK;
+                //enable beam if not enabled yet between those 2 nodes
+                if (it->hk_beam->bm_disabled)
                 {
-                    // we found a node, lock to it
-                    it->hk_lock_node = nearest_node;
-                    it->hk_locked_actor = actor;
-                    it->hk_locked = PRELOCK;
-                    //enable beam if not enabled yet between those 2 nodes
-                    if (it->hk_beam->bm_disabled)
-                    {
-                        it->hk_beam->p2 = it->hk_lock_node;
-                        it->hk_beam->bm_inter_actor = (it->hk_locked_actor != nullptr);
-                        it->hk_beam->L = (it->hk_hook_node->AbsPosition - it->hk_lock_node->AbsPosition).length();
-                        it->hk_beam->bm_disabled = false;
-                        this->AddInterActorBeam(it->hk_beam, it->hk_locked_actor, mode); // OK to invoke here - hookToggle() - processing `MSG_SIM_ACTOR_LINKING_REQUESTED`
-                    }
+                    it->hk_beam->p2 = it->hk_lock_node;
+                    it->hk_beam->bm_inter_actor = (it->hk_locked_actor != nullptr);
+                    it->hk_beam->L = (it->hk_hook_node->AbsPosition - it->hk_lock_node->AbsPosition).length();
+                    it->hk_beam->bm_disabled = false;
+                    this->AddInterActorBeam(it->hk_beam, it->hk_locked_actor, mode); // OK to invoke here - hookToggle() - processing `MSG_SIM_ACTOR_LINKING_REQUESTED`
                 }
             }
         }
@@ -25,11 +25,14 @@
 #include "Application.h"
 #include "AutoPilot.h"
 #include "CmdKeyInertia.h"
+#include "CoarseSphereTree.h"
+#include "Collisions.h"
 #include "DashBoardManager.h"
 #include "Differentials.h"
 #include "Engine.h"
 #include "GfxActor.h"
 #include "PerVehicleCameraContext.h"
+#include "PhysicsProfiler.h"
 #include "RigDef_Prerequisites.h"
 #include "RoRnet.h"
 #include "RefCountingObject.h"
@@ -321,6 +324,10 @@ public:
     void              NotifyActorCameraChanged();                 //!< Logic: sound, display; Notify this vehicle that camera changed;
     float             getAvgPropedWheelRadius() { return m_avg_proped_wheel_radius; };
     void              UpdateBoundingBoxes();
+    const CoarseSphereTree& GetCoarseSphereTree();        //!< Leaf spheres around node clusters; rebuilt on demand after physics moved the nodes. Main thread only.
+    PhysicsPhaseTimes& GetPhaseTimes()                   { return m_phase_times; } //!< Accumulated by the simulating thread; drained by `PhysicsProfiler::Harvest()`.
+    void              PublishSimSnapshot(uint32_t epoch);   //!< Sim thread; copies node state for `GfxActor`.
+    ActorSimSnapshotBuffer& GetSimSnapshots()            { return m_sim_snapshots; }
     void              calculateAveragePosition();
     void              UpdatePhysicsOrigin();
     void              SoftReset();
@@ -514,7 +521,9 @@ public:
     float             ar_collision_range = DEFAULT_COLLISION_RANGE;             //!< Physics attr
     float             ar_top_speed = 0.f;                   //!< Sim state
     ground_model_t*   ar_last_fuzzy_ground_model = nullptr;     //!< GUI state
-    CollisionBoxPtrVec m_potential_eventboxes;
+    CollisionBoxPtrVec m_potential_eventboxes;         //!< Cached; refreshed when `ar_evboxes_bounding_box` crosses a cell boundary
+    Collisions::CellRange m_potential_eventboxes_cells;
+    int               m_potential_eventboxes_revision = -1; //!< See `Collisions::GetCollisionBoxesRevision()`
     std::vector<std::pair<collision_box_t*, NodeNum_t>> m_active_eventboxes;
     std::unique_ptr<Buoyance> m_buoyance;
 
@@ -657,6 +666,10 @@ private:
     float             m_avionic_chatter_timer = 11.f;      //!< Sound fx state (some pseudo random number,  doesn't matter)
     PointColDetector* m_inter_point_col_detector = nullptr;   //!< Physics
     PointColDetector* m_intra_point_col_detector = nullptr;   //!< Physics
+    CoarseSphereTree  m_coarse_sphere_tree;                   //!< Gameplay (AI obstacle avoidance)
+    bool              m_coarse_sphere_tree_dirty = true;      //!< Set by `UpdateBoundingBoxes()`
+    PhysicsPhaseTimes m_phase_times;                          //!< Diagnostic; filled only while `PhysicsProfiler` is enabled
+    ActorSimSnapshotBuffer m_sim_snapshots;                   //!< Gfx state; written by sim thread, read by main thread
     
     Ogre::Vector3     m_avg_node_position = Ogre::Vector3::ZERO;          //!< average node position
     Ogre::Real        m_min_camera_radius = 0.f;
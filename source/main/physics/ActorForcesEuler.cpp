@@ -45,25 +45,46 @@ using namespace RoR;
 
 void Actor::CalcForcesEulerCompute(bool doUpdate, int num_steps)
 {
+    PhysicsPhaseTimer timer(PhysicsProfiler::IsEnabled() ? &m_phase_times : nullptr);
+
     this->CalcNodes(); // must be done directly after the inter truck collisions are handled
+    timer.Lap(PHYSICSPHASE_NODES);
     this->UpdateBoundingBoxes();
+    timer.Lap(PHYSICSPHASE_BOUNDING_BOXES);
     this->CalcEventBoxes();
+    timer.Lap(PHYSICSPHASE_EVENTBOXES);
     this->CalcReplay();
+    timer.Lap(PHYSICSPHASE_REPLAY);
     this->CalcAircraftForces(doUpdate);
+    timer.Lap(PHYSICSPHASE_AIRCRAFT);
     this->CalcFuseDrag();
+    timer.Lap(PHYSICSPHASE_FUSEDRAG);
     this->CalcBuoyance(doUpdate);
+    timer.Lap(PHYSICSPHASE_BUOYANCE);
     this->CalcDifferentials();
+    timer.Lap(PHYSICSPHASE_DIFFERENTIALS);
     this->CalcWheels(doUpdate, num_steps);
+    timer.Lap(PHYSICSPHASE_WHEELS);
     this->CalcShocks(doUpdate, num_steps);
+    timer.Lap(PHYSICSPHASE_SHOCKS);
     this->CalcHydros();
+    timer.Lap(PHYSICSPHASE_HYDROS);
     this->CalcCommands(doUpdate);
+    timer.Lap(PHYSICSPHASE_COMMANDS);
     this->CalcTies();
+    timer.Lap(PHYSICSPHASE_TIES);
     this->CalcTruckEngine(doUpdate); // must be done after the commands / engine triggers are updated
+    timer.Lap(PHYSICSPHASE_ENGINE);
     this->CalcMouse();
+    timer.Lap(PHYSICSPHASE_MOUSE);
     this->CalcBeams(doUpdate);
+    timer.Lap(PHYSICSPHASE_BEAMS);
     this->CalcCabCollisions();
+    timer.Lap(PHYSICSPHASE_CAB_COLLISIONS);
     this->updateSlideNodeForces(PHYSICS_DT); // must be done after the contacters are updated
+    timer.Lap(PHYSICSPHASE_SLIDENODES);
     this->CalcForceFeedback(doUpdate);
+    timer.Lap(PHYSICSPHASE_FORCEFEEDBACK);
 }
 
 void Actor::CalcForceFeedback(bool doUpdate)
@@ -1178,11 +1199,11 @@ bool Actor::CalcForcesEulerPrepare(bool doUpdate)
     if (doUpdate)
     {
         //this->hookToggle(-2, HOOK_LOCK, -1);
-        ActorLinkingRequest* rq = new ActorLinkingRequest();
+        ActorLinkingRequest* rq = App::GetGameContext()->AcquireActorLinkingRequest();
         rq->alr_type = ActorLinkingRequestType::HOOK_LOCK;
         rq->alr_actor_instance_id = ar_instance_id;
         rq->alr_hook_group = -2;
-        App::GetGameContext()->PushMessage(Message(MSG_SIM_ACTOR_LINKING_REQUESTED, rq));
+        App::GetGameContext()->PushSimMessage(MSG_SIM_ACTOR_LINKING_REQUESTED, rq);
     }
 
     this->CalcHooks();
@@ -1649,10 +1670,10 @@ void Actor::CalcNodes()
         // anti-explsion guard (mach 20)
         if (approx_speed > 6860 && !m_ongoing_reset)
         {
-            ActorModifyRequest* rq = new ActorModifyRequest; // actor exploded, schedule reset
+            ActorModifyRequest* rq = App::GetGameContext()->AcquireActorModifyRequest(); // actor exploded, schedule reset
             rq->amr_actor = this->ar_instance_id;
             rq->amr_type = ActorModifyRequest::Type::RESET_ON_SPOT;
-            App::GetGameContext()->PushMessage(Message(MSG_SIM_MODIFY_ACTOR_REQUESTED, (void*)rq));
+            App::GetGameContext()->PushSimMessage(MSG_SIM_MODIFY_ACTOR_REQUESTED, (void*)rq);
             m_ongoing_reset = true;
         }
 
@@ -1705,17 +1726,60 @@ bool TestNodeEventBoxCollision(const node_t& node, collision_box_t* cbox)
         && (cbox->event_filter != EVENT_TRUCK_WHEELS || node.nd_tyre_node);
 }
 
+NodeNum_t FindNodeInsideEventBox(const node_t* nodes, int num_nodes, collision_box_t* cbox)
+{
+    // Returns the lowest node number colliding with the eventbox, or NODENUM_INVALID.
+    // Nodes are processed in blocks: first a branchless axis-aligned pre-test over the whole block
+    // (no early exits, so the compiler can vectorize it), then the exact test only for candidates.
+    // -----------------------------------------------------------------------------------------
+
+    const int BLOCK_SIZE = 64;
+    const float lo_x = cbox->lo.x, lo_y = cbox->lo.y, lo_z = cbox->lo.z;
+    const float hi_x = cbox->hi.x, hi_y = cbox->hi.y, hi_z = cbox->hi.z;
+    uint8_t candidates[BLOCK_SIZE];
+
+    for (int base = 0; base < num_nodes; base += BLOCK_SIZE)
+    {
+        const int count = std::min(BLOCK_SIZE, num_nodes - base);
+        int num_candidates = 0;
+        for (int j = 0; j < count; j++)
+        {
+            const Vector3& pos = nodes[base + j].AbsPosition;
+            candidates[j] = (pos.x > lo_x) & (pos.x < hi_x) & (pos.y > lo_y) & (pos.y < hi_y) & (pos.z > lo_z) & (pos.z < hi_z);
+            num_candidates += candidates[j];
+        }
+
+        if (num_candidates == 0)
+            continue;
+
+        for (int j = 0; j < count; j++)
+        {
+            if (candidates[j] && TestNodeEventBoxCollision(nodes[base + j], cbox))
+                return static_cast<NodeNum_t>(base + j);
+        }
+    }
+    return NODENUM_INVALID;
+}
+
 void Actor::CalcEventBoxes()
 {
     // Assumption: node positions and bounding boxes are up to date.
     // First, find all collision boxes which this actor's bounding box touches (potential collisions)
+    //   - the list is cached and only refreshed when the bounding box crosses a cell boundary.
     // For each potential collision box:
     // * if a collision was already recorded, test the recorded node. If still colliding, do nothing.
     // * otherwise loop nodes until collision is found. If not, clear the collision record.
     // ----------------------------------------------------------------------------------------------
 
-    m_potential_eventboxes.clear();
-    App::GetGameContext()->GetTerrain()->GetCollisions()->findPotentialEventBoxes(this, m_potential_eventboxes);
+    Collisions* collisions = App::GetGameContext()->GetTerrain()->GetCollisions();
+    const Collisions::CellRange cells = collisions->GetCellRange(ar_evboxes_bounding_box);
+    if (cells != m_potential_eventboxes_cells || collisions->GetCollisionBoxesRevision() != m_potential_eventboxes_revision)
+    {
+        m_potential_eventboxes.clear();
+        collisions->findPotentialEventBoxes(this, m_potential_eventboxes);
+        m_potential_eventboxes_cells = cells;
+        m_potential_eventboxes_revision = collisions->GetCollisionBoxesRevision();
+    }
 
     for (collision_box_t* cbox : m_potential_eventboxes)
     {
@@ -1746,31 +1810,28 @@ void Actor::CalcEventBoxes()
             }
         }
 
-        if (!has_collision)
+        // Find if any node collides - skip if the box is entirely outside of the actor's bounding box.
+        if (!has_collision && ar_bounding_box.intersects(AxisAlignedBox(cbox->lo, cbox->hi)))
         {
-            // Find if any node collides
-            for (NodeNum_t i = 0; i < ar_num_nodes; i++)
+            const NodeNum_t i = FindNodeInsideEventBox(ar_nodes, ar_num_nodes, cbox);
+            has_collision = (i != NODENUM_INVALID);
+            if (has_collision)
             {
-                has_collision = TestNodeEventBoxCollision(ar_nodes[i], cbox);
-                if (has_collision)
+                do_callback_exit = false;
+                // Add new collision record
+                m_active_eventboxes.push_back(std::make_pair(cbox, i));
+                // Do the script callback
+                if (do_callback_enter)
                 {
-                    do_callback_exit = false;
-                    // Add new collision record
-                    m_active_eventboxes.push_back(std::make_pair(cbox, i));
-                    // Do the script callback
-                    if (do_callback_enter)
-                    {
-                        // IMPORTANT - this function is executed under physics thread pool, do not run script callbacks synchronously!
-                        eventsource_t& eventsource = App::GetGameContext()->GetTerrain()->GetCollisions()->getEventSource(cbox->eventsourcenum);
+                    // IMPORTANT - this function is executed under physics thread pool, do not run script callbacks synchronously!
+                    eventsource_t& eventsource = collisions->getEventSource(cbox->eventsourcenum);
 
-                        // The classic optional per-object script handler.
-                        ScriptCallbackArgs* args = new ScriptCallbackArgs( &eventsource, i );
-                        App::GetGameContext()->PushMessage(Message(MSG_SIM_SCRIPT_CALLBACK_QUEUED, (void*)args));
+                    // The classic optional per-object script handler.
+                    ScriptCallbackArgs* args = new ScriptCallbackArgs( &eventsource, i );
+                    App::GetGameContext()->PushSimMessage(MSG_SIM_SCRIPT_CALLBACK_QUEUED, (void*)args);
 
-                        // The new EVENTBOX_ENTER event.
-                        TRIGGER_EVENT_ASYNC(SE_EVENTBOX_ENTER, 0, ar_instance_id, ar_nodes[i].pos, 0, eventsource.es_instance_name, eventsource.es_box_name, "", "");
-                    }
-                    break;
+                    // The new EVENTBOX_ENTER event.
+                    TRIGGER_EVENT_ASYNC(SE_EVENTBOX_ENTER, 0, ar_instance_id, ar_nodes[i].pos, 0, eventsource.es_instance_name, eventsource.es_box_name, "", "");
                 }
             }
         }
@@ -1824,10 +1885,10 @@ void Actor::CalcHooks()
                         else
                         {
                             //force exceeded, reset the hook node
-                            ActorLinkingRequest* rq = new ActorLinkingRequest();
+                            ActorLinkingRequest* rq = App::GetGameContext()->AcquireActorLinkingRequest();
                             rq->alr_actor_instance_id = ar_instance_id;
                             rq->alr_type = ActorLinkingRequestType::HOOK_UNLOCK;
-                            App::GetGameContext()->PushMessage(Message(MSG_SIM_ACTOR_LINKING_REQUESTED, rq));
+                            App::GetGameContext()->PushSimMessage(MSG_SIM_ACTOR_LINKING_REQUESTED, rq);
                         }
                     }
                 }
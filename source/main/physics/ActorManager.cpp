@@ -26,6 +26,7 @@
 #include "ActorManager.h"
 
 #include "Actor.h"
+#include "AllocationCounter.h"
 #include "Application.h"
 #include "ApproxMath.h"
 #include "Buoyance.h"
@@ -46,7 +47,9 @@
 #include "MovableText.h"
 #include "Network.h"
 #include "PointColDetector.h"
+#include "PlatformUtils.h"
 #include "Replay.h"
+#include "RigDef_BinarySerializer.h"
 #include "RigDef_Validator.h"
 #include "RigDef_Serializer.h"
 #include "ActorSpawner.h"
@@ -54,6 +57,7 @@
 #include "SoundScriptManager.h"
 #include "Terrain.h"
 #include "ThreadPool.h"
+#include "TraceRecorder.h"
 #include "TuneupFileFormat.h"
 #include "Utils.h"
 #include "VehicleAI.h"
@@ -344,6 +348,7 @@ ActorPtr ActorManager::CreateNewActor(ActorSpawnRequest rq, RigDef::DocumentPtr
     }
 
     m_actors.push_back(ActorPtr(actor));
+    m_lock_targets_dirty = true;
 
     return actor;
 }
@@ -776,21 +781,21 @@ void ActorManager::ForwardCommands(ActorPtr source_actor)
                 if (source_actor->ar_toggle_ties)
                 {
                     //actor->tieToggle();
-                    ActorLinkingRequest* rq = new ActorLinkingRequest();
+                    ActorLinkingRequest* rq = App::GetGameContext()->AcquireActorLinkingRequest();
                     rq->alr_type = ActorLinkingRequestType::TIE_TOGGLE;
                     rq->alr_actor_instance_id = actor->ar_instance_id;
                     rq->alr_tie_group = -1;
-                    App::GetGameContext()->PushMessage(Message(MSG_SIM_ACTOR_LINKING_REQUESTED, rq));
+                    App::GetGameContext()->PushSimMessage(MSG_SIM_ACTOR_LINKING_REQUESTED, rq);
 
                 }
                 if (source_actor->ar_toggle_ropes)
                 {
                     //actor->ropeToggle(-1);
-                    ActorLinkingRequest* rq = new ActorLinkingRequest();
+                    ActorLinkingRequest* rq = App::GetGameContext()->AcquireActorLinkingRequest();
                     rq->alr_type = ActorLinkingRequestType::ROPE_TOGGLE;
                     rq->alr_actor_instance_id = actor->ar_instance_id;
                     rq->alr_rope_group = -1;
-                    App::GetGameContext()->PushMessage(Message(MSG_SIM_ACTOR_LINKING_REQUESTED, rq));
+                    App::GetGameContext()->PushSimMessage(MSG_SIM_ACTOR_LINKING_REQUESTED, rq);
                 }
             }
         }
@@ -827,6 +832,47 @@ bool ActorManager::AreActorsDirectlyLinked(const ActorPtr& a1, const ActorPtr& a
     return false;
 }
 
+const NodeSpatialHash& ActorManager::GetLockableNodesHash()
+{
+    if (m_lock_targets_dirty)
+        this->RebuildLockTargets();
+    return m_lockable_nodes_hash;
+}
+
+const NodeSpatialHash& ActorManager::GetRopablesHash()
+{
+    if (m_lock_targets_dirty)
+        this->RebuildLockTargets();
+    return m_ropables_hash;
+}
+
+void ActorManager::RebuildLockTargets()
+{
+    // Lazy: frames without any hook/tie/rope request don't pay for this.
+    // Actor state (sleeping, selflock...) is checked by the caller at query time.
+    // ------------------------------------------------------------------------
+
+    this->SyncWithSimThread(); // Node positions must be stable.
+
+    m_lockable_nodes_hash.Clear();
+    m_ropables_hash.Clear();
+    for (ActorPtr& actor : m_actors)
+    {
+        for (int i = 0; i < actor->ar_num_nodes; i++)
+        {
+            if (actor->ar_nodes[i].nd_lockgroup != 9999) // 9999 = deny lock
+                m_lockable_nodes_hash.AddEntry(actor.GetRef(), &actor->ar_nodes[i]);
+        }
+        for (ropable_t& ropable : actor->ar_ropables)
+        {
+            m_ropables_hash.AddEntry(actor.GetRef(), ropable.node, &ropable);
+        }
+    }
+    m_lockable_nodes_hash.Build();
+    m_ropables_hash.Build();
+    m_lock_targets_dirty = false;
+}
+
 void ActorManager::UpdateSleepingState(ActorPtr player_actor, float dt)
 {
     if (!m_forced_awake)
@@ -1005,6 +1051,7 @@ void ActorManager::DeleteActorInternal(ActorPtr actor)
     actor->dispose();
 
     EraseIf(m_actors, [actor](ActorPtr& curActor) { return actor == curActor; });
+    m_lock_targets_dirty = true;
 
     // Upate actor indices
     for (unsigned int i = 0; i < m_actors.size(); i++)
@@ -1179,22 +1226,22 @@ void ActorManager::UpdateActors(ActorPtr player_actor)
         if (player_actor->ar_toggle_ties)
         {
             //player_actor->tieToggle();
-            ActorLinkingRequest* rq = new ActorLinkingRequest();
+            ActorLinkingRequest* rq = App::GetGameContext()->AcquireActorLinkingRequest();
             rq->alr_type = ActorLinkingRequestType::TIE_TOGGLE;
             rq->alr_actor_instance_id = player_actor->ar_instance_id;
             rq->alr_tie_group = -1;
-            App::GetGameContext()->PushMessage(Message(MSG_SIM_ACTOR_LINKING_REQUESTED, rq));
+            App::GetGameContext()->PushSimMessage(MSG_SIM_ACTOR_LINKING_REQUESTED, rq);
 
             player_actor->ar_toggle_ties = false;
         }
         if (player_actor->ar_toggle_ropes)
         {
             //player_actor->ropeToggle(-1);
-            ActorLinkingRequest* rq = new ActorLinkingRequest();
+            ActorLinkingRequest* rq = App::GetGameContext()->AcquireActorLinkingRequest();
             rq->alr_type = ActorLinkingRequestType::ROPE_TOGGLE;
             rq->alr_actor_instance_id = player_actor->ar_instance_id;
             rq->alr_rope_group = -1;
-            App::GetGameContext()->PushMessage(Message(MSG_SIM_ACTOR_LINKING_REQUESTED, rq));
+            App::GetGameContext()->PushSimMessage(MSG_SIM_ACTOR_LINKING_REQUESTED, rq);
 
             player_actor->ar_toggle_ropes = false;
         }
@@ -1209,9 +1256,13 @@ void ActorManager::UpdateActors(ActorPtr player_actor)
 
     auto func = std::function<void()>([this]()
         {
+            TraceRecorder::SetThreadName("Simulation");
+            ROR_TRACE_SCOPE("Physics simulation");
             this->UpdatePhysicsSimulation();
         });
     m_sim_task = m_sim_thread_pool->RunTask(func);
+    m_lock_targets_dirty = true; // Nodes are moving again.
+    m_physics_profiler_pending = true;
 
     m_total_sim_time += dt;
 
@@ -1233,88 +1284,128 @@ const ActorPtr& ActorManager::GetActorById(ActorInstanceID_t actor_id)
 
 void ActorManager::UpdatePhysicsSimulation()
 {
-    for (ActorPtr& actor: m_actors)
-    {
-        actor->UpdatePhysicsOrigin();
-    }
-    for (int i = 0; i < m_physics_steps; i++)
+    const size_t allocs_start = AllocationCounter::GetTotal();
     {
+        AllocationCounter::Scope alloc_scope;
+
+        for (ActorPtr& actor: m_actors)
         {
-            std::vector<std::function<void()>> tasks;
-            for (ActorPtr& actor: m_actors)
+            actor->UpdatePhysicsOrigin();
+        }
+
+        // Reused every substep - no task lists or functors are allocated on the hot path.
+        auto compute_func = [this](int item)
+            {
+                AllocationCounter::Scope alloc_scope;
+                ROR_TRACE_SCOPE("Actor forces");
+                m_physics_batch_actors[item]->CalcForcesEulerCompute(m_physics_batch_first_step, m_physics_steps);
+            };
+        auto intercollision_func = [this](int item)
             {
-                if (actor->ar_update_physics = actor->CalcForcesEulerPrepare(i == 0))
+                AllocationCounter::Scope alloc_scope;
+                ROR_TRACE_SCOPE("Inter-actor collisions");
+                Actor* actor = m_physics_batch_actors[item];
+                PhysicsPhaseTimer timer(PhysicsProfiler::IsEnabled() ? &actor->m_phase_times : nullptr);
+                actor->m_inter_point_col_detector->UpdateInterPoint();
+                if (actor->ar_collision_relevant)
                 {
-                    auto func = std::function<void()>([this, i, &actor]()
-                        {
-                            actor->CalcForcesEulerCompute(i == 0, m_physics_steps);
-                        });
-                    tasks.push_back(func);
+                    ResolveInterActorCollisions(PHYSICS_DT,
+                       *actor->m_inter_point_col_detector,
+                        actor->ar_num_collcabs,
+                        actor->ar_collcabs,
+                        actor->ar_cabs,
+                        actor->ar_inter_collcabrate,
+                        actor->ar_nodes,
+                        actor->ar_collision_range,
+                       *actor->ar_submesh_ground_model);
+                }
+                timer.Lap(PHYSICSPHASE_INTER_COLLISIONS);
+            };
+
+        for (int i = 0; i < m_physics_steps; i++)
+        {
+            {
+                m_physics_batch_actors.clear();
+                m_physics_batch_first_step = (i == 0);
+                for (ActorPtr& actor: m_actors)
+                {
+                    if (actor->ar_update_physics = actor->CalcForcesEulerPrepare(i == 0))
+                    {
+                        m_physics_batch_actors.push_back(actor.GetRef());
+                    }
+                }
+                App::GetThreadPool()->ParallelFor(m_physics_batch, static_cast<int>(m_physics_batch_actors.size()), compute_func);
+                for (ActorPtr& actor: m_actors)
+                {
+                    if (actor->ar_update_physics)
+                    {
+                        PhysicsPhaseTimer timer(PhysicsProfiler::IsEnabled() ? &actor->m_phase_times : nullptr);
+                        actor->CalcBeamsInterActor();
+                        timer.Lap(PHYSICSPHASE_BEAMS_INTERACTOR);
+                    }
                 }
             }
-            App::GetThreadPool()->Parallelize(tasks);
-            for (ActorPtr& actor: m_actors)
             {
-                if (actor->ar_update_physics)
+                m_physics_batch_actors.clear();
+                for (ActorPtr& actor: m_actors)
                 {
-                    actor->CalcBeamsInterActor();
+                    if (actor->m_inter_point_col_detector != nullptr && (actor->ar_update_physics ||
+                            (App::mp_pseudo_collisions->getBool() && actor->ar_state == ActorState::NETWORKED_OK)))
+                    {
+                        m_physics_batch_actors.push_back(actor.GetRef());
+                    }
                 }
+                App::GetThreadPool()->ParallelFor(m_physics_batch, static_cast<int>(m_physics_batch_actors.size()), intercollision_func);
             }
+
+            // Apply FreeForces - intentionally as a separate pass over all actors
+            this->CalcFreeForces();
         }
+        for (ActorPtr& actor: m_actors)
         {
-            std::vector<std::function<void()>> tasks;
-            for (ActorPtr& actor: m_actors)
+            actor->m_ongoing_reset = false;
+            if (actor->ar_update_physics && m_physics_steps > 0)
             {
-                if (actor->m_inter_point_col_detector != nullptr && (actor->ar_update_physics ||
-                        (App::mp_pseudo_collisions->getBool() && actor->ar_state == ActorState::NETWORKED_OK)))
-                {
-                    auto func = std::function<void()>([this, &actor]()
-                        {
-                            actor->m_inter_point_col_detector->UpdateInterPoint();
-                            if (actor->ar_collision_relevant)
-                            {
-                                ResolveInterActorCollisions(PHYSICS_DT,
-                                   *actor->m_inter_point_col_detector,
-                                    actor->ar_num_collcabs,
-                                    actor->ar_collcabs,
-                                    actor->ar_cabs,
-                                    actor->ar_inter_collcabrate,
-                                    actor->ar_nodes,
-                                    actor->ar_collision_range,
-                                   *actor->ar_submesh_ground_model);
-                            }
-                        });
-                    tasks.push_back(func);
-                }
+                Vector3  camera_gforces = actor->m_camera_gforces_accu / m_physics_steps;
+                actor->m_camera_gforces_accu = Vector3::ZERO;
+                actor->m_camera_gforces = actor->m_camera_gforces * 0.5f + camera_gforces * 0.5f;
+                actor->calculateLocalGForces();
+                actor->calculateAveragePosition();
+                actor->m_avg_node_velocity  = actor->m_avg_node_position - actor->m_avg_node_position_prev;
+                actor->m_avg_node_velocity /= (m_physics_steps * PHYSICS_DT);
+                actor->m_avg_node_position_prev = actor->m_avg_node_position;
+                actor->ar_top_speed = std::max(actor->ar_top_speed, actor->ar_nodes[0].Velocity.length());
             }
-            App::GetThreadPool()->Parallelize(tasks);
         }
 
-        // Apply FreeForces - intentionally as a separate pass over all actors
-        this->CalcFreeForces();
-    }
-    for (ActorPtr& actor: m_actors)
-    {
-        actor->m_ongoing_reset = false;
-        if (actor->ar_update_physics && m_physics_steps > 0)
+        // Hand node state over to gfx while rendering runs in parallel, see `ActorSimSnapshot`.
+        m_physics_batch_actors.clear();
+        for (ActorPtr& actor: m_actors)
         {
-            Vector3  camera_gforces = actor->m_camera_gforces_accu / m_physics_steps;
-            actor->m_camera_gforces_accu = Vector3::ZERO;
-            actor->m_camera_gforces = actor->m_camera_gforces * 0.5f + camera_gforces * 0.5f;
-            actor->calculateLocalGForces();
-            actor->calculateAveragePosition();
-            actor->m_avg_node_velocity  = actor->m_avg_node_position - actor->m_avg_node_position_prev;
-            actor->m_avg_node_velocity /= (m_physics_steps * PHYSICS_DT);
-            actor->m_avg_node_position_prev = actor->m_avg_node_position;
-            actor->ar_top_speed = std::max(actor->ar_top_speed, actor->ar_nodes[0].Velocity.length());
+            if (actor->ar_state < ActorState::LOCAL_SLEEPING)
+            {
+                m_physics_batch_actors.push_back(actor.GetRef());
+            }
         }
+        auto snapshot_func = [this](int item)
+            {
+                ROR_TRACE_SCOPE("Publish sim snapshot");
+                m_physics_batch_actors[item]->PublishSimSnapshot(m_sim_snapshot_epoch);
+            };
+        App::GetThreadPool()->ParallelFor(m_physics_batch, static_cast<int>(m_physics_batch_actors.size()), snapshot_func);
     }
+    m_physics_allocations = AllocationCounter::GetTotal() - allocs_start;
 }
 
 void ActorManager::SyncWithSimThread()
 {
     if (m_sim_task)
         m_sim_task->join();
+
+    // Harvest once per sim step; syncing again without new data would decay the smoothed figures.
+    if (PhysicsProfiler::IsEnabled() && m_physics_profiler_pending)
+        m_physics_profiler.Harvest(m_actors);
+    m_physics_profiler_pending = false;
 }
 
 void HandleErrorLoadingFile(std::string type, std::string filename, std::string exception_msg)
@@ -1357,6 +1448,30 @@ RigDef::DocumentPtr ActorManager::FetchActorDef(RoR::ActorSpawnRequest& rq)
             return nullptr;
         }
 
+        // Try the precompiled '.truckc' first - valid as long as the source file is unchanged.
+        RigDef::BinarySourceStamp stamp;
+        stamp.bss_filename = rq.asr_cache_entry->fname;
+        if (rq.asr_cache_entry->resource_bundle_type == "Zip")
+        {
+            stamp.bss_filetime = RoR::GetFileLastModifiedTime(rq.asr_cache_entry->resource_bundle_path);
+        }
+        else
+        {
+            stamp.bss_filetime = RoR::GetFileLastModifiedTime(PathCombine(rq.asr_cache_entry->resource_bundle_path, rq.asr_cache_entry->fname));
+        }
+        stamp.bss_filesize = stream->size();
+        const std::string bundle_key = rq.asr_cache_entry->resource_bundle_path + "|" + rq.asr_cache_entry->fname;
+        const std::string truckc_path = PathCombine(App::sys_cache_dir->getStr(),
+            HashData(bundle_key.c_str(), static_cast<int>(bundle_key.length())) + ".truckc");
+
+        RigDef::DocumentPtr cached_def = RigDef::BinarySerializer::LoadFile(stamp, truckc_path);
+        if (cached_def)
+        {
+            RoR::LogFormat("[RoR] Loaded precompiled truckfile '%s'", rq.asr_cache_entry->fname.c_str());
+            rq.asr_cache_entry->actor_def = cached_def;
+            return cached_def;
+        }
+
         RoR::LogFormat("[RoR] Parsing truckfile '%s'", rq.asr_cache_entry->fname.c_str());
         RigDef::Parser parser;
         parser.Prepare();
@@ -1389,6 +1504,16 @@ RigDef::DocumentPtr ActorManager::FetchActorDef(RoR::ActorSpawnRequest& rq)
 
         def->hash = Sha1Hash(stream->getAsString());
 
+        // Store the validated definition for the next session
+        if (App::diag_truckc_verify->getBool() && !RigDef::BinarySerializer::Verify(def))
+        {
+            RoR::LogFormat("[RoR] Precompiled truckfile '%s' failed the round-trip check, not saving", rq.asr_cache_entry->fname.c_str());
+        }
+        else if (!RigDef::BinarySerializer::SaveFile(def, stamp, truckc_path))
+        {
+            RoR::LogFormat("[RoR] Could not write precompiled truckfile '%s'", truckc_path.c_str());
+        }
+
         rq.asr_cache_entry->actor_def = def;
         return def;
     }
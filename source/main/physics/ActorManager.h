@@ -27,6 +27,8 @@
 #include "Application.h"
 #include "CmdKeyInertia.h"
 #include "Network.h"
+#include "NodeSpatialHash.h"
+#include "PhysicsProfiler.h"
 #include "RigDef_Prerequisites.h"
 #include "ScriptEvents.h"
 #include "SimData.h"
@@ -89,6 +91,10 @@ public:
     bool           IsSimulationPaused() const              { return m_simulation_paused; }
     void           SetSimulationPaused(bool v)             { m_simulation_paused = v; }
     float          GetTotalTime() const                    { return m_total_sim_time; }
+    size_t         GetPhysicsAllocations() const           { return m_physics_allocations; } //!< Heap allocations made during the last `UpdatePhysicsSimulation()`, see `AllocationCounter`.
+    PhysicsProfiler& GetPhysicsProfiler()                  { return m_physics_profiler; }
+    uint32_t       GetSimSnapshotEpoch() const             { return m_sim_snapshot_epoch; }
+    void           InvalidateSimSnapshots()                { m_sim_snapshot_epoch++; } //!< Call after modifying actors on main thread; gfx will copy live state until the next physics step.
     RoR::CmdKeyInertiaConfig& GetInertiaConfig()           { return m_inertia_config; }
     
 
@@ -132,6 +138,13 @@ public:
     std::map<beam_t*, std::pair<ActorPtr, ActorPtr>> inter_actor_links;
     bool AreActorsDirectlyLinked(const ActorPtr& a1, const ActorPtr& a2);
 
+    /// @name Lock target search (hooks, ties, ropes)
+    /// @{
+    const NodeSpatialHash& GetLockableNodesHash();   //!< All nodes except lockgroup 9999 (deny lock); rebuilt at most once per frame.
+    const NodeSpatialHash& GetRopablesHash();        //!< All ropables; rebuilt at most once per frame.
+    void           InvalidateLockTargets() { m_lock_targets_dirty = true; }
+    /// @}
+
     static const ActorPtr ACTORPTR_NULL; // Dummy value to be returned as const reference.
 
 private:
@@ -144,6 +157,7 @@ private:
     void           ForwardCommands(ActorPtr source_actor); //!< Fowards things to trailers
     void           UpdateTruckFeatures(ActorPtr vehicle, float dt);
     void           CalcFreeForces();                             //!< Apply FreeForces - intentionally as a separate pass over all actors
+    void           RebuildLockTargets();
 
     // Networking
     std::map<int, std::set<int>> m_stream_mismatches; //!< Networking: A set of streams without a corresponding actor in the actor-array for each stream source
@@ -165,9 +179,21 @@ private:
     FreeForceVec_t      m_free_forces;                    //!< Global forces added ad-hoc by scripts
     FreeForceID_t       m_free_force_next_id     = 0;     //!< Unique ID for each FreeForce
 
+    // Lock target search
+    NodeSpatialHash     m_lockable_nodes_hash    = NodeSpatialHash(1.f);
+    NodeSpatialHash     m_ropables_hash          = NodeSpatialHash(1.f);
+    bool                m_lock_targets_dirty     = true;  //!< Set after each physics sync, when actors are added/removed and when they're reset/moved (see `InvalidateLockTargets()`).
+
     // Utils
     std::unique_ptr<ThreadPool> m_sim_thread_pool;
     std::shared_ptr<Task>       m_sim_task;
+    TaskBatch                   m_physics_batch;              //!< Reused by every substep's parallel passes.
+    std::vector<Actor*>         m_physics_batch_actors;       //!< Scratch: actors processed by the current pass.
+    bool                        m_physics_batch_first_step = false;
+    std::atomic<size_t>         m_physics_allocations{0};     //!< Written by sim thread, read by the stats overlay.
+    uint32_t                    m_sim_snapshot_epoch = 0;     //!< Modified only while the sim thread is halted.
+    PhysicsProfiler             m_physics_profiler;           //!< Fed in `SyncWithSimThread()` while enabled.
+    bool                        m_physics_profiler_pending = false; //!< A sim step was launched since the last `PhysicsProfiler::Harvest()`.
     RoR::CmdKeyInertiaConfig    m_inertia_config;
 };
 
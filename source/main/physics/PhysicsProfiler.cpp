@@ -0,0 +1,144 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PhysicsProfiler.h"
+
+#include "Actor.h"
+
+using namespace RoR;
+
+std::atomic<bool> PhysicsProfiler::s_enabled{false};
+
+const char* RoR::PhysicsPhaseToString(PhysicsPhase phase)
+{
+    switch (phase)
+    {
+    case PHYSICSPHASE_NODES:            return "Nodes";
+    case PHYSICSPHASE_BOUNDING_BOXES:   return "BoundingBoxes";
+    case PHYSICSPHASE_EVENTBOXES:       return "EventBoxes";
+    case PHYSICSPHASE_REPLAY:           return "Replay";
+    case PHYSICSPHASE_AIRCRAFT:         return "AircraftForces";
+    case PHYSICSPHASE_FUSEDRAG:         return "FuseDrag";
+    case PHYSICSPHASE_BUOYANCE:         return "Buoyance";
+    case PHYSICSPHASE_DIFFERENTIALS:    return "Differentials";
+    case PHYSICSPHASE_WHEELS:           return "Wheels";
+    case PHYSICSPHASE_SHOCKS:           return "Shocks";
+    case PHYSICSPHASE_HYDROS:           return "Hydros";
+    case PHYSICSPHASE_COMMANDS:         return "Commands";
+    case PHYSICSPHASE_TIES:             return "Ties";
+    case PHYSICSPHASE_ENGINE:           return "TruckEngine";
+    case PHYSICSPHASE_MOUSE:            return "Mouse";
+    case PHYSICSPHASE_BEAMS:            return "Beams";
+    case PHYSICSPHASE_CAB_COLLISIONS:   return "CabCollisions";
+    case PHYSICSPHASE_SLIDENODES:       return "SlideNodes";
+    case PHYSICSPHASE_FORCEFEEDBACK:    return "ForceFeedback";
+    case PHYSICSPHASE_BEAMS_INTERACTOR: return "BeamsInterActor";
+    case PHYSICSPHASE_INTER_COLLISIONS: return "InterActorCollisions";
+    default:                            return "";
+    }
+}
+
+float PhysicsProfiler::ActorRecord::GetFrameMsTotal() const
+{
+    float sum = 0.f;
+    for (int i = 0; i < PHYSICSPHASE_COUNT; i++)
+    {
+        sum += ppr_frame_ms[i];
+    }
+    return sum;
+}
+
+double PhysicsProfiler::ActorRecord::GetTotalMs() const
+{
+    double sum = 0.0;
+    for (int i = 0; i < PHYSICSPHASE_COUNT; i++)
+    {
+        sum += ppr_total_ms[i];
+    }
+    return sum;
+}
+
+PhysicsProfiler::ActorRecord& PhysicsProfiler::GetRecord(const ActorPtr& actor)
+{
+    for (ActorRecord& record : m_records)
+    {
+        if (record.ppr_actor_id == actor->ar_instance_id)
+            return record;
+    }
+
+    ActorRecord record;
+    record.ppr_actor_id = actor->ar_instance_id;
+    record.ppr_actor_name = actor->getTruckName();
+    m_records.push_back(record);
+    return m_records.back();
+}
+
+void PhysicsProfiler::Harvest(ActorPtrVec& actors)
+{
+    const float SMOOTHING = 0.1f;
+
+    for (ActorRecord& record : m_records)
+    {
+        record.ppr_alive = false;
+    }
+
+    for (const ActorPtr& actor : actors)
+    {
+        ActorRecord& record = this->GetRecord(actor);
+        record.ppr_alive = true;
+
+        PhysicsPhaseTimes& times = actor->GetPhaseTimes();
+        for (int i = 0; i < PHYSICSPHASE_COUNT; i++)
+        {
+            const double ms = static_cast<double>(times.ppt_nanosec[i]) / 1000000.0;
+            record.ppr_total_ms[i] += ms;
+            record.ppr_calls[i] += times.ppt_calls[i];
+            record.ppr_frame_ms[i] += (static_cast<float>(ms) - record.ppr_frame_ms[i]) * SMOOTHING;
+        }
+        times = PhysicsPhaseTimes();
+    }
+}
+
+void PhysicsProfiler::Reset()
+{
+    m_records.clear();
+}
+
+void PhysicsProfiler::WriteCsv(std::ostream& out) const
+{
+    out << "actor_id,actor_name,alive,phase,total_ms,calls,avg_us,frame_ms\n";
+    for (const ActorRecord& record : m_records)
+    {
+        // Quote the name - vehicle names may contain commas.
+        std::string name = record.ppr_actor_name;
+        for (size_t pos = name.find('"'); pos != std::string::npos; pos = name.find('"', pos + 2))
+        {
+            name.insert(pos, 1, '"');
+        }
+
+        for (int i = 0; i < PHYSICSPHASE_COUNT; i++)
+        {
+            const double avg_us = (record.ppr_calls[i] > 0) ? (record.ppr_total_ms[i] * 1000.0 / record.ppr_calls[i]) : 0.0;
+            out << record.ppr_actor_id << ",\"" << name << "\"," << (record.ppr_alive ? 1 : 0) << ","
+                << PhysicsPhaseToString(static_cast<PhysicsPhase>(i)) << ","
+                << record.ppr_total_ms[i] << "," << record.ppr_calls[i] << ","
+                << avg_us << "," << record.ppr_frame_ms[i] << "\n";
+        }
+    }
+}
@@ -0,0 +1,144 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+/// @brief  Per-actor, per-phase timing of the physics step.
+
+#pragma once
+
+#include "ForwardDeclarations.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace RoR {
+
+/// @addtogroup Physics
+/// @{
+
+enum PhysicsPhase
+{
+    PHYSICSPHASE_NODES,
+    PHYSICSPHASE_BOUNDING_BOXES,
+    PHYSICSPHASE_EVENTBOXES,
+    PHYSICSPHASE_REPLAY,
+    PHYSICSPHASE_AIRCRAFT,
+    PHYSICSPHASE_FUSEDRAG,
+    PHYSICSPHASE_BUOYANCE,
+    PHYSICSPHASE_DIFFERENTIALS,
+    PHYSICSPHASE_WHEELS,
+    PHYSICSPHASE_SHOCKS,
+    PHYSICSPHASE_HYDROS,
+    PHYSICSPHASE_COMMANDS,
+    PHYSICSPHASE_TIES,
+    PHYSICSPHASE_ENGINE,
+    PHYSICSPHASE_MOUSE,
+    PHYSICSPHASE_BEAMS,
+    PHYSICSPHASE_CAB_COLLISIONS,
+    PHYSICSPHASE_SLIDENODES,
+    PHYSICSPHASE_FORCEFEEDBACK,
+    PHYSICSPHASE_BEAMS_INTERACTOR,
+    PHYSICSPHASE_INTER_COLLISIONS,
+
+    PHYSICSPHASE_COUNT
+};
+
+const char* PhysicsPhaseToString(PhysicsPhase phase);
+
+/// Timing accumulators of a single actor. Written only by the thread currently simulating
+/// the actor (an actor is never processed by 2 threads at once), so no locking or atomics are needed.
+struct PhysicsPhaseTimes
+{
+    uint64_t ppt_nanosec[PHYSICSPHASE_COUNT] = {};
+    uint32_t ppt_calls[PHYSICSPHASE_COUNT] = {};
+};
+
+/// Scoped stopwatch: each `Lap()` charges the time elapsed since the previous lap to a phase.
+/// Constructed with `nullptr`, it does nothing (profiler disabled).
+class PhysicsPhaseTimer
+{
+public:
+    explicit PhysicsPhaseTimer(PhysicsPhaseTimes* times)
+        : m_times(times)
+    {
+        if (m_times)
+            m_last = std::chrono::steady_clock::now();
+    }
+
+    void Lap(PhysicsPhase phase)
+    {
+        if (!m_times)
+            return;
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        m_times->ppt_nanosec[phase] += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_last).count());
+        m_times->ppt_calls[phase]++;
+        m_last = now;
+    }
+
+private:
+    PhysicsPhaseTimes*                    m_times;
+    std::chrono::steady_clock::time_point m_last;
+};
+
+/// Collects per-actor phase timings (see `PhysicsPhaseTimer`) once per frame and keeps
+/// totals and smoothed per-frame figures for display and CSV export. Main thread only,
+/// except `IsEnabled()` which workers poll.
+class PhysicsProfiler
+{
+public:
+
+    struct ActorRecord
+    {
+        ActorInstanceID_t ppr_actor_id = ACTORINSTANCEID_INVALID;
+        std::string       ppr_actor_name;
+        bool              ppr_alive = true;
+        double            ppr_total_ms[PHYSICSPHASE_COUNT] = {}; //!< Since the last reset.
+        uint64_t          ppr_calls[PHYSICSPHASE_COUNT] = {};
+        float             ppr_frame_ms[PHYSICSPHASE_COUNT] = {};  //!< Smoothed time per frame.
+
+        float             GetFrameMsTotal() const;
+        double            GetTotalMs() const;
+    };
+
+    static bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+    static void SetEnabled(bool val) { s_enabled.store(val, std::memory_order_relaxed); }
+
+    /// Moves the actors' accumulators into records and updates the smoothed per-frame figures.
+    /// Call once per sim step, while the simulation is halted (after `SyncWithSimThread()`).
+    void Harvest(ActorPtrVec& actors);
+    void Reset();
+    void WriteCsv(std::ostream& out) const;
+
+    const std::vector<ActorRecord>& GetRecords() const { return m_records; }
+
+private:
+
+    ActorRecord& GetRecord(const ActorPtr& actor);
+
+    std::vector<ActorRecord>  m_records;
+    static std::atomic<bool>  s_enabled;
+};
+
+/// @} // addtogroup Physics
+
+} // namespace RoR
@@ -79,6 +79,7 @@ static const float HOOK_LOCK_TIMER_DEFAULT      = 5.0;
 static const int   NODE_LOCKGROUP_DEFAULT       = -1; // all hooks scan all nodes
 static const int   DEFAULT_DETACHER_GROUP       = 0; // default for detaching beam group
 static const float DEFAULT_SPEEDO_MAX_KPH       = 140.f;
+static const float COARSE_SPHERE_TREE_CELL_SIZE = 2.0f; //!< Node clustering grid for `CoarseSphereTree` leaves, in meters.
 
 static const float FLAP_ANGLES[6] = {0.f, -0.07f, -0.17f, -0.33f, -0.67f, -1.f};
 
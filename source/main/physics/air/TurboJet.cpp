@@ -152,16 +152,16 @@ void Turbojet::setVisible(bool visible)
 
 void TurbojetVisual::UpdateVisuals(RoR::GfxActor* gfx_actor)
 {
-    RoR::NodeSB* node_buf = gfx_actor->GetSimNodeBuffer();
+    const Ogre::Vector3* node_buf = gfx_actor->GetSimNodePositions();
     RoR::AeroEngineSB& ae_buf
         = gfx_actor->GetSimDataBuffer().simbuf_aeroengines.at(m_number);
 
     //nozzle
-    m_nozzle_scenenode->setPosition(node_buf[m_node_back].AbsPosition);
+    m_nozzle_scenenode->setPosition(node_buf[m_node_back]);
     //build a local system
-    Vector3 laxis = node_buf[m_node_front].AbsPosition - node_buf[m_node_back].AbsPosition;
+    Vector3 laxis = node_buf[m_node_front] - node_buf[m_node_back];
     laxis.normalise();
-    Vector3 paxis = Plane(laxis, 0).projectVector(node_buf[m_node_ref].AbsPosition - node_buf[m_node_back].AbsPosition);
+    Vector3 paxis = Plane(laxis, 0).projectVector(node_buf[m_node_ref] - node_buf[m_node_back]);
     paxis.normalise();
     Vector3 taxis = laxis.crossProduct(paxis);
     Quaternion dir = Quaternion(laxis, paxis, taxis);
@@ -173,7 +173,7 @@ void TurbojetVisual::UpdateVisuals(RoR::GfxActor* gfx_actor)
         float flamelength = (ae_buf.simbuf_tj_ab_thrust / 15.0) * (ae_buf.simbuf_ae_rpmpc / 100.0);
         flamelength = flamelength * (1.0 + (((Real)rand() / (Real)RAND_MAX) - 0.5) / 10.0);
         m_flame_scenenode->setScale(flamelength, m_radius * 2.0, m_radius * 2.0);
-        m_flame_scenenode->setPosition(node_buf[m_node_back].AbsPosition + dir * Vector3(-0.2, 0.0, 0.0));
+        m_flame_scenenode->setPosition(node_buf[m_node_back] + dir * Vector3(-0.2, 0.0, 0.0));
         m_flame_scenenode->setOrientation(dir);
     }
     else
@@ -184,7 +184,7 @@ void TurbojetVisual::UpdateVisuals(RoR::GfxActor* gfx_actor)
         gfx_actor->GetSimDataBuffer().simbuf_smoke_enabled)
     {
         App::GetGfxScene()->AdjustParticleSystemTimeFactor(m_smoke_particle);
-        m_smoke_scenenode->setPosition(node_buf[m_node_back].AbsPosition);
+        m_smoke_scenenode->setPosition(node_buf[m_node_back]);
         ParticleEmitter* emit = m_smoke_particle->getEmitter(0);
         emit->setDirection(-laxis);
         emit->setParticleVelocity(ae_buf.simbuf_tj_exhaust_velo);
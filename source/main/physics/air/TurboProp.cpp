@@ -170,15 +170,15 @@ Turboprop::~Turboprop()
 
 void Turboprop::updateVisuals(RoR::GfxActor* gfx_m_actor)
 {
-    RoR::NodeSB* node_buf = gfx_m_actor->GetSimNodeBuffer();
+    const Ogre::Vector3* node_buf = gfx_m_actor->GetSimNodePositions();
 
     //smoke
     if (smokeNode)
     {
         App::GetGfxScene()->AdjustParticleSystemTimeFactor(smokePS);
-        smokeNode->setPosition(node_buf[nodeback].AbsPosition);
+        smokeNode->setPosition(node_buf[nodeback]);
         ParticleEmitter* emit = smokePS->getEmitter(0);
-        Vector3 dir = node_buf[nodeback].AbsPosition - node_buf[noderef].AbsPosition;
+        Vector3 dir = node_buf[nodeback] - node_buf[noderef];
         emit->setDirection(dir);
         emit->setParticleVelocity(propwash - propwash / 10, propwash + propwash / 10);
         if (!failed)
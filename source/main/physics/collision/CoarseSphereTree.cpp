@@ -0,0 +1,130 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "CoarseSphereTree.h"
+
+#include "SimData.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Ogre;
+using namespace RoR;
+
+static int64_t PackCellKey(const Vector3& pos, float inv_cell_size)
+{
+    const int64_t MASK = (1 << 21) - 1;
+    const int64_t x = static_cast<int64_t>(std::floor(pos.x * inv_cell_size)) & MASK;
+    const int64_t y = static_cast<int64_t>(std::floor(pos.y * inv_cell_size)) & MASK;
+    const int64_t z = static_cast<int64_t>(std::floor(pos.z * inv_cell_size)) & MASK;
+    return (x << 42) | (y << 21) | z;
+}
+
+static void FinalizeSphere(CoarseSphereTree::Sphere& sphere, const node_t* nodes, const std::pair<int64_t, int>* begin, const std::pair<int64_t, int>* end)
+{
+    const float count = static_cast<float>(end - begin);
+    Vector3 center = Vector3::ZERO;
+    Vector3 velocity = Vector3::ZERO;
+    for (auto* itor = begin; itor != end; ++itor)
+    {
+        center += nodes[itor->second].AbsPosition;
+        velocity += nodes[itor->second].Velocity;
+    }
+    center /= count;
+
+    float radius_sq = 0.f;
+    for (auto* itor = begin; itor != end; ++itor)
+    {
+        radius_sq = std::max(radius_sq, center.squaredDistance(nodes[itor->second].AbsPosition));
+    }
+
+    sphere.cst_center = center;
+    sphere.cst_radius = std::sqrt(radius_sq);
+    sphere.cst_velocity = velocity / count;
+}
+
+void CoarseSphereTree::Build(const node_t* nodes, int num_nodes, float cell_size)
+{
+    m_leaves.clear();
+    m_root = Sphere();
+    if (num_nodes <= 0)
+        return;
+
+    // Sort nodes by grid cell so each cell forms a contiguous run.
+    const float inv_cell_size = 1.f / cell_size;
+    m_cell_nodes.resize(num_nodes);
+    for (int i = 0; i < num_nodes; i++)
+    {
+        m_cell_nodes[i] = std::make_pair(PackCellKey(nodes[i].AbsPosition, inv_cell_size), i);
+    }
+    std::sort(m_cell_nodes.begin(), m_cell_nodes.end());
+
+    const std::pair<int64_t, int>* data = m_cell_nodes.data();
+    size_t run_start = 0;
+    for (size_t i = 1; i <= m_cell_nodes.size(); i++)
+    {
+        if (i == m_cell_nodes.size() || m_cell_nodes[i].first != m_cell_nodes[run_start].first)
+        {
+            Sphere leaf;
+            FinalizeSphere(leaf, nodes, data + run_start, data + i);
+            m_leaves.push_back(leaf);
+            run_start = i;
+        }
+    }
+
+    FinalizeSphere(m_root, nodes, data, data + m_cell_nodes.size());
+}
+
+float CoarseSphereTree::PredictGap(const Sphere& a, const Sphere& b, float lookahead)
+{
+    // Closest approach of 2 spheres moving at constant velocity, clamped to [0, lookahead].
+    const Vector3 rel_pos = b.cst_center - a.cst_center;
+    const Vector3 rel_vel = b.cst_velocity - a.cst_velocity;
+    const float rel_vel_sq = rel_vel.squaredLength();
+    float t = 0.f;
+    if (rel_vel_sq > 0.f)
+    {
+        t = std::min(std::max(-rel_pos.dotProduct(rel_vel) / rel_vel_sq, 0.f), lookahead);
+    }
+    return (rel_pos + rel_vel * t).length() - a.cst_radius - b.cst_radius;
+}
+
+bool CoarseSphereTree::PredictProximity(const CoarseSphereTree& a, const CoarseSphereTree& b, float distance, float lookahead)
+{
+    if (a.m_leaves.empty() || b.m_leaves.empty())
+        return false;
+
+    // Root test first - rejects most pairs.
+    if (PredictGap(a.m_root, b.m_root, lookahead) >= distance)
+        return false;
+
+    for (const Sphere& leaf_a : a.m_leaves)
+    {
+        // Skip leaves which can't reach the other actor at all.
+        if (PredictGap(leaf_a, b.m_root, lookahead) >= distance)
+            continue;
+
+        for (const Sphere& leaf_b : b.m_leaves)
+        {
+            if (PredictGap(leaf_a, leaf_b, lookahead) < distance)
+                return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,71 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "ForwardDeclarations.h"
+
+#include <OgreVector3.h>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace RoR {
+
+/// @addtogroup Physics
+/// @{
+
+/// @addtogroup Collisions
+/// @{
+
+/// Coarse 2-level bounding volume of an actor: a root sphere around all nodes
+/// and leaf spheres around nodes clustered on a uniform grid. Each sphere carries
+/// the average velocity of its nodes, for lookahead (swept) proximity tests.
+class CoarseSphereTree
+{
+public:
+
+    struct Sphere
+    {
+        Ogre::Vector3 cst_center = Ogre::Vector3::ZERO;
+        float         cst_radius = 0.f;
+        Ogre::Vector3 cst_velocity = Ogre::Vector3::ZERO;
+    };
+
+    void Build(const node_t* nodes, int num_nodes, float cell_size);
+
+    const Sphere&              GetRoot() const   { return m_root; }
+    const std::vector<Sphere>& GetLeaves() const { return m_leaves; }
+
+    /// Returns true if any leaf spheres of `a` and `b` get closer than `distance` within `lookahead` seconds (assuming constant velocities).
+    static bool PredictProximity(const CoarseSphereTree& a, const CoarseSphereTree& b, float distance, float lookahead);
+
+private:
+
+    static float PredictGap(const Sphere& a, const Sphere& b, float lookahead); //!< Smallest surface distance within the lookahead window.
+
+    Sphere                                m_root;
+    std::vector<Sphere>                   m_leaves;
+    std::vector<std::pair<int64_t, int>>  m_cell_nodes; //!< Scratch buffer: (cell key, node index), reused between builds.
+};
+
+/// @} // addtogroup Collisions
+/// @} // addtogroup Physics
+
+} // namespace RoR
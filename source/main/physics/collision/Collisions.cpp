@@ -345,6 +345,7 @@ void Collisions::removeCollisionBox(int number)
     if (number > -1 && number < m_collision_boxes.size())
     {
         m_collision_boxes[number].enabled = false;
+        m_collision_boxes_revision++;
         if (m_collision_boxes[number].eventsourcenum >= 0 && m_collision_boxes[number].eventsourcenum < free_eventsource)
         {
             eventsources[m_collision_boxes[number].eventsourcenum].es_enabled = false;
@@ -551,6 +552,7 @@ int Collisions::addCollisionBox(bool rotating, bool virt, Vector3 pos, Ogre::Vec
 
     m_collision_aab.merge(AxisAlignedBox(coll_box.lo, coll_box.hi));
     m_collision_boxes.push_back(coll_box);
+    m_collision_boxes_revision++; // The vector may have reallocated
     return coll_box_index;
 }
 
@@ -1118,22 +1120,28 @@ bool Collisions::nodeCollision(node_t *node, float dt)
     return contacted;
 }
 
+Collisions::CellRange Collisions::GetCellRange(const AxisAlignedBox& aabb) const
+{
+    CellRange range;
+    range.lo_x = (int)(aabb.getMinimum().x / (float)CELL_SIZE);
+    range.lo_z = (int)(aabb.getMinimum().z / (float)CELL_SIZE);
+    range.hi_x = (int)(aabb.getMaximum().x / (float)CELL_SIZE);
+    range.hi_z = (int)(aabb.getMaximum().z / (float)CELL_SIZE);
+    return range;
+}
+
 void Collisions::findPotentialEventBoxes(Actor* actor, CollisionBoxPtrVec& out_boxes)
 {
     // Find collision cells occupied by the actor (remember 'Y' is 'up').
     // Remember there's a dedicated bounding box `ar_evboxes_bounding_box`.
     // ----------------------------------------------------------------------
 
-    const AxisAlignedBox aabb = actor->ar_evboxes_bounding_box;
-    const int cell_lo_x = (int)(aabb.getMinimum().x / (float)CELL_SIZE);
-    const int cell_lo_z = (int)(aabb.getMinimum().z / (float)CELL_SIZE);
-    const int cell_hi_x = (int)(aabb.getMaximum().x / (float)CELL_SIZE);
-    const int cell_hi_z = (int)(aabb.getMaximum().z / (float)CELL_SIZE);
+    const CellRange cells = this->GetCellRange(actor->ar_evboxes_bounding_box);
 
     // Loop the collision cells
-    for (int refx = cell_lo_x; refx <= cell_hi_x; refx++)
+    for (int refx = cells.lo_x; refx <= cells.hi_x; refx++)
     {
-        for (int refz = cell_lo_z; refz <= cell_hi_z; refz++)
+        for (int refz = cells.lo_z; refz <= cells.hi_z; refz++)
         {
             // Find current cell
             const int hash = this->hash_find(refx, refz);
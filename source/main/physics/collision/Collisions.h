@@ -130,6 +130,7 @@ private:
 
     // collision boxes pool
     CollisionBoxVec m_collision_boxes; // Formerly MAX_COLLISION_BOXES = 5000
+    int m_collision_boxes_revision = 0; // Bumped whenever boxes are added or disabled - invalidates `Actor::m_potential_eventboxes`
     std::vector<collision_box_t*> m_last_called_cboxes; // Only used for character, actors have their own cache `Actor::m_active_eventboxes`
 
     // collision tris pool
@@ -166,6 +167,14 @@ private:
 
 public:
 
+    /// Range of terrain cells (X/Z) touched by a bounding box
+    struct CellRange
+    {
+        int lo_x = 0, lo_z = 0, hi_x = -1, hi_z = -1; // Default = empty range
+        bool operator==(const CellRange& o) const { return lo_x == o.lo_x && lo_z == o.lo_z && hi_x == o.hi_x && hi_z == o.hi_z; }
+        bool operator!=(const CellRange& o) const { return !(*this == o); }
+    };
+
     // how many elements per cell? power of 2 minus 2 is better
     static const int CELL_BLOCKSIZE = 126;
 
@@ -177,6 +186,8 @@ public:
     Ogre::Quaternion getDirection(const Ogre::String& inst, const Ogre::String& box);
     collision_box_t* getBox(const Ogre::String& inst, const Ogre::String& box);
     const int GetCellSize() const { return CELL_SIZE; }
+    CellRange GetCellRange(const Ogre::AxisAlignedBox& aabb) const;
+    int GetCollisionBoxesRevision() const { return m_collision_boxes_revision; }
 
     std::pair<bool, Ogre::Real> intersectsTris(Ogre::Ray ray);
 
@@ -195,7 +206,7 @@ public:
     bool isInside(Ogre::Vector3 pos, collision_box_t* cbox, float border = 0);
     bool nodeCollision(node_t* node, float dt);
     void envokeScriptCallback(collision_box_t* cbox, node_t* node = 0); // Only invoke on main thread! Oterwise use `MSG_SIM_SCRIPT_CALLBACK_QUEUED`
-    void findPotentialEventBoxes(Actor* actor, CollisionBoxPtrVec& out_boxes);
+    void findPotentialEventBoxes(Actor* actor, CollisionBoxPtrVec& out_boxes); //!< Uses `ar_evboxes_bounding_box`, see `GetCellRange()`
 
     void finishLoadingTerrain();
 
@@ -0,0 +1,75 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "NodeSpatialHash.h"
+
+#include "SimData.h"
+
+using namespace Ogre;
+using namespace RoR;
+
+void NodeSpatialHash::Clear()
+{
+    m_entries.clear();
+    m_sorted.clear();
+}
+
+void NodeSpatialHash::AddEntry(Actor* actor, node_t* node, ropable_t* ropable)
+{
+    Entry entry;
+    entry.nsh_actor = actor;
+    entry.nsh_node = node;
+    entry.nsh_ropable = ropable;
+    entry.nsh_pos = node->AbsPosition;
+    for (int axis = 0; axis < 3; axis++)
+    {
+        entry.nsh_cell[axis] = this->CellCoord(entry.nsh_pos[axis]);
+    }
+    m_entries.push_back(entry);
+}
+
+void NodeSpatialHash::Build()
+{
+    // Bucket count: power of 2, at least twice the number of entries to keep chains short.
+    size_t num_buckets = 64;
+    while (num_buckets < m_entries.size() * 2)
+    {
+        num_buckets *= 2;
+    }
+    m_bucket_mask = num_buckets - 1;
+
+    // Counting sort by bucket.
+    m_bucket_start.assign(num_buckets + 1, 0);
+    for (const Entry& entry : m_entries)
+    {
+        m_bucket_start[this->HashCell(entry.nsh_cell[0], entry.nsh_cell[1], entry.nsh_cell[2]) + 1]++;
+    }
+    for (size_t i = 1; i <= num_buckets; i++)
+    {
+        m_bucket_start[i] += m_bucket_start[i - 1];
+    }
+
+    m_sorted.resize(m_entries.size());
+    std::vector<size_t> fill(m_bucket_start.begin(), m_bucket_start.end() - 1);
+    for (const Entry& entry : m_entries)
+    {
+        m_sorted[fill[this->HashCell(entry.nsh_cell[0], entry.nsh_cell[1], entry.nsh_cell[2])]++] = entry;
+    }
+    m_entries.clear();
+}
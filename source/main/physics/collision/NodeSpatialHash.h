@@ -0,0 +1,129 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "ForwardDeclarations.h"
+
+#include <OgreVector3.h>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace RoR {
+
+/// @addtogroup Physics
+/// @{
+
+/// @addtogroup Collisions
+/// @{
+
+/// Uniform grid over node positions of all actors, for radius queries (hook/tie/rope lock target search).
+/// Entries are collected with `AddEntry()` and bucketed by `Build()`; the buffers are reused between rebuilds.
+class NodeSpatialHash
+{
+public:
+
+    struct Entry
+    {
+        Actor*         nsh_actor = nullptr;    //!< Raw pointer - the owner must rebuild the hash whenever actors are added/removed.
+        node_t*        nsh_node = nullptr;
+        ropable_t*     nsh_ropable = nullptr;  //!< Only set when indexing ropables.
+        Ogre::Vector3  nsh_pos;                //!< Node position at the time of the rebuild.
+        int            nsh_cell[3];
+    };
+
+    NodeSpatialHash(float cell_size): m_cell_size(cell_size), m_inv_cell_size(1.f / cell_size) {}
+
+    void Clear();
+    void AddEntry(Actor* actor, node_t* node, ropable_t* ropable = nullptr);
+    void Build();
+    size_t GetNumEntries() const { return m_sorted.size(); }
+
+    /// Invokes `func(const Entry&)` for every entry within `radius` of `center` (as of the last rebuild).
+    template <typename Func> void ForEachInRadius(const Ogre::Vector3& center, float radius, Func func) const
+    {
+        if (m_sorted.empty())
+            return;
+
+        const float radius_sq = radius * radius;
+        int lo[3], hi[3];
+        int64_t num_cells = 1;
+        for (int axis = 0; axis < 3; axis++)
+        {
+            lo[axis] = this->CellCoord(center[axis] - radius);
+            hi[axis] = this->CellCoord(center[axis] + radius);
+            num_cells *= (int64_t)(hi[axis] - lo[axis] + 1);
+        }
+
+        if (num_cells > (int64_t)m_sorted.size())
+        {
+            // The query volume spans more cells than there are entries - scanning them all is cheaper.
+            for (const Entry& entry : m_sorted)
+            {
+                if (entry.nsh_pos.squaredDistance(center) <= radius_sq)
+                    func(entry);
+            }
+            return;
+        }
+
+        for (int x = lo[0]; x <= hi[0]; x++)
+        {
+            for (int y = lo[1]; y <= hi[1]; y++)
+            {
+                for (int z = lo[2]; z <= hi[2]; z++)
+                {
+                    const size_t bucket = this->HashCell(x, y, z);
+                    for (size_t i = m_bucket_start[bucket]; i < m_bucket_start[bucket + 1]; i++)
+                    {
+                        const Entry& entry = m_sorted[i];
+                        // Different cells may share a bucket - only accept the queried cell.
+                        if (entry.nsh_cell[0] == x && entry.nsh_cell[1] == y && entry.nsh_cell[2] == z
+                            && entry.nsh_pos.squaredDistance(center) <= radius_sq)
+                        {
+                            func(entry);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+private:
+
+    int CellCoord(float v) const { return static_cast<int>(std::floor(v * m_inv_cell_size)); }
+
+    size_t HashCell(int x, int y, int z) const
+    {
+        const uint32_t h = (uint32_t(x) * 73856093u) ^ (uint32_t(y) * 19349663u) ^ (uint32_t(z) * 83492791u);
+        return h & m_bucket_mask;
+    }
+
+    float                 m_cell_size;
+    float                 m_inv_cell_size;
+    std::vector<Entry>    m_entries;       //!< Unsorted input, filled by `AddEntry()`
+    std::vector<Entry>    m_sorted;        //!< Entries grouped by bucket
+    std::vector<size_t>   m_bucket_start;  //!< Offsets into `m_sorted`, size = num buckets + 1
+    size_t                m_bucket_mask = 0;
+};
+
+/// @} // addtogroup Collisions
+/// @} // addtogroup Physics
+
+} // namespace RoR
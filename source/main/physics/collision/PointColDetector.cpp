@@ -51,7 +51,8 @@ void PointColDetector::UpdateIntraPoint(bool contactables)
 void PointColDetector::UpdateInterPoint(bool ignorestate)
 {
     int contacters_size = 0;
-    std::vector<ActorInstanceID_t> collision_partners;
+    std::vector<ActorInstanceID_t>& collision_partners = m_collision_partners_scratch;
+    collision_partners.clear();
     for (ActorPtr& actor : App::GetGameContext()->GetActorManager()->GetActors())
     {
         if (actor != m_actor && (ignorestate || actor->ar_update_physics) &&
@@ -80,7 +81,7 @@ void PointColDetector::UpdateInterPoint(bool ignorestate)
 
     if (collision_partners != m_collision_partners || contacters_size != m_object_list_size)
     {
-        m_collision_partners = collision_partners;
+        m_collision_partners.swap(collision_partners);
         m_object_list_size = contacters_size;
         update_structures_for_contacters(false);
     }
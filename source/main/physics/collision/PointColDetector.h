@@ -70,6 +70,7 @@ private:
 
     ActorPtr                 m_actor;
     std::vector<ActorInstanceID_t>    m_collision_partners; //!< IntraPoint: always just owning actor; InterPoint: all colliding actors
+    std::vector<ActorInstanceID_t>    m_collision_partners_scratch; //!< InterPoint: partners found this step; swapped with `m_collision_partners` on change - no per-step allocation.
     std::vector<refelem_t> m_ref_list;
     
     std::vector<kdnode_t>  m_kdtree;
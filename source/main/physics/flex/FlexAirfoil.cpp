@@ -441,16 +441,16 @@ void FlexAirfoil::updateVerticesPhysics()
 
 Vector3 FlexAirfoil::updateVerticesGfx(RoR::GfxActor* gfx_actor)
 {
-    auto gfx_nodes = gfx_actor->GetSimNodeBuffer();
+    const Ogre::Vector3* gfx_nodes = gfx_actor->GetSimNodePositions();
     int i;
     Vector3 center;
-    center=gfx_nodes[nfld].AbsPosition;
+    center=gfx_nodes[nfld];
 
-    Vector3 vx=gfx_nodes[nfrd].AbsPosition-gfx_nodes[nfld].AbsPosition;
-    Vector3 vyl=gfx_nodes[nflu].AbsPosition-gfx_nodes[nfld].AbsPosition;
-    Vector3 vzl=gfx_nodes[nbld].AbsPosition-gfx_nodes[nfld].AbsPosition;
-    Vector3 vyr=gfx_nodes[nfru].AbsPosition-gfx_nodes[nfrd].AbsPosition;
-    Vector3 vzr=gfx_nodes[nbrd].AbsPosition-gfx_nodes[nfrd].AbsPosition;
+    Vector3 vx=gfx_nodes[nfrd]-gfx_nodes[nfld];
+    Vector3 vyl=gfx_nodes[nflu]-gfx_nodes[nfld];
+    Vector3 vzl=gfx_nodes[nbld]-gfx_nodes[nfld];
+    Vector3 vyr=gfx_nodes[nfru]-gfx_nodes[nfrd];
+    Vector3 vzr=gfx_nodes[nbrd]-gfx_nodes[nfrd];
 
     Vector3 facenormal=vx;
     facenormal.normalise();
@@ -488,13 +488,13 @@ Vector3 FlexAirfoil::updateVerticesGfx(RoR::GfxActor* gfx_actor)
         Vector3 rcent, raxis;
         if (!stabilleft)
         {
-            rcent=((gfx_nodes[nflu].AbsPosition+gfx_nodes[nbld].AbsPosition)/2.0+(gfx_nodes[nflu].AbsPosition-gfx_nodes[nblu].AbsPosition)/4.0)-center;
-            raxis=(gfx_nodes[nflu].AbsPosition-gfx_nodes[nfld].AbsPosition).crossProduct(gfx_nodes[nflu].AbsPosition-gfx_nodes[nblu].AbsPosition);
+            rcent=((gfx_nodes[nflu]+gfx_nodes[nbld])/2.0+(gfx_nodes[nflu]-gfx_nodes[nblu])/4.0)-center;
+            raxis=(gfx_nodes[nflu]-gfx_nodes[nfld]).crossProduct(gfx_nodes[nflu]-gfx_nodes[nblu]);
         }
         else
         {
-            rcent=((gfx_nodes[nfru].AbsPosition+gfx_nodes[nbrd].AbsPosition)/2.0+(gfx_nodes[nfru].AbsPosition-gfx_nodes[nbru].AbsPosition)/4.0)-center;
-            raxis=(gfx_nodes[nfru].AbsPosition-gfx_nodes[nfrd].AbsPosition).crossProduct(gfx_nodes[nfru].AbsPosition-gfx_nodes[nbru].AbsPosition);
+            rcent=((gfx_nodes[nfru]+gfx_nodes[nbrd])/2.0+(gfx_nodes[nfru]-gfx_nodes[nbru])/4.0)-center;
+            raxis=(gfx_nodes[nfru]-gfx_nodes[nfrd]).crossProduct(gfx_nodes[nfru]-gfx_nodes[nbru]);
         }
         raxis.normalise();
         Quaternion rot=Quaternion(Degree(deflection), raxis);
@@ -26,15 +26,23 @@
 #include "Console.h"
 #include "SimData.h"
 #include "FlexFactory.h"
+#include "ForsetNodeTree.h"
 #include "GfxActor.h"
 #include "GfxScene.h"
 #include "RigDef_File.h"
+#include "ThreadPool.h"
 
 #include <Ogre.h>
 
+#if defined(__AVX2__)
+#   include <immintrin.h>
+#endif
+
 using namespace Ogre;
 using namespace RoR;
 
+static const int FLEXBODY_LOCATOR_BATCH_SIZE = 1024; //!< Vertices per thread pool item when searching locators.
+
 FlexBody::FlexBody(
     RoR::FlexBodyCacheData* preloaded_from_cache,
     RoR::GfxActor* gfx_actor,
@@ -64,17 +72,17 @@ FlexBody::FlexBody(
     Vector3 position = Vector3::ZERO;
     Quaternion orientation = Quaternion::ZERO;
 
-    RoR::NodeSB* nodes = m_gfx_actor->GetSimNodeBuffer();
+    const Ogre::Vector3* nodes = m_gfx_actor->GetSimNodePositions();
 
     if (m_node_center != NODENUM_INVALID)
     {
-        Vector3 diffX = nodes[nx].AbsPosition-nodes[ref].AbsPosition;
-        Vector3 diffY = nodes[ny].AbsPosition-nodes[ref].AbsPosition;
+        Vector3 diffX = nodes[nx]-nodes[ref];
+        Vector3 diffY = nodes[ny]-nodes[ref];
 
         normal = (diffY.crossProduct(diffX)).normalisedCopy();
 
         // position
-        position = nodes[ref].AbsPosition + offset.x * diffX + offset.y * diffY;
+        position = nodes[ref] + offset.x * diffX + offset.y * diffY;
         position = position + offset.z * normal;
 
         // orientation
@@ -86,7 +94,7 @@ FlexBody::FlexBody(
     {
         // special case!
         normal = Vector3::UNIT_Y;
-        position = nodes[0].AbsPosition + offset;
+        position = nodes[0] + offset;
         orientation = rot;
     }
 
@@ -248,14 +256,21 @@ FlexBody::FlexBody(
     double stat_located_time = -1;
     if (preloaded_from_cache != nullptr)
     {
-        m_dst_pos     = preloaded_from_cache->dst_pos;
-        m_src_normals = preloaded_from_cache->src_normals;
-        m_locators    = preloaded_from_cache->locators;
-        m_dst_normals = (Vector3*)malloc(sizeof(Vector3)*m_vertex_count); // Use malloc() for compatibility
+        // Locators and source normals are never modified after construction - use the cache memory directly.
+        // The mapping is read-only, see `m_shares_cache_data`.
+        m_src_normals = const_cast<Vector3*>(preloaded_from_cache->src_normals);
+        m_locators    = const_cast<Locator_t*>(preloaded_from_cache->locators);
+        m_shares_cache_data = true;
+
+        // Use malloc() for compatibility
+        m_dst_pos     = (Vector3*)malloc(sizeof(Vector3)*m_vertex_count);
+        m_dst_normals = (Vector3*)malloc(sizeof(Vector3)*m_vertex_count);
+        std::memcpy(m_dst_pos, preloaded_from_cache->dst_pos, sizeof(Vector3)*m_vertex_count);
 
         if (m_has_texture_blend)
         {
-            m_src_colors = preloaded_from_cache->src_colors;
+            m_src_colors = (ARGB*)malloc(sizeof(ARGB)*m_vertex_count);
+            std::memcpy(m_src_colors, preloaded_from_cache->src_colors, sizeof(ARGB)*m_vertex_count);
         }
 
         if (mesh->sharedVertexData)
@@ -371,110 +386,121 @@ FlexBody::FlexBody(
         }
 
         m_locators = new Locator_t[m_vertex_count];
-        for (int i=0; i<(int)m_vertex_count; i++)
+
+        // Is a locator manually specified via directive 'forvert'? (first matching entry wins)
+        std::vector<int> forvert_for_vertex(m_vertex_count, -1);
+        for (int j=0; j<(int)forvert_data.size(); j++)
         {
-            // Is this locator is manually specified via directive 'forvert'?
-            auto forvert_itor = std::find_if(forvert_data.begin(), forvert_data.end(),
-                [i](const ForvertTempData& data) { return data.vert_index == i; });
-            if (forvert_itor != forvert_data.end())
+            const int vert_index = forvert_data[j].vert_index;
+            if (vert_index >= 0 && vert_index < (int)m_vertex_count && forvert_for_vertex[vert_index] == -1)
             {
-                m_locators[i].ref = forvert_itor->nref;
-                m_locators[i].nx = forvert_itor->nx;
-                m_locators[i].ny = forvert_itor->ny;
-                m_locators[i].is_forvert = true;
-                LOG(fmt::format("FLEXBODY vertex {} overriden for nodes REF:{}, VX:{}, VY:{}",
-                    i, m_locators[i].ref, m_locators[i].nx, m_locators[i].ny));
+                forvert_for_vertex[vert_index] = j;
             }
-            else
-            {
+        }
 
-                //search nearest node as the local origin
-                float closest_node_distance = std::numeric_limits<float>::max();
-                int closest_node_index = -1;
-                for (auto node_index : node_indices)
-                {
-                    float node_distance = vertices[i].squaredDistance(nodes[node_index].AbsPosition);
-                    if (node_distance < closest_node_distance)
-                    {
-                        closest_node_distance = node_distance;
-                        closest_node_index = node_index;
-                    }
-                }
-                if (closest_node_index == -1)
+        // Search the forset nodes with a kd-tree instead of scanning all of them for each vertex;
+        // the tree resolves equally distant nodes exactly like the scan did (first listed wins).
+        const ForsetNodeTree node_tree(nodes, node_indices);
+        std::atomic<int> num_ref_errors(0);
+        std::atomic<int> num_vx_errors(0);
+        std::atomic<int> num_vy_errors(0);
+
+        auto locate_func = [&](int batch)
+        {
+            const int begin = batch * FLEXBODY_LOCATOR_BATCH_SIZE;
+            const int end = std::min(begin + FLEXBODY_LOCATOR_BATCH_SIZE, (int)m_vertex_count);
+            for (int i=begin; i<end; i++)
+            {
+                Locator_t& loc = m_locators[i];
+                if (forvert_for_vertex[i] != -1)
                 {
-                    LOG("FLEXBODY ERROR on mesh " + mesh_name + ": REF node not found");
-                    closest_node_index = 0;
+                    const ForvertTempData& forvert = forvert_data[forvert_for_vertex[i]];
+                    loc.ref = forvert.nref;
+                    loc.nx = forvert.nx;
+                    loc.ny = forvert.ny;
+                    loc.is_forvert = true;
                 }
-                m_locators[i].ref = closest_node_index;
-
-                //search the second nearest node as the X vector
-                closest_node_distance = std::numeric_limits<float>::max();
-                closest_node_index = -1;
-                for (auto node_index : node_indices)
+                else
                 {
-                    if (node_index == m_locators[i].ref)
+                    //search nearest node as the local origin
+                    int closest_node_index = node_tree.FindNearest(vertices[i], [](NodeNum_t) { return true; });
+                    if (closest_node_index == -1)
                     {
-                        continue;
+                        num_ref_errors++;
+                        closest_node_index = 0;
                     }
-                    float node_distance = vertices[i].squaredDistance(nodes[node_index].AbsPosition);
-                    if (node_distance < closest_node_distance)
-                    {
-                        closest_node_distance = node_distance;
-                        closest_node_index = node_index;
-                    }
-                }
-                if (closest_node_index == -1)
-                {
-                    LOG("FLEXBODY ERROR on mesh " + mesh_name + ": VX node not found");
-                    closest_node_index = 0;
-                }
-                m_locators[i].nx = closest_node_index;
+                    loc.ref = closest_node_index;
 
-                //search another close, orthogonal node as the Y vector
-                closest_node_distance = std::numeric_limits<float>::max();
-                closest_node_index = -1;
-                Vector3 vx = (nodes[m_locators[i].nx].AbsPosition - nodes[m_locators[i].ref].AbsPosition).normalisedCopy();
-                for (auto node_index : node_indices)
-                {
-                    if (node_index == m_locators[i].ref || node_index == m_locators[i].nx)
+                    //search the second nearest node as the X vector
+                    closest_node_index = node_tree.FindNearest(vertices[i],
+                        [&loc](NodeNum_t node) { return node != loc.ref; });
+                    if (closest_node_index == -1)
                     {
-                        continue;
+                        num_vx_errors++;
+                        closest_node_index = 0;
                     }
-                    float node_distance = vertices[i].squaredDistance(nodes[node_index].AbsPosition);
-                    if (node_distance < closest_node_distance)
-                    {
-                        Vector3 vt = (nodes[node_index].AbsPosition - nodes[m_locators[i].ref].AbsPosition).normalisedCopy();
-                        float cost = vx.dotProduct(vt);
-                        if (std::abs(cost) > std::sqrt(2.0f) / 2.0f)
+                    loc.nx = closest_node_index;
+
+                    //search another close, orthogonal node as the Y vector
+                    const Vector3 vx = (nodes[loc.nx] - nodes[loc.ref]).normalisedCopy();
+                    closest_node_index = node_tree.FindNearest(vertices[i],
+                        [&loc, &vx, nodes](NodeNum_t node)
                         {
-                            continue; //rejection, fails the orthogonality criterion (+-45 degree)
-                        }
-                        closest_node_distance = node_distance;
-                        closest_node_index = node_index;
+                            if (node == loc.ref || node == loc.nx)
+                            {
+                                return false;
+                            }
+                            Vector3 vt = (nodes[node] - nodes[loc.ref]).normalisedCopy();
+                            float cost = vx.dotProduct(vt);
+                            return std::abs(cost) <= std::sqrt(2.0f) / 2.0f; //rejection, fails the orthogonality criterion (+-45 degree)
+                        });
+                    if (closest_node_index == -1)
+                    {
+                        num_vy_errors++;
+                        closest_node_index = 0;
                     }
+                    loc.ny = closest_node_index;
                 }
-                if (closest_node_index == -1)
-                {
-                    LOG("FLEXBODY ERROR on mesh " + mesh_name + ": VY node not found");
-                    closest_node_index = 0;
-                }
-                m_locators[i].ny = closest_node_index;
-            }
 
-            Matrix3 mat;
-            Vector3 diffX = nodes[m_locators[i].nx].AbsPosition-nodes[m_locators[i].ref].AbsPosition;
-            Vector3 diffY = nodes[m_locators[i].ny].AbsPosition-nodes[m_locators[i].ref].AbsPosition;
+                Matrix3 mat;
+                Vector3 diffX = nodes[loc.nx]-nodes[loc.ref];
+                Vector3 diffY = nodes[loc.ny]-nodes[loc.ref];
 
-            mat.SetColumn(0, diffX);
-            mat.SetColumn(1, diffY);
-            mat.SetColumn(2, (diffX.crossProduct(diffY)).normalisedCopy()); // Old version: mat.SetColumn(2, nodes[loc.nz].AbsPosition-nodes[loc.ref].AbsPosition);
+                mat.SetColumn(0, diffX);
+                mat.SetColumn(1, diffY);
+                mat.SetColumn(2, (diffX.crossProduct(diffY)).normalisedCopy()); // Old version: mat.SetColumn(2, nodes[loc.nz]-nodes[loc.ref]);
 
-            mat = mat.Inverse();
+                mat = mat.Inverse();
 
-            //compute coordinates in the newly formed Euclidean basis
-            m_locators[i].coords = mat * (vertices[i] - nodes[m_locators[i].ref].AbsPosition);
+                //compute coordinates in the newly formed Euclidean basis
+                loc.coords = mat * (vertices[i] - nodes[loc.ref]);
 
-            // that's it!
+                // that's it!
+            }
+        };
+        TaskBatch locate_batch;
+        const int num_batches = ((int)m_vertex_count + FLEXBODY_LOCATOR_BATCH_SIZE - 1) / FLEXBODY_LOCATOR_BATCH_SIZE;
+        App::GetThreadPool()->ParallelFor(locate_batch, num_batches, locate_func);
+
+        for (int i=0; i<(int)m_vertex_count; i++)
+        {
+            if (m_locators[i].is_forvert)
+            {
+                LOG(fmt::format("FLEXBODY vertex {} overriden for nodes REF:{}, VX:{}, VY:{}",
+                    i, m_locators[i].ref, m_locators[i].nx, m_locators[i].ny));
+            }
+        }
+        if (num_ref_errors > 0)
+        {
+            LOG(fmt::format("FLEXBODY ERROR on mesh {}: REF node not found ({} vertices)", mesh_name, num_ref_errors.load()));
+        }
+        if (num_vx_errors > 0)
+        {
+            LOG(fmt::format("FLEXBODY ERROR on mesh {}: VX node not found ({} vertices)", mesh_name, num_vx_errors.load()));
+        }
+        if (num_vy_errors > 0)
+        {
+            LOG(fmt::format("FLEXBODY ERROR on mesh {}: VY node not found ({} vertices)", mesh_name, num_vy_errors.load()));
         }
 
     } // if (preloaded_from_cache == nullptr)
@@ -506,12 +532,12 @@ FlexBody::FlexBody(
         for (int i=0; i<(int)m_vertex_count; i++)
         {
             Matrix3 mat;
-            Vector3 diffX = nodes[m_locators[i].nx].AbsPosition-nodes[m_locators[i].ref].AbsPosition;
-            Vector3 diffY = nodes[m_locators[i].ny].AbsPosition-nodes[m_locators[i].ref].AbsPosition;
+            Vector3 diffX = nodes[m_locators[i].nx]-nodes[m_locators[i].ref];
+            Vector3 diffY = nodes[m_locators[i].ny]-nodes[m_locators[i].ref];
 
             mat.SetColumn(0, diffX);
             mat.SetColumn(1, diffY);
-            mat.SetColumn(2, diffX.crossProduct(diffY).normalisedCopy()); // Old version: mat.SetColumn(2, nodes[loc.nz].AbsPosition-nodes[loc.ref].AbsPosition);
+            mat.SetColumn(2, diffX.crossProduct(diffY).normalisedCopy()); // Old version: mat.SetColumn(2, nodes[loc.nz]-nodes[loc.ref]);
 
             mat = mat.Inverse();
 
@@ -528,12 +554,23 @@ FlexBody::FlexBody(
         m_forset_nodes.push_back((NodeNum_t)nodenum);
     }
 
-    if (App::GetConsole()->cVarGet("flexbody_defrag_enabled", CVAR_TYPE_BOOL)->getBool()
+    if (preloaded_from_cache != nullptr)
+    {
+        // The cached locators are already in defragmented order, only the fresh mesh needs reordering.
+        if (preloaded_from_cache->defrag_lookup != nullptr)
+        {
+            m_defrag_lookup.assign(preloaded_from_cache->defrag_lookup, preloaded_from_cache->defrag_lookup + m_vertex_count);
+            this->reorderMeshVertices(m_defrag_lookup);
+        }
+    }
+    else if (App::GetConsole()->cVarGet("flexbody_defrag_enabled", CVAR_TYPE_BOOL)->getBool()
         // For simplicity, only take 1-submesh meshes (almost always the case anyway)
         && m_scene_entity->getMesh()->getNumSubMeshes() == 1)
     {
         this->defragmentFlexbodyMesh();
     }
+
+    this->buildLocatorArrays();
 }
 
 FlexBody::FlexBody(PlaceholderType p_type, FlexbodyID_t id, const std::string& orig_meshname)
@@ -546,10 +583,14 @@ FlexBody::FlexBody(PlaceholderType p_type, FlexbodyID_t id, const std::string& o
 
 FlexBody::~FlexBody()
 {
-    // Stuff using <new>
-    if (m_locators != nullptr) { delete[] m_locators; }
+    if (!m_shares_cache_data)
+    {
+        // Stuff using <new>
+        if (m_locators != nullptr) { delete[] m_locators; }
+        // Stuff using malloc()
+        if (m_src_normals != nullptr) { free(m_src_normals); }
+    }
     // Stuff using malloc()
-    if (m_src_normals != nullptr) { free(m_src_normals); }
     if (m_dst_normals != nullptr) { free(m_dst_normals); }
     if (m_dst_pos     != nullptr) { free(m_dst_pos    ); }
     if (m_src_colors  != nullptr) { free(m_src_colors ); }
@@ -617,44 +658,216 @@ void FlexBody::setFlexbodyCastShadow(bool val)
         m_scene_entity->setCastShadows(val);
 }
 
-void FlexBody::computeFlexbody()
+void FlexBody::buildLocatorArrays()
 {
-    if (m_has_texture_blend) updateBlend();
+    m_loc_ref3.resize(m_vertex_count);
+    m_loc_nx3.resize(m_vertex_count);
+    m_loc_ny3.resize(m_vertex_count);
+    for (int axis = 0; axis < 3; axis++)
+    {
+        m_loc_coords[axis].resize(m_vertex_count);
+        m_loc_src_normals[axis].resize(m_vertex_count);
+    }
+
+    for (size_t i = 0; i < m_vertex_count; i++)
+    {
+        m_loc_ref3[i] = static_cast<int32_t>(m_locators[i].ref) * 3;
+        m_loc_nx3[i] = static_cast<int32_t>(m_locators[i].nx) * 3;
+        m_loc_ny3[i] = static_cast<int32_t>(m_locators[i].ny) * 3;
+        for (int axis = 0; axis < 3; axis++)
+        {
+            m_loc_coords[axis][i] = m_locators[i].coords[axis];
+            m_loc_src_normals[axis][i] = m_src_normals[i][axis];
+        }
+    }
+}
 
-    RoR::NodeSB* nodes = m_gfx_actor->GetSimNodeBuffer();
+void FlexBody::computeFlexbody()
+{
+    this->computeFlexbodyCenter();
+    this->computeFlexbodyRange(0, static_cast<int>(m_vertex_count));
+}
 
+Ogre::Vector3 FlexBody::calcFlexitCenter(const Ogre::Vector3* nodes)
+{
     // compute the local center
     if (m_node_center >= 0)
     {
-        Vector3 diffX = nodes[m_node_x].AbsPosition - nodes[m_node_center].AbsPosition;
-        Vector3 diffY = nodes[m_node_y].AbsPosition - nodes[m_node_center].AbsPosition;
+        Vector3 diffX = nodes[m_node_x] - nodes[m_node_center];
+        Vector3 diffY = nodes[m_node_y] - nodes[m_node_center];
         Ogre::Vector3 flexit_normal = fast_normalise(diffY.crossProduct(diffX));
 
-        m_flexit_center = nodes[m_node_center].AbsPosition + m_center_offset.x * diffX + m_center_offset.y * diffY;
-        m_flexit_center += m_center_offset.z * flexit_normal;
+        Ogre::Vector3 center = nodes[m_node_center] + m_center_offset.x * diffX + m_center_offset.y * diffY;
+        center += m_center_offset.z * flexit_normal;
+        return center;
     }
     else
     {
-        m_flexit_center = nodes[0].AbsPosition;
+        return nodes[0];
     }
+}
 
-    for (int i=0; i<(int)m_vertex_count; i++)
+bool FlexBody::computeNodeFrame(Ogre::Quaternion& out_orientation)
+{
+    const Ogre::Vector3* nodes = m_gfx_actor->GetSimNodePositions();
+    Vector3 x_axis = nodes[m_node_x] - nodes[m_node_center];
+    Vector3 z_axis = x_axis.crossProduct(nodes[m_node_y] - nodes[m_node_center]);
+    if (x_axis.squaredLength() < 1e-8f || z_axis.squaredLength() < 1e-12f)
+        return false;
+
+    x_axis.normalise();
+    z_axis.normalise();
+    out_orientation.FromAxes(x_axis, z_axis.crossProduct(x_axis), z_axis);
+    return true;
+}
+
+void FlexBody::computeFlexbodyCenter()
+{
+    const Ogre::Vector3* nodes = m_gfx_actor->GetSimNodePositions();
+    m_flexit_center = this->calcFlexitCenter(nodes);
+
+    // Update LOD: remember the node frame the vertices are about to be deformed in.
+    m_lod_rigid = false;
+    m_lod_frames_since_full_update = 0;
+    if (this->computeNodeFrame(m_lod_full_update_frame))
     {
-        Vector3 diffX = nodes[m_locators[i].nx].AbsPosition - nodes[m_locators[i].ref].AbsPosition;
-        Vector3 diffY = nodes[m_locators[i].ny].AbsPosition - nodes[m_locators[i].ref].AbsPosition;
-        Vector3 nCross = fast_normalise(diffX.crossProduct(diffY)); //nCross.normalise();
+        const Ogre::Quaternion to_local = m_lod_full_update_frame.Inverse();
+        m_lod_forset_local.resize(m_forset_nodes.size());
+        for (size_t i = 0; i < m_forset_nodes.size(); i++)
+        {
+            m_lod_forset_local[i] = to_local * (nodes[m_forset_nodes[i]] - m_flexit_center);
+        }
+    }
+    else
+    {
+        m_lod_frames_since_full_update = INT_MAX; // Rigid updates not possible
+    }
+}
 
-        m_dst_pos[i].x = diffX.x * m_locators[i].coords.x + diffY.x * m_locators[i].coords.y + nCross.x * m_locators[i].coords.z;
-        m_dst_pos[i].y = diffX.y * m_locators[i].coords.x + diffY.y * m_locators[i].coords.y + nCross.y * m_locators[i].coords.z;
-        m_dst_pos[i].z = diffX.z * m_locators[i].coords.x + diffY.z * m_locators[i].coords.y + nCross.z * m_locators[i].coords.z;
+bool FlexBody::updateRigidTransform(float max_error)
+{
+    if (m_lod_frames_since_full_update == INT_MAX)
+        return false;
+
+    Ogre::Quaternion frame;
+    if (!this->computeNodeFrame(frame))
+        return false;
+
+    // Did the body deform since? (damage, suspension travel...)
+    const Ogre::Vector3* nodes = m_gfx_actor->GetSimNodePositions();
+    const Ogre::Vector3 center = this->calcFlexitCenter(nodes);
+    const Ogre::Quaternion to_local = frame.Inverse();
+    const float max_error_sq = max_error * max_error;
+    for (size_t i = 0; i < m_forset_nodes.size(); i++)
+    {
+        const Ogre::Vector3 local = to_local * (nodes[m_forset_nodes[i]] - center);
+        if (local.squaredDistance(m_lod_forset_local[i]) > max_error_sq)
+            return false;
+    }
 
-        m_dst_pos[i] += nodes[m_locators[i].ref].AbsPosition - m_flexit_center;
+    m_flexit_center = center;
+    m_lod_rigid_rotation = frame * m_lod_full_update_frame.Inverse();
+    m_lod_rigid = true;
+    m_lod_frames_since_full_update++;
+    return true;
+}
 
-        m_dst_normals[i].x = diffX.x * m_src_normals[i].x + diffY.x * m_src_normals[i].y + nCross.x * m_src_normals[i].z;
-        m_dst_normals[i].y = diffX.y * m_src_normals[i].x + diffY.y * m_src_normals[i].y + nCross.y * m_src_normals[i].z;
-        m_dst_normals[i].z = diffX.z * m_src_normals[i].x + diffY.z * m_src_normals[i].y + nCross.z * m_src_normals[i].z;
+#if defined(__AVX2__)
+static inline __m256 FlexbodyInvLength(__m256 x, __m256 y, __m256 z)
+{
+    // rsqrt estimate + 1 Newton-Raphson step, like `fast_invSqrt()`; clamped so that zero vectors stay zero.
+    const __m256 len2 = _mm256_max_ps(_mm256_fmadd_ps(x, x, _mm256_fmadd_ps(y, y, _mm256_mul_ps(z, z))), _mm256_set1_ps(1e-30f));
+    const __m256 est = _mm256_rsqrt_ps(len2);
+    const __m256 half_len2_est2 = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), len2), _mm256_mul_ps(est, est));
+    return _mm256_mul_ps(est, _mm256_sub_ps(_mm256_set1_ps(1.5f), half_len2_est2));
+}
+#endif // __AVX2__
 
-        m_dst_normals[i] = fast_normalise(m_dst_normals[i]);
+void FlexBody::computeFlexbodyRange(int begin, int end)
+{
+    if (m_has_texture_blend) updateBlend(begin, end);
+
+    static_assert(sizeof(Ogre::Vector3) == 3 * sizeof(float), "Node positions are read as a flat float array");
+    const float* node_floats = m_gfx_actor->GetSimNodePositions()->ptr();
+    const int32_t* ref3 = m_loc_ref3.data();
+    const int32_t* nx3 = m_loc_nx3.data();
+    const int32_t* ny3 = m_loc_ny3.data();
+    const float* cx = m_loc_coords[0].data();
+    const float* cy = m_loc_coords[1].data();
+    const float* cz = m_loc_coords[2].data();
+    const float* snx = m_loc_src_normals[0].data();
+    const float* sny = m_loc_src_normals[1].data();
+    const float* snz = m_loc_src_normals[2].data();
+
+    int i = begin;
+
+#if defined(__AVX2__)
+    // 8 vertices at once: gather the locator nodes, then it's all vertical math.
+    const __m256 center_x = _mm256_set1_ps(m_flexit_center.x);
+    const __m256 center_y = _mm256_set1_ps(m_flexit_center.y);
+    const __m256 center_z = _mm256_set1_ps(m_flexit_center.z);
+    alignas(32) float out[6][8];
+    for (; i + 8 <= end; i += 8)
+    {
+        const __m256i vref = _mm256_loadu_si256((const __m256i*)(ref3 + i));
+        const __m256i vnx = _mm256_loadu_si256((const __m256i*)(nx3 + i));
+        const __m256i vny = _mm256_loadu_si256((const __m256i*)(ny3 + i));
+
+        const __m256 ref_x = _mm256_i32gather_ps(node_floats + 0, vref, 4);
+        const __m256 ref_y = _mm256_i32gather_ps(node_floats + 1, vref, 4);
+        const __m256 ref_z = _mm256_i32gather_ps(node_floats + 2, vref, 4);
+        const __m256 dx_x = _mm256_sub_ps(_mm256_i32gather_ps(node_floats + 0, vnx, 4), ref_x);
+        const __m256 dx_y = _mm256_sub_ps(_mm256_i32gather_ps(node_floats + 1, vnx, 4), ref_y);
+        const __m256 dx_z = _mm256_sub_ps(_mm256_i32gather_ps(node_floats + 2, vnx, 4), ref_z);
+        const __m256 dy_x = _mm256_sub_ps(_mm256_i32gather_ps(node_floats + 0, vny, 4), ref_x);
+        const __m256 dy_y = _mm256_sub_ps(_mm256_i32gather_ps(node_floats + 1, vny, 4), ref_y);
+        const __m256 dy_z = _mm256_sub_ps(_mm256_i32gather_ps(node_floats + 2, vny, 4), ref_z);
+
+        // nCross = normalise(diffX x diffY)
+        __m256 nc_x = _mm256_fmsub_ps(dx_y, dy_z, _mm256_mul_ps(dx_z, dy_y));
+        __m256 nc_y = _mm256_fmsub_ps(dx_z, dy_x, _mm256_mul_ps(dx_x, dy_z));
+        __m256 nc_z = _mm256_fmsub_ps(dx_x, dy_y, _mm256_mul_ps(dx_y, dy_x));
+        const __m256 nc_inv = FlexbodyInvLength(nc_x, nc_y, nc_z);
+        nc_x = _mm256_mul_ps(nc_x, nc_inv);
+        nc_y = _mm256_mul_ps(nc_y, nc_inv);
+        nc_z = _mm256_mul_ps(nc_z, nc_inv);
+
+        const __m256 c_x = _mm256_loadu_ps(cx + i);
+        const __m256 c_y = _mm256_loadu_ps(cy + i);
+        const __m256 c_z = _mm256_loadu_ps(cz + i);
+        _mm256_store_ps(out[0], _mm256_fmadd_ps(dx_x, c_x, _mm256_fmadd_ps(dy_x, c_y, _mm256_fmadd_ps(nc_x, c_z, _mm256_sub_ps(ref_x, center_x)))));
+        _mm256_store_ps(out[1], _mm256_fmadd_ps(dx_y, c_x, _mm256_fmadd_ps(dy_y, c_y, _mm256_fmadd_ps(nc_y, c_z, _mm256_sub_ps(ref_y, center_y)))));
+        _mm256_store_ps(out[2], _mm256_fmadd_ps(dx_z, c_x, _mm256_fmadd_ps(dy_z, c_y, _mm256_fmadd_ps(nc_z, c_z, _mm256_sub_ps(ref_z, center_z)))));
+
+        const __m256 n_x = _mm256_loadu_ps(snx + i);
+        const __m256 n_y = _mm256_loadu_ps(sny + i);
+        const __m256 n_z = _mm256_loadu_ps(snz + i);
+        const __m256 dn_x = _mm256_fmadd_ps(dx_x, n_x, _mm256_fmadd_ps(dy_x, n_y, _mm256_mul_ps(nc_x, n_z)));
+        const __m256 dn_y = _mm256_fmadd_ps(dx_y, n_x, _mm256_fmadd_ps(dy_y, n_y, _mm256_mul_ps(nc_y, n_z)));
+        const __m256 dn_z = _mm256_fmadd_ps(dx_z, n_x, _mm256_fmadd_ps(dy_z, n_y, _mm256_mul_ps(nc_z, n_z)));
+        const __m256 dn_inv = FlexbodyInvLength(dn_x, dn_y, dn_z);
+        _mm256_store_ps(out[3], _mm256_mul_ps(dn_x, dn_inv));
+        _mm256_store_ps(out[4], _mm256_mul_ps(dn_y, dn_inv));
+        _mm256_store_ps(out[5], _mm256_mul_ps(dn_z, dn_inv));
+
+        // Output stays interleaved (xyz) - it's uploaded to the vertex buffers as-is.
+        for (int k = 0; k < 8; k++)
+        {
+            m_dst_pos[i + k] = Vector3(out[0][k], out[1][k], out[2][k]);
+            m_dst_normals[i + k] = Vector3(out[3][k], out[4][k], out[5][k]);
+        }
+    }
+#endif // __AVX2__
+
+    for (; i < end; i++)
+    {
+        const Vector3 ref_pos(node_floats + ref3[i]);
+        const Vector3 diffX = Vector3(node_floats + nx3[i]) - ref_pos;
+        const Vector3 diffY = Vector3(node_floats + ny3[i]) - ref_pos;
+        const Vector3 nCross = fast_normalise(diffX.crossProduct(diffY));
+
+        m_dst_pos[i] = diffX * cx[i] + diffY * cy[i] + nCross * cz[i] + (ref_pos - m_flexit_center);
+        m_dst_normals[i] = fast_normalise(diffX * snx[i] + diffY * sny[i] + nCross * snz[i]);
     }
 }
 
@@ -663,6 +876,14 @@ void FlexBody::updateFlexbodyVertexBuffers()
     if (!m_scene_node) // Disabled via addonpart/tuneup
         return;
 
+    if (m_lod_rigid)
+    {
+        // Vertices weren't recomputed, just move the mesh along with the node frame.
+        m_scene_node->setOrientation(m_lod_rigid_rotation);
+        m_scene_node->setPosition(m_flexit_center);
+        return;
+    }
+
     Vector3 *ppt = m_dst_pos;
     Vector3 *npt = m_dst_normals;
     if (m_uses_shared_vertex_data)
@@ -686,6 +907,7 @@ void FlexBody::updateFlexbodyVertexBuffers()
         m_blend_changed = false;
     }
 
+    m_scene_node->setOrientation(Ogre::Quaternion::IDENTITY);
     m_scene_node->setPosition(m_flexit_center);
 }
 
@@ -714,21 +936,22 @@ void FlexBody::writeBlend()
     }
 }
 
-void FlexBody::updateBlend() //so easy!
+void FlexBody::updateBlend(int begin, int end) //so easy!
 {
-    RoR::NodeSB* nodes = m_gfx_actor->GetSimNodeBuffer();
-    for (int i=0; i<(int)m_vertex_count; i++)
+    const RoR::NodeBufferSB& nodes = m_gfx_actor->GetSimNodeBuffer();
+    for (int i=begin; i<end; i++)
     {
-        RoR::NodeSB *nd = &nodes[m_locators[i].ref];
+        const NodeNum_t ref = m_locators[i].ref;
+        const bool is_wet = nodes.IsWet(ref);
         ARGB col = m_src_colors[i];
-        if (nd->nd_has_contact && !(col&0xFF000000))
+        if (nodes.HasContact(ref) && !(col&0xFF000000))
         {
             m_src_colors[i]=col|0xFF000000;
             m_blend_changed = true;
         }
-        if (nd->nd_is_wet ^ ((col&0x000000FF)>0))
+        if (is_wet ^ ((col&0x000000FF)>0))
         {
-            m_src_colors[i]=(col&0xFFFFFF00)+0x000000FF*nd->nd_is_wet;
+            m_src_colors[i]=(col&0xFFFFFF00)+0x000000FF*is_wet;
             m_blend_changed = true;
         }
     }
@@ -859,6 +1082,12 @@ void FlexBody::defragmentFlexbodyMesh()
         }
     }
 
+    m_defrag_lookup = new_index_lookup; // For the flexbody cache
+    this->reorderMeshVertices(new_index_lookup);
+}
+
+void FlexBody::reorderMeshVertices(std::vector<int> const& new_index_lookup)
+{
     // REORDERING VERTICES
     // * positions/normals are calculated, no action needed.
     // * texcoords (aka UV-coords) must be fixed.
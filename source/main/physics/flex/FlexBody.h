@@ -30,6 +30,10 @@
 #include "Utils.h"
 
 #include <Ogre.h>
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <memory>
 
 namespace RoR {
 
@@ -79,10 +83,19 @@ public:
     ~FlexBody();
 
     void reset();
-    void updateBlend();
+    void updateBlend(int begin, int end);
     void writeBlend();
 
     void computeFlexbody(); //!< Updates mesh deformation; works on CPU using local copy of vertex data.
+    void computeFlexbodyCenter();                  //!< Split update, step 1: run once, before the ranges.
+    void computeFlexbodyRange(int begin, int end); //!< Split update, step 2: vertex ranges may run in parallel.
+
+    /// Update LOD: instead of deforming, move the last deformed mesh rigidly along with its node frame (ref/x/y nodes).
+    /// @param max_error World-space tolerance; if forset nodes moved more than this relative to the frame (damage, flexing),
+    ///                  nothing is done and false is returned - the caller must do a full update.
+    bool updateRigidTransform(float max_error);
+    int  getFramesSinceFullUpdate() const { return m_lod_frames_since_full_update; }
+    Ogre::Vector3 getFlexitCenter() const { return m_flexit_center; }
     void updateFlexbodyVertexBuffers();
 
     bool isVisible() const;
@@ -91,8 +104,8 @@ public:
     void setFlexbodyCastShadow(bool val);
 
     int getVertexCount() { return static_cast<int>(m_vertex_count); };
-    Locator_t& getVertexLocator(int vert) { ROR_ASSERT((size_t)vert < m_vertex_count); return m_locators[vert]; }
-    Ogre::Vector3 getVertexPos(int vert) { ROR_ASSERT((size_t)vert < m_vertex_count); return m_dst_pos[vert] + m_flexit_center; }
+    const Locator_t& getVertexLocator(int vert) const { ROR_ASSERT((size_t)vert < m_vertex_count); return m_locators[vert]; }
+    Ogre::Vector3 getVertexPos(int vert) { ROR_ASSERT((size_t)vert < m_vertex_count); return (m_lod_rigid ? m_lod_rigid_rotation * m_dst_pos[vert] : m_dst_pos[vert]) + m_flexit_center; }
     Ogre::Entity* getEntity() { return m_scene_entity; }
     const std::string& getOrigMeshName() const { return m_orig_mesh_name; }
     std::vector<NodeNum_t>& getForsetNodes() { return m_forset_nodes; };
@@ -110,6 +123,10 @@ public:
 private:
 
     void defragmentFlexbodyMesh();
+    void reorderMeshVertices(std::vector<int> const& new_index_lookup); //!< Applies the vertex order found by `defragmentFlexbodyMesh()` to the Ogre mesh.
+    void buildLocatorArrays();
+    bool computeNodeFrame(Ogre::Quaternion& out_orientation); //!< Orientation of the ref/x/y node triangle; false if degenerate.
+    Ogre::Vector3 calcFlexitCenter(const Ogre::Vector3* nodes);
 
     RoR::GfxActor*    m_gfx_actor = nullptr;
     size_t            m_vertex_count = 0;
@@ -123,6 +140,20 @@ private:
     Ogre::ARGB*       m_src_colors = nullptr;
     Locator_t*        m_locators = nullptr; //!< 1 loc per vertex
 
+    // Flexbody cache, see `FlexFactory`
+    bool                               m_shares_cache_data = false; //!< `m_locators` and `m_src_normals` point to read-only shared memory, don't modify or free.
+    std::shared_ptr<FlexBodyCacheFile> m_cache_file;                //!< Keeps the shared data alive.
+    uint64_t                           m_cache_key_hash = 0;
+    std::vector<int>                   m_defrag_lookup;             //!< Vertex order from `defragmentFlexbodyMesh()`, empty if not defragmented.
+
+    // Locators and source normals in structure-of-arrays layout, for `computeFlexbodyRange()`.
+    // Built from `m_locators` and `m_src_normals` once they're final (after defragmentation).
+    std::vector<int32_t> m_loc_ref3;            //!< Node index * 3 = offset of X in the node position floats.
+    std::vector<int32_t> m_loc_nx3;
+    std::vector<int32_t> m_loc_ny3;
+    std::vector<float>   m_loc_coords[3];
+    std::vector<float>   m_loc_src_normals[3];
+
     NodeNum_t         m_node_center = NODENUM_INVALID;
     NodeNum_t         m_node_x = NODENUM_INVALID;
     NodeNum_t         m_node_y = NODENUM_INVALID;
@@ -145,7 +176,14 @@ private:
     bool m_uses_shared_vertex_data = false;
     bool m_has_texture = true;
     bool m_has_texture_blend = true;
-    bool m_blend_changed = false;
+    std::atomic<bool> m_blend_changed{false}; //!< Set by parallel `updateBlend()` ranges.
+
+    // Update LOD, see `updateRigidTransform()`
+    int                        m_lod_frames_since_full_update = INT_MAX;
+    bool                       m_lod_rigid = false;                             //!< Vertices are stale, `m_lod_rigid_rotation` applies.
+    Ogre::Quaternion           m_lod_full_update_frame = Ogre::Quaternion::IDENTITY; //!< Node frame at the last full update.
+    Ogre::Quaternion           m_lod_rigid_rotation = Ogre::Quaternion::IDENTITY;
+    std::vector<Ogre::Vector3> m_lod_forset_local;                              //!< Forset node positions in the node frame at the last full update.
 
     // Diagnostic data, not used for calculations
     std::vector<NodeNum_t> m_forset_nodes;
@@ -33,10 +33,13 @@
 #include "PlatformUtils.h"
 #include "RigDef_File.h"
 #include "ActorSpawner.h"
+#include "TuneupFileFormat.h"
 
 #include <OgreMeshManager.h>
 #include <OgreSceneManager.h>
 #include <MeshLodGenerator/OgreMeshLodGenerator.h>
+#include <cstdio>
+#include <cstring>
 
 //#define FLEXFACTORY_DEBUG_LOGGING
 
@@ -51,6 +54,7 @@ using namespace RoR;
 
 // Static
 const char * FlexBodyFileIO::SIGNATURE = "RoR FlexBody";
+std::map<uint64_t, std::weak_ptr<FlexBodyCacheFile>> FlexFactory::s_loaded_cache_files;
 
 FlexFactory::FlexFactory(ActorSpawner* rig_spawner):
     m_rig_spawner(rig_spawner),
@@ -81,10 +85,24 @@ FlexBody* FlexFactory::CreateFlexBody(
 
     FLEX_DEBUG_LOG(__FUNCTION__);
     FlexBodyCacheData* from_cache = nullptr;
+    uint64_t key_hash = 0;
+    if (m_is_flexbody_cache_enabled)
+    {
+        key_hash = CalcFlexbodyKeyHash(ref_node, x_node, y_node, offset, rotation, node_indices, forvert_data, mesh);
+    }
     if (m_is_flexbody_cache_loaded)
     {
         FLEX_DEBUG_LOG(__FUNCTION__ " >> Get entry from cache ");
-        from_cache = m_flexbody_cache.GetLoadedItem(m_flexbody_cache_next_index);
+        if (m_flexbody_cache_next_index < m_flexbody_cache_file->GetNumRecords()
+            && m_flexbody_cache_file->GetRecord(m_flexbody_cache_next_index)->header.key_hash == key_hash
+            && BITMASK_IS_0(m_flexbody_cache_file->GetRecord(m_flexbody_cache_next_index)->header.flags, FlexBodyRecordHeader::IS_FAULTY))
+        {
+            from_cache = m_flexbody_cache_file->GetRecord(m_flexbody_cache_next_index);
+        }
+        else
+        {
+            m_is_flexbody_cache_stale = true;
+        }
         m_flexbody_cache_next_index++;
     }
 
@@ -106,6 +124,11 @@ FlexBody* FlexFactory::CreateFlexBody(
 
     if (m_is_flexbody_cache_enabled)
     {
+        if (from_cache != nullptr)
+        {
+            new_flexbody->m_cache_file = m_flexbody_cache_file; // Keeps the shared data mapped.
+        }
+        new_flexbody->m_cache_key_hash = key_hash;
         m_flexbody_cache.AddItemToSave(new_flexbody);
     }
     new_flexbody->m_id = flexbody_id;
@@ -152,64 +175,141 @@ FlexMeshWheel* FlexFactory::CreateFlexMeshWheel(
     return flex_mesh_wheel;
 }
 
-void FlexBodyFileIO::WriteToFile(void* source, size_t length)
+static const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+static const uint64_t FNV_PRIME = 1099511628211ull;
+
+static uint64_t HashBytes(uint64_t hash, const void* data, size_t length)
 {
-    size_t num_written = fwrite(source, length, 1, m_file);
-    if (num_written != 1)
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < length; i++)
     {
-        FLEX_DEBUG_LOG(__FUNCTION__ " >> EXCEPTION!! ");
-        throw RESULT_CODE_FWRITE_OUTPUT_INCOMPLETE;
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
     }
+    return hash;
 }
 
-void FlexBodyFileIO::ReadFromFile(void* dest, size_t length)
+template <typename T> static uint64_t HashValue(uint64_t hash, T const& value)
 {
-    size_t num_written = fread(dest, length, 1, m_file);
-    if (num_written != 1)
+    return HashBytes(hash, &value, sizeof(T));
+}
+
+static uint64_t HashString(uint64_t hash, std::string const& str)
+{
+    return HashBytes(hash, str.c_str(), str.size() + 1);
+}
+
+uint64_t FlexFactory::CalcCacheValidationHash()
+{
+    const ActorPtr& actor = m_rig_spawner->GetActor();
+    uint64_t hash = FNV_OFFSET_BASIS;
+    hash = HashValue(hash, static_cast<uint32_t>(FlexBodyFileIO::FILE_FORMAT_VERSION));
+    hash = HashValue(hash, sizeof(Locator_t));
+    hash = HashValue(hash, sizeof(FlexBodyRecordHeader));
+    hash = HashString(hash, actor->getTruckFileName());
+    if (actor->getUsedActorEntry())
     {
-        FLEX_DEBUG_LOG(__FUNCTION__ " >> EXCEPTION!! ");
-        throw RESULT_CODE_FREAD_OUTPUT_INCOMPLETE;
+        hash = HashString(hash, actor->getUsedActorEntry()->resource_bundle_path);
+        hash = HashValue(hash, static_cast<int64_t>(actor->getUsedActorEntry()->filetime));
     }
+    hash = HashString(hash, actor->getSectionConfig());
+    if (actor->getWorkingTuneupDef())
+    {
+        for (std::string const& addonpart: actor->getWorkingTuneupDef()->use_addonparts)
+        {
+            hash = HashString(hash, addonpart);
+        }
+    }
+    hash = HashValue(hash, App::flexbody_defrag_enabled->getBool());
+    hash = HashValue(hash, App::flexbody_defrag_const_penalty->getInt());
+    hash = HashValue(hash, App::flexbody_defrag_prog_down_penalty->getInt());
+    hash = HashValue(hash, App::flexbody_defrag_invert_lookup->getBool());
+    return hash;
 }
 
-void FlexBodyFileIO::WriteSignature()
+uint64_t FlexFactory::CalcFlexbodyKeyHash(
+    NodeNum_t ref_node, NodeNum_t x_node, NodeNum_t y_node, Ogre::Vector3 offset, Ogre::Vector3 rotation,
+    std::vector<unsigned int>& node_indices, std::vector<ForvertTempData>& forvert_data, Ogre::MeshPtr& mesh)
 {
-    FLEX_DEBUG_LOG(__FUNCTION__);
-    WriteToFile((void*)SIGNATURE, (strlen(SIGNATURE) + 1) * sizeof(char));
+    // Mesh names can't be used, generated meshes (tires) are named after the actor instance.
+    size_t vertex_count = (mesh->sharedVertexData) ? mesh->sharedVertexData->vertexCount : 0;
+    for (unsigned short i = 0; i < mesh->getNumSubMeshes(); i++)
+    {
+        if (!mesh->getSubMesh(i)->useSharedVertices)
+        {
+            vertex_count += mesh->getSubMesh(i)->vertexData->vertexCount;
+        }
+    }
+
+    uint64_t hash = FNV_OFFSET_BASIS;
+    hash = HashValue(hash, ref_node);
+    hash = HashValue(hash, x_node);
+    hash = HashValue(hash, y_node);
+    hash = HashValue(hash, offset);
+    hash = HashValue(hash, rotation);
+    hash = HashBytes(hash, node_indices.data(), node_indices.size() * sizeof(unsigned int));
+    for (ForvertTempData const& forvert: forvert_data)
+    {
+        hash = HashValue(hash, forvert.nref);
+        hash = HashValue(hash, forvert.nx);
+        hash = HashValue(hash, forvert.ny);
+        hash = HashValue(hash, forvert.vert_index);
+    }
+    hash = HashValue(hash, vertex_count);
+    hash = HashValue(hash, mesh->getBounds().getMinimum());
+    hash = HashValue(hash, mesh->getBounds().getMaximum());
+    return hash;
 }
 
-void FlexBodyFileIO::ReadAndCheckSignature()
+void FlexBodyFileIO::WriteToFile(const void* source, size_t length)
 {
-    FLEX_DEBUG_LOG(__FUNCTION__);
-    char signature[25];
-    this->ReadFromFile((void*)&signature, (strlen(SIGNATURE) + 1) * sizeof(char));
-    if (strcmp(SIGNATURE, signature) != 0)
+    size_t num_written = fwrite(source, length, 1, m_file);
+    if (num_written != 1)
+    {
+        FLEX_DEBUG_LOG(__FUNCTION__ " >> EXCEPTION!! ");
+        throw RESULT_CODE_FWRITE_OUTPUT_INCOMPLETE;
+    }
+    if (m_file_pos >= SIGNATURE_SIZE + sizeof(FlexBodyFileMetadata))
     {
-        throw RESULT_CODE_ERR_SIGNATURE_MISMATCH;
+        m_file_checksum = HashBytes(m_file_checksum, source, length);
     }
+    m_file_pos += length;
 }
 
-void FlexBodyFileIO::WriteMetadata()
+void FlexBodyFileIO::WritePadding()
 {
-    FLEX_DEBUG_LOG(__FUNCTION__);
-    FlexBodyFileMetadata meta;
-    meta.file_format_version = FILE_FORMAT_VERSION;    
-    meta.num_flexbodies      = static_cast<int>(m_items_to_save.size());
+    static const uint8_t zeros[DATA_ALIGNMENT] = {};
+    const size_t padding = (DATA_ALIGNMENT - (m_file_pos % DATA_ALIGNMENT)) % DATA_ALIGNMENT;
+    if (padding > 0)
+    {
+        this->WriteToFile(zeros, padding);
+    }
+}
 
-    this->WriteToFile((void*)&meta, sizeof(FlexBodyFileMetadata));
+void FlexBodyFileIO::WriteSignature()
+{
+    FLEX_DEBUG_LOG(__FUNCTION__);
+    char signature[SIGNATURE_SIZE] = {};
+    strncpy(signature, SIGNATURE, SIGNATURE_SIZE - 1);
+    this->WriteToFile(signature, SIGNATURE_SIZE);
 }
 
-void FlexBodyFileIO::ReadMetadata(FlexBodyFileMetadata* meta)
+void FlexBodyFileIO::WriteMetadata(uint64_t data_checksum)
 {
     FLEX_DEBUG_LOG(__FUNCTION__);
-    ROR_ASSERT(meta != nullptr);
-    this->ReadFromFile((void*)meta, sizeof(FlexBodyFileMetadata));
+    FlexBodyFileMetadata meta;
+    meta.file_format_version = FILE_FORMAT_VERSION;
+    meta.num_flexbodies      = static_cast<uint32_t>(m_items_to_save.size());
+    meta.validation_hash     = m_validation_hash;
+    meta.data_checksum       = data_checksum;
+
+    this->WriteToFile(&meta, sizeof(FlexBodyFileMetadata));
 }
 
-void FlexBodyFileIO::WriteFlexbodyHeader(FlexBody* flexbody)
+void FlexBodyFileIO::WriteFlexbodyHeader(FlexBody* flexbody, uint64_t& data_offset)
 {
     FLEX_DEBUG_LOG(__FUNCTION__);
     FlexBodyRecordHeader header;
+    header.key_hash                = flexbody->m_cache_key_hash;
     header.vertex_count            = static_cast<int>(flexbody->m_vertex_count);
     header.node_center             = flexbody->m_node_center            ;
     header.node_x                  = flexbody->m_node_x                 ;
@@ -222,101 +322,71 @@ void FlexBodyFileIO::WriteFlexbodyHeader(FlexBody* flexbody)
     if (flexbody->m_uses_shared_vertex_data) BITMASK_SET_1(header.flags, FlexBodyRecordHeader::USES_SHARED_VERTEX_DATA);
     if (flexbody->m_has_texture            ) BITMASK_SET_1(header.flags, FlexBodyRecordHeader::HAS_TEXTURE);
     if (flexbody->m_has_texture_blend      ) BITMASK_SET_1(header.flags, FlexBodyRecordHeader::HAS_TEXTURE_BLEND);
+    if (!flexbody->m_defrag_lookup.empty() ) BITMASK_SET_1(header.flags, FlexBodyRecordHeader::IS_DEFRAGMENTED);
 
-    this->WriteToFile((void*)&header, sizeof(FlexBodyRecordHeader));
-}
-
-void FlexBodyFileIO::ReadFlexbodyHeader(FlexBodyCacheData* data)
-{
-    FLEX_DEBUG_LOG(__FUNCTION__);
-    this->ReadFromFile((void*)&data->header, sizeof(FlexBodyRecordHeader));
-}
-
-
-void FlexBodyFileIO::WriteFlexbodyLocatorList(FlexBody* flexbody)
-{
-    FLEX_DEBUG_LOG(__FUNCTION__);
-    this->WriteToFile((void*)flexbody->m_locators, sizeof(Locator_t) * flexbody->m_vertex_count);
-}
-
-void FlexBodyFileIO::ReadFlexbodyLocatorList(FlexBodyCacheData* data)
-{
-    FLEX_DEBUG_LOG(__FUNCTION__);
-    // Alloc. Use <new> - experiment
-    data->locators = new Locator_t[data->header.vertex_count];
-    // Read
-    this->ReadFromFile((void*)data->locators, sizeof(Locator_t) * data->header.vertex_count);
-}
-
-void FlexBodyFileIO::WriteFlexbodyNormalsBuffer(FlexBody* flexbody)
-{
-    FLEX_DEBUG_LOG(__FUNCTION__);
-    this->WriteToFile((void*)flexbody->m_src_normals, sizeof(Ogre::Vector3) * flexbody->m_vertex_count);
-}
-
-void FlexBodyFileIO::ReadFlexbodyNormalsBuffer(FlexBodyCacheData* data)
-{
-    FLEX_DEBUG_LOG(__FUNCTION__);
-    const int vertex_count = data->header.vertex_count;
-    // Alloc. Use malloc() because that's how flexbodies were implemented.
-    data->src_normals=(Ogre::Vector3*)malloc(sizeof(Ogre::Vector3) * vertex_count);
-    // Read
-    this->ReadFromFile((void*)data->src_normals, sizeof(Ogre::Vector3) * vertex_count);
-}
+    // Must match the layout produced by `WriteFlexbodyData()`
+    auto reserve = [&data_offset](size_t length) -> uint64_t
+    {
+        const uint64_t offset = data_offset;
+        data_offset += (length + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT;
+        return offset;
+    };
+    header.locators_offset  = reserve(sizeof(Locator_t) * flexbody->m_vertex_count);
+    header.positions_offset = reserve(sizeof(Ogre::Vector3) * flexbody->m_vertex_count);
+    header.normals_offset   = reserve(sizeof(Ogre::Vector3) * flexbody->m_vertex_count);
+    if (flexbody->m_has_texture_blend)
+    {
+        header.colors_offset = reserve(sizeof(Ogre::ARGB) * flexbody->m_vertex_count);
+    }
+    if (!flexbody->m_defrag_lookup.empty())
+    {
+        header.defrag_lookup_offset = reserve(sizeof(int32_t) * flexbody->m_vertex_count);
+    }
 
-void FlexBodyFileIO::WriteFlexbodyPositionsBuffer(FlexBody* flexbody)
-{
-    FLEX_DEBUG_LOG(__FUNCTION__);
-    this->WriteToFile((void*)flexbody->m_dst_pos, sizeof(Ogre::Vector3) * flexbody->m_vertex_count);
+    this->WriteToFile(&header, sizeof(FlexBodyRecordHeader));
 }
 
-void FlexBodyFileIO::ReadFlexbodyPositionsBuffer(FlexBodyCacheData* data)
-{
-    FLEX_DEBUG_LOG(__FUNCTION__);
-    const int vertex_count = data->header.vertex_count;
-    // Alloc. Use malloc() because that's how flexbodies were implemented.
-    data->dst_pos=(Ogre::Vector3*)malloc(sizeof(Ogre::Vector3) * vertex_count);
-    // Read
-    this->ReadFromFile((void*)data->dst_pos, sizeof(Ogre::Vector3) * vertex_count);
-}
-
-void FlexBodyFileIO::WriteFlexbodyColorsBuffer(FlexBody* flexbody)
+void FlexBodyFileIO::WriteFlexbodyData(FlexBody* flexbody)
 {
     FLEX_DEBUG_LOG(__FUNCTION__);
+    this->WriteToFile(flexbody->m_locators, sizeof(Locator_t) * flexbody->m_vertex_count);
+    this->WritePadding();
+    this->WriteToFile(flexbody->m_dst_pos, sizeof(Ogre::Vector3) * flexbody->m_vertex_count);
+    this->WritePadding();
+    this->WriteToFile(flexbody->m_src_normals, sizeof(Ogre::Vector3) * flexbody->m_vertex_count);
+    this->WritePadding();
     if (flexbody->m_has_texture_blend)
     {
-        this->WriteToFile((void*)flexbody->m_src_colors, sizeof(Ogre::ARGB) * flexbody->m_vertex_count);
+        this->WriteToFile(flexbody->m_src_colors, sizeof(Ogre::ARGB) * flexbody->m_vertex_count);
+        this->WritePadding();
     }
-}
-
-void FlexBodyFileIO::ReadFlexbodyColorsBuffer(FlexBodyCacheData* data)
-{
-    FLEX_DEBUG_LOG(__FUNCTION__);
-    if (BITMASK_IS_0(data->header.flags, FlexBodyRecordHeader::HAS_TEXTURE_BLEND))
+    if (!flexbody->m_defrag_lookup.empty())
     {
-        return;
+        this->WriteToFile(flexbody->m_defrag_lookup.data(), sizeof(int32_t) * flexbody->m_vertex_count);
+        this->WritePadding();
     }
-    const int vertex_count = data->header.vertex_count;
-    // Alloc. Use malloc() because that's how flexbodies were implemented.
-    data->src_colors=(Ogre::ARGB*)malloc(sizeof(Ogre::ARGB) * vertex_count);
-    // Read
-    this->ReadFromFile((void*)data->src_colors, sizeof(Ogre::ARGB) * vertex_count);
 }
 
-void FlexBodyFileIO::OpenFile(const char* fopen_mode)
+void FlexBodyFileIO::OpenFile(const char* path, const char* fopen_mode)
 {
     FLEX_DEBUG_LOG(__FUNCTION__);
-    if (m_cache_entry_number == -1)
+    if (m_file_path.empty())
     {
         throw RESULT_CODE_ERR_CACHE_NUMBER_UNDEFINED;
     }
-    char path[500];
-    sprintf(path, "%s%cflexbodies_mod_%00d.dat", App::sys_cache_dir->getStr().c_str(), RoR::PATH_SLASH, m_cache_entry_number);
     m_file = fopen(path, fopen_mode);
     if (m_file == nullptr)
     {
         throw RESULT_CODE_ERR_FOPEN_FAILED;
     }
+    m_file_pos = 0;
+    m_file_checksum = FNV_OFFSET_BASIS;
+}
+
+void FlexBodyFileIO::SetFile(std::string const& path, uint64_t validation_hash)
+{
+    m_file_path = path;
+    m_validation_hash = validation_hash;
 }
 
 FlexBodyFileIO::ResultCode FlexBodyFileIO::SaveFile()
@@ -327,74 +397,143 @@ FlexBodyFileIO::ResultCode FlexBodyFileIO::SaveFile()
         FLEX_DEBUG_LOG(__FUNCTION__ " >> No flexbodies to save >> EXIT");
         return RESULT_CODE_OK;
     }
+    // Write to a temporary file first - the current file may be mapped by other actors, and must never be seen half-written.
+    const std::string tmp_path = m_file_path + ".tmp";
     try
     {
-        this->OpenFile("wb");
+        this->OpenFile(tmp_path.c_str(), "wb");
 
         this->WriteSignature();
-        this->WriteMetadata();
+        this->WriteMetadata(0); // Placeholder, rewritten with the checksum at the end.
 
-        auto itor = m_items_to_save.begin();
-        auto end  = m_items_to_save.end();
-        for (; itor != end; ++itor)
+        uint64_t data_offset = m_file_pos + sizeof(FlexBodyRecordHeader) * m_items_to_save.size();
+        data_offset = (data_offset + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT;
+        for (FlexBody* flexbody: m_items_to_save)
         {
-            FlexBody* flexbody = *itor;
-            this->WriteFlexbodyHeader(flexbody);
+            this->WriteFlexbodyHeader(flexbody, data_offset);
+        }
+        this->WritePadding();
+        for (FlexBody* flexbody: m_items_to_save)
+        {
+            this->WriteFlexbodyData(flexbody);
+        }
 
-            this->WriteFlexbodyLocatorList    (flexbody);
-            this->WriteFlexbodyPositionsBuffer(flexbody);
-            this->WriteFlexbodyNormalsBuffer  (flexbody);
-            this->WriteFlexbodyColorsBuffer   (flexbody);
+        const uint64_t data_checksum = m_file_checksum;
+        if (fseek(m_file, SIGNATURE_SIZE, SEEK_SET) != 0)
+        {
+            throw RESULT_CODE_FWRITE_OUTPUT_INCOMPLETE;
         }
+        m_file_pos = SIGNATURE_SIZE;
+        this->WriteMetadata(data_checksum);
         this->CloseFile();
+
+        std::remove(m_file_path.c_str()); // Required on Windows; the old file survives while mapped.
+        if (std::rename(tmp_path.c_str(), m_file_path.c_str()) != 0)
+        {
+            std::remove(tmp_path.c_str());
+            return RESULT_CODE_ERR_FOPEN_FAILED;
+        }
         FLEX_DEBUG_LOG(__FUNCTION__ " >> OK ");
         return RESULT_CODE_OK;
     }
     catch (ResultCode result)
     {
         this->CloseFile();
+        std::remove(tmp_path.c_str());
         FLEX_DEBUG_LOG(__FUNCTION__ " >> EXCEPTION!! ");
         return result;
     }
 }
 
-FlexBodyFileIO::ResultCode FlexBodyFileIO::LoadFile()
+const uint8_t* FlexBodyFileIO::GetMappedArray(FlexBodyCacheFile* file, uint64_t offset, size_t length)
+{
+    if (offset % DATA_ALIGNMENT != 0 || offset > file->m_mapping.GetSize() || length > file->m_mapping.GetSize() - offset)
+    {
+        throw RESULT_CODE_FREAD_OUTPUT_INCOMPLETE;
+    }
+    return file->m_mapping.GetData() + offset;
+}
+
+FlexBodyFileIO::ResultCode FlexBodyFileIO::LoadFile(FlexBodyCacheFilePtr& out_file)
 {
     FLEX_DEBUG_LOG(__FUNCTION__);
-    try 
+    try
     {
-        this->OpenFile("rb");
-        this->ReadAndCheckSignature();
+        if (m_file_path.empty())
+        {
+            throw RESULT_CODE_ERR_CACHE_NUMBER_UNDEFINED;
+        }
+        FlexBodyCacheFilePtr file = std::make_shared<FlexBodyCacheFile>();
+        if (!file->m_mapping.Open(m_file_path))
+        {
+            throw RESULT_CODE_ERR_FOPEN_FAILED;
+        }
+        const uint8_t* data = file->m_mapping.GetData();
+        const size_t size = file->m_mapping.GetSize();
+
+        if (size < SIGNATURE_SIZE + sizeof(FlexBodyFileMetadata))
+        {
+            throw RESULT_CODE_FREAD_OUTPUT_INCOMPLETE;
+        }
+        if (strncmp(SIGNATURE, reinterpret_cast<const char*>(data), SIGNATURE_SIZE) != 0)
+        {
+            throw RESULT_CODE_ERR_SIGNATURE_MISMATCH;
+        }
 
         FlexBodyFileMetadata meta;
-        this->ReadMetadata(&meta);
-        m_fileformat_version = meta.file_format_version;
-        if (m_fileformat_version != FILE_FORMAT_VERSION)
+        memcpy(&meta, data + SIGNATURE_SIZE, sizeof(FlexBodyFileMetadata));
+        if (meta.file_format_version != FILE_FORMAT_VERSION)
         {
             throw RESULT_CODE_ERR_VERSION_MISMATCH;
         }
-        m_loaded_items.resize(meta.num_flexbodies);
+        if (meta.validation_hash != m_validation_hash)
+        {
+            throw RESULT_CODE_ERR_VALIDATION_HASH_MISMATCH;
+        }
+        const size_t data_start = SIGNATURE_SIZE + sizeof(FlexBodyFileMetadata);
+        if (HashBytes(FNV_OFFSET_BASIS, data + data_start, size - data_start) != meta.data_checksum)
+        {
+            throw RESULT_CODE_ERR_CHECKSUM_MISMATCH;
+        }
+        if (meta.num_flexbodies > (size - data_start) / sizeof(FlexBodyRecordHeader))
+        {
+            throw RESULT_CODE_FREAD_OUTPUT_INCOMPLETE;
+        }
 
-        for (unsigned int i = 0; i < meta.num_flexbodies; ++i)
+        file->m_records.resize(meta.num_flexbodies);
+        for (uint32_t i = 0; i < meta.num_flexbodies; ++i)
         {
-            FlexBodyCacheData* data = & m_loaded_items[i];
-            this->ReadFlexbodyHeader(data);
-            if (BITMASK_IS_0(data->header.flags, FlexBodyRecordHeader::IS_FAULTY))
+            FlexBodyCacheData* record = &file->m_records[i];
+            memcpy(&record->header, data + data_start + i * sizeof(FlexBodyRecordHeader), sizeof(FlexBodyRecordHeader));
+            if (BITMASK_IS_1(record->header.flags, FlexBodyRecordHeader::IS_FAULTY))
+            {
+                continue;
+            }
+            const size_t vertex_count = static_cast<size_t>(record->header.vertex_count);
+            record->locators = reinterpret_cast<const Locator_t*>(
+                this->GetMappedArray(file.get(), record->header.locators_offset, sizeof(Locator_t) * vertex_count));
+            record->dst_pos = reinterpret_cast<const Ogre::Vector3*>(
+                this->GetMappedArray(file.get(), record->header.positions_offset, sizeof(Ogre::Vector3) * vertex_count));
+            record->src_normals = reinterpret_cast<const Ogre::Vector3*>(
+                this->GetMappedArray(file.get(), record->header.normals_offset, sizeof(Ogre::Vector3) * vertex_count));
+            if (BITMASK_IS_1(record->header.flags, FlexBodyRecordHeader::HAS_TEXTURE_BLEND))
             {
-                this->ReadFlexbodyLocatorList    (data);
-                this->ReadFlexbodyPositionsBuffer(data);
-                this->ReadFlexbodyNormalsBuffer  (data);
-                this->ReadFlexbodyColorsBuffer   (data);
+                record->src_colors = reinterpret_cast<const Ogre::ARGB*>(
+                    this->GetMappedArray(file.get(), record->header.colors_offset, sizeof(Ogre::ARGB) * vertex_count));
+            }
+            if (BITMASK_IS_1(record->header.flags, FlexBodyRecordHeader::IS_DEFRAGMENTED))
+            {
+                record->defrag_lookup = reinterpret_cast<const int32_t*>(
+                    this->GetMappedArray(file.get(), record->header.defrag_lookup_offset, sizeof(int32_t) * vertex_count));
             }
         }
 
-        this->CloseFile();
+        out_file = file;
         FLEX_DEBUG_LOG(__FUNCTION__ " >> OK ");
         return RESULT_CODE_OK;
     }
     catch (ResultCode ret)
     {
-        this->CloseFile();
         FLEX_DEBUG_LOG(__FUNCTION__ " >> EXCEPTION!! ");
         return ret;
     }
@@ -402,8 +541,9 @@ FlexBodyFileIO::ResultCode FlexBodyFileIO::LoadFile()
 
 FlexBodyFileIO::FlexBodyFileIO():
     m_file(nullptr),
-    m_fileformat_version(0),
-    m_cache_entry_number(-1) // flexbody cache disabled (shouldn't be based on the cache entry number ...) ~ ulteq 01/19
+    m_file_pos(0),
+    m_file_checksum(FNV_OFFSET_BASIS),
+    m_validation_hash(0)
     {}
 
 void FlexFactory::CheckAndLoadFlexbodyCache()
@@ -411,18 +551,36 @@ void FlexFactory::CheckAndLoadFlexbodyCache()
     FLEX_DEBUG_LOG(__FUNCTION__);
     if (m_is_flexbody_cache_enabled)
     {
-        m_is_flexbody_cache_loaded = 
-            (m_flexbody_cache.LoadFile() == FlexBodyFileIO::RESULT_CODE_OK);
+        m_flexbody_cache_hash = this->CalcCacheValidationHash();
+        m_flexbody_cache.SetFile(
+            fmt::format("{}{}flexbodies_{:016x}.dat", App::sys_cache_dir->getStr(), RoR::PATH_SLASH, m_flexbody_cache_hash),
+            m_flexbody_cache_hash);
+
+        // Another instance of the same actor is alive - share its data.
+        auto found = s_loaded_cache_files.find(m_flexbody_cache_hash);
+        if (found != s_loaded_cache_files.end())
+        {
+            m_flexbody_cache_file = found->second.lock();
+        }
+
+        if (!m_flexbody_cache_file
+            && m_flexbody_cache.LoadFile(m_flexbody_cache_file) == FlexBodyFileIO::RESULT_CODE_OK)
+        {
+            s_loaded_cache_files[m_flexbody_cache_hash] = m_flexbody_cache_file;
+        }
+        m_is_flexbody_cache_loaded = (m_flexbody_cache_file != nullptr);
     }
 }
 
 void FlexFactory::SaveFlexbodiesToCache()
 {
     FLEX_DEBUG_LOG(__FUNCTION__);
-    if (m_is_flexbody_cache_enabled && !m_is_flexbody_cache_loaded)
+    if (m_is_flexbody_cache_enabled && (!m_is_flexbody_cache_loaded || m_is_flexbody_cache_stale))
     {
         FLEX_DEBUG_LOG(__FUNCTION__ " >> Saving flexbodies");
-        m_flexbody_cache.SaveFile();
+        if (m_flexbody_cache.SaveFile() == FlexBodyFileIO::RESULT_CODE_OK)
+        {
+            s_loaded_cache_files.erase(m_flexbody_cache_hash); // Next spawn maps the new file.
+        }
     }
 }
-
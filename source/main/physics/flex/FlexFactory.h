@@ -30,10 +30,14 @@
 #include "BitFlags.h"
 #include "ForwardDeclarations.h"
 #include "Locator_t.h"
+#include "MappedFile.h"
 #include "RigDef_Prerequisites.h"
 
 #include <OgreVector3.h>
 #include <OgreColourValue.h>
+#include <cstdint>
+#include <map>
+#include <memory>
 #include <vector>
 
 namespace RoR
@@ -47,6 +51,7 @@ namespace RoR
 
 struct FlexBodyRecordHeader
 {
+    uint64_t       key_hash;       //!< Inputs of the flexbody, see `FlexFactory::CalcFlexbodyKeyHash()`.
     int            vertex_count;
     int	           node_center;
     int	           node_x;
@@ -57,43 +62,63 @@ struct FlexBodyRecordHeader
     int            num_submesh_vbufs;
     BitMask_t      flags = 0;
 
+    // Byte offsets of the data arrays from the start of the file, 0 if not present.
+    uint64_t       locators_offset = 0;
+    uint64_t       positions_offset = 0;
+    uint64_t       normals_offset = 0;
+    uint64_t       colors_offset = 0;        //!< Only present if flag HAS_TEXTURE_BLEND
+    uint64_t       defrag_lookup_offset = 0; //!< Only present if flag IS_DEFRAGMENTED
+
     static const BitMask_t IS_FAULTY                = BITMASK(1);
     static const BitMask_t USES_SHARED_VERTEX_DATA  = BITMASK(2);
     static const BitMask_t HAS_TEXTURE              = BITMASK(3);
     static const BitMask_t HAS_TEXTURE_BLEND        = BITMASK(4);
+    static const BitMask_t IS_DEFRAGMENTED          = BITMASK(5);
 };
 
+/// One flexbody's data, pointing directly into a memory-mapped `FlexBodyCacheFile`.
+/// Locators and source normals are immutable and shared by all FlexBody instances which use the record;
+/// positions and colors are modified at runtime, so each instance copies them.
 struct FlexBodyCacheData
 {
-    FlexBodyCacheData():
-        dst_pos(nullptr),
-        src_normals(nullptr),
-        src_colors(nullptr),
-        locators(nullptr)
-    {}
+    FlexBodyRecordHeader header;
 
-    // NOTE: No freeing of memory needed, pointers will be copied to FlexBody instances.
+    const Ogre::Vector3* dst_pos = nullptr;
+    const Ogre::Vector3* src_normals = nullptr;
+    const Ogre::ARGB*    src_colors = nullptr;
+    const Locator_t*     locators = nullptr;      //!< 1 loc per vertex
+    const int32_t*       defrag_lookup = nullptr; //!< Vertex order produced by `FlexBody::defragmentFlexbodyMesh()`.
+};
 
-    FlexBodyRecordHeader header;
+/// A loaded (memory-mapped and validated) flexbody cache file. Immutable; shared by all actors
+/// spawned from the same definition and kept alive by the FlexBody instances using it.
+class FlexBodyCacheFile
+{
+public:
+    size_t             GetNumRecords() const           { return m_records.size(); }
+    FlexBodyCacheData* GetRecord(size_t index)         { return &m_records[index]; }
+
+private:
+    friend class FlexBodyFileIO;
 
-    Ogre::Vector3*    dst_pos;
-    Ogre::Vector3*    src_normals;
-    Ogre::ARGB*       src_colors;
-    Locator_t*        locators; //!< 1 loc per vertex
+    MappedFile                      m_mapping;
+    std::vector<FlexBodyCacheData>  m_records;
 };
 
+typedef std::shared_ptr<FlexBodyCacheFile> FlexBodyCacheFilePtr;
+
 /// Enables saving and loading flexbodies from/to binary file.
 ///
-/// FILE STRUCTURE:
-/// 1. Signature
+/// FILE STRUCTURE (all data arrays are 16-byte aligned, the file is used in place via memory mapping):
+/// 1. Signature, padded to 16 bytes
 /// 2. Metadata @see FlexBodyFileMetadata
-/// 3. Flexbodies
-///     a. Header @see FlexBodyRecordHeader
-///     b. Data (not present if flexbody has flags IS_FAULTY==true or IS_ENABLED==false)
-///         1. Locator list
-///         2. Positions buffer
-///         3. Normals buffer
-///         4. Colors buffer (only present if flag HAS_TEXTURE_BLEND == true)
+/// 3. Flexbody headers @see FlexBodyRecordHeader, one per flexbody
+/// 4. Flexbody data (not present if flexbody has flag IS_FAULTY==true), located by header offsets
+///     a. Locator list
+///     b. Positions buffer
+///     c. Normals buffer
+///     d. Colors buffer (only present if flag HAS_TEXTURE_BLEND == true)
+///     e. Defragmentation lookup (only present if flag IS_DEFRAGMENTED == true)
 class FlexBodyFileIO
 {
 public:
@@ -106,58 +131,52 @@ public:
         RESULT_CODE_ERR_VERSION_MISMATCH,
         RESULT_CODE_ERR_CACHE_NUMBER_UNDEFINED,
         RESULT_CODE_FREAD_OUTPUT_INCOMPLETE,
-        RESULT_CODE_FWRITE_OUTPUT_INCOMPLETE
+        RESULT_CODE_FWRITE_OUTPUT_INCOMPLETE,
+        RESULT_CODE_ERR_VALIDATION_HASH_MISMATCH,
+        RESULT_CODE_ERR_CHECKSUM_MISMATCH
     };
 
     static const char*        SIGNATURE;
-    static const unsigned int FILE_FORMAT_VERSION = 1;
+    static const unsigned int FILE_FORMAT_VERSION = 2;
 
     FlexBodyFileIO();
 
-    std::vector<FlexBody*> &  GetList();
+    /// @param validation_hash Identifies the actor configuration; a file written with a different one is rejected.
+    void                      SetFile(std::string const& path, uint64_t validation_hash);
     inline void               AddItemToSave(FlexBody* fb)     { m_items_to_save.push_back(fb); }
-    inline FlexBodyCacheData* GetLoadedItem(unsigned index)   { return & m_loaded_items[index]; }
     ResultCode                SaveFile();
-    ResultCode                LoadFile();
+    ResultCode                LoadFile(FlexBodyCacheFilePtr& out_file);
 
 private:
     struct FlexBodyFileMetadata
     {
-        unsigned int   file_format_version;
-        unsigned int   num_flexbodies;
+        uint32_t       file_format_version;
+        uint32_t       num_flexbodies;
+        uint64_t       validation_hash;
+        uint64_t       data_checksum;  //!< FNV-1a of everything after the metadata.
     };
 
-    void        OpenFile(const char* fopen_mode);
-    void        WriteToFile(void* source, size_t length);
-    void        ReadFromFile(void* dest, size_t length);
-    inline void CloseFile()                                 { if (m_file != nullptr) { fclose(m_file); } }
-                
-    void        WriteSignature();
-    void         ReadAndCheckSignature();
-
-    void        WriteMetadata();
-    void         ReadMetadata(FlexBodyFileMetadata* meta);
-
-    void        WriteFlexbodyHeader(FlexBody*          flexbody);
-    void         ReadFlexbodyHeader(FlexBodyCacheData* flexbody);
+    static const size_t SIGNATURE_SIZE = 16;
+    static const size_t DATA_ALIGNMENT = 16;
 
-    void        WriteFlexbodyLocatorList(FlexBody*          flexbody);
-    void         ReadFlexbodyLocatorList(FlexBodyCacheData* flexbody);
+    void        OpenFile(const char* path, const char* fopen_mode);
+    void        WriteToFile(const void* source, size_t length);
+    void        WritePadding();
+    inline void CloseFile()                                 { if (m_file != nullptr) { fclose(m_file); m_file = nullptr; } }
 
-    void        WriteFlexbodyNormalsBuffer(FlexBody*          flexbody);
-    void         ReadFlexbodyNormalsBuffer(FlexBodyCacheData* flexbody);
-
-    void        WriteFlexbodyPositionsBuffer(FlexBody*          flexbody);
-    void         ReadFlexbodyPositionsBuffer(FlexBodyCacheData* flexbody);
+    void        WriteSignature();
+    void        WriteMetadata(uint64_t data_checksum);
+    void        WriteFlexbodyHeader(FlexBody* flexbody, uint64_t& data_offset);
+    void        WriteFlexbodyData(FlexBody* flexbody);
 
-    void        WriteFlexbodyColorsBuffer(FlexBody*          flexbody);
-    void         ReadFlexbodyColorsBuffer(FlexBodyCacheData* flexbody);
+    const uint8_t* GetMappedArray(FlexBodyCacheFile* file, uint64_t offset, size_t length); //!< Throws if out of bounds.
 
     std::vector<FlexBody*>          m_items_to_save;
-    std::vector<FlexBodyCacheData>  m_loaded_items;
     FILE*                           m_file;
-    unsigned int                    m_fileformat_version;
-    int                             m_cache_entry_number;
+    uint64_t                        m_file_pos;        //!< Bytes written so far.
+    uint64_t                        m_file_checksum;   //!< Running FNV-1a of data written after the metadata.
+    std::string                     m_file_path;
+    uint64_t                        m_validation_hash;
 };
 
 class FlexFactory
@@ -197,12 +216,26 @@ public:
 
 private:
 
+    /// Hash of everything which determines the flexbodies of an actor: definition file, section config, addonparts, defrag settings.
+    uint64_t CalcCacheValidationHash();
+    /// Hash of the arguments of `CreateFlexBody()` which affect the cached data (the mesh is represented by vertex count and bounds).
+    static uint64_t CalcFlexbodyKeyHash(
+        NodeNum_t ref_node, NodeNum_t x_node, NodeNum_t y_node, Ogre::Vector3 offset, Ogre::Vector3 rotation,
+        std::vector<unsigned int>& node_indices, std::vector<ForvertTempData>& forvert_data, Ogre::MeshPtr& mesh);
+
     ActorSpawner*             m_rig_spawner;
 
     FlexBodyFileIO          m_flexbody_cache;
+    FlexBodyCacheFilePtr    m_flexbody_cache_file;      //!< Loaded cache, shared with other actors.
     bool                    m_is_flexbody_cache_enabled;
     bool                    m_is_flexbody_cache_loaded;
+    bool                    m_is_flexbody_cache_stale = false; //!< A flexbody didn't match its cache record - rewrite the file.
+    uint64_t                m_flexbody_cache_hash = 0;
     unsigned int            m_flexbody_cache_next_index;
+
+    /// Cache files currently in use, by validation hash - spawning another instance of an actor reuses the mapping.
+    /// Main thread only.
+    static std::map<uint64_t, std::weak_ptr<FlexBodyCacheFile>> s_loaded_cache_files;
 };
 
 /// @} // addtogroup Flex
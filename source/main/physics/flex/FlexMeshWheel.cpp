@@ -186,31 +186,31 @@ FlexMeshWheel::~FlexMeshWheel()
 
 Vector3 FlexMeshWheel::updateVertices()
 {
-    RoR::NodeSB* all_nodes = m_gfx_actor->GetSimNodeBuffer();
-    Vector3 center = (all_nodes[m_axis_node0_idx].AbsPosition + all_nodes[m_axis_node1_idx].AbsPosition) / 2.0;
-    Vector3 ray = all_nodes[m_start_node_idx].AbsPosition - all_nodes[m_axis_node0_idx].AbsPosition;
-    Vector3 axis = all_nodes[m_axis_node0_idx].AbsPosition - all_nodes[m_axis_node1_idx].AbsPosition;
+    const Ogre::Vector3* all_nodes = m_gfx_actor->GetSimNodePositions();
+    Vector3 center = (all_nodes[m_axis_node0_idx] + all_nodes[m_axis_node1_idx]) / 2.0;
+    Vector3 ray = all_nodes[m_start_node_idx] - all_nodes[m_axis_node0_idx];
+    Vector3 axis = all_nodes[m_axis_node0_idx] - all_nodes[m_axis_node1_idx];
 
     axis.normalise();
     
     for (size_t i=0; i<m_num_rays; i++)
     {
-        Plane pl=Plane(axis, all_nodes[m_axis_node0_idx].AbsPosition);
-        ray=all_nodes[m_start_node_idx+i*2].AbsPosition-all_nodes[m_axis_node0_idx].AbsPosition;
+        Plane pl=Plane(axis, all_nodes[m_axis_node0_idx]);
+        ray=all_nodes[m_start_node_idx+i*2]-all_nodes[m_axis_node0_idx];
         ray=pl.projectVector(ray);
         ray.normalise();
-        m_vertices[i*6  ].position=all_nodes[m_axis_node0_idx].AbsPosition+m_rim_radius*ray-center;
+        m_vertices[i*6  ].position=all_nodes[m_axis_node0_idx]+m_rim_radius*ray-center;
 
-        m_vertices[i*6+1].position=all_nodes[m_start_node_idx+i*2].AbsPosition-0.05  *(all_nodes[m_start_node_idx+i*2].AbsPosition-all_nodes[m_axis_node0_idx].AbsPosition)-center;
-        m_vertices[i*6+2].position=all_nodes[m_start_node_idx+i*2].AbsPosition-0.1   *(all_nodes[m_start_node_idx+i*2].AbsPosition-all_nodes[m_start_node_idx+i*2+1].AbsPosition)-center;
-        m_vertices[i*6+3].position=all_nodes[m_start_node_idx+i*2+1].AbsPosition-0.1 *(all_nodes[m_start_node_idx+i*2+1].AbsPosition-all_nodes[m_start_node_idx+i*2].AbsPosition)-center;
-        m_vertices[i*6+4].position=all_nodes[m_start_node_idx+i*2+1].AbsPosition-0.05*(all_nodes[m_start_node_idx+i*2+1].AbsPosition-all_nodes[m_axis_node1_idx].AbsPosition)-center;
+        m_vertices[i*6+1].position=all_nodes[m_start_node_idx+i*2]-0.05  *(all_nodes[m_start_node_idx+i*2]-all_nodes[m_axis_node0_idx])-center;
+        m_vertices[i*6+2].position=all_nodes[m_start_node_idx+i*2]-0.1   *(all_nodes[m_start_node_idx+i*2]-all_nodes[m_start_node_idx+i*2+1])-center;
+        m_vertices[i*6+3].position=all_nodes[m_start_node_idx+i*2+1]-0.1 *(all_nodes[m_start_node_idx+i*2+1]-all_nodes[m_start_node_idx+i*2])-center;
+        m_vertices[i*6+4].position=all_nodes[m_start_node_idx+i*2+1]-0.05*(all_nodes[m_start_node_idx+i*2+1]-all_nodes[m_axis_node1_idx])-center;
 
-        pl=Plane(-axis, all_nodes[m_axis_node1_idx].AbsPosition);
-        ray=all_nodes[m_start_node_idx+i*2+1].AbsPosition-all_nodes[m_axis_node1_idx].AbsPosition;
+        pl=Plane(-axis, all_nodes[m_axis_node1_idx]);
+        ray=all_nodes[m_start_node_idx+i*2+1]-all_nodes[m_axis_node1_idx];
         ray=pl.projectVector(ray);
         ray.normalise();
-        m_vertices[i*6+5].position=all_nodes[m_axis_node1_idx].AbsPosition+m_rim_radius*ray-center;
+        m_vertices[i*6+5].position=all_nodes[m_axis_node1_idx]+m_rim_radius*ray-center;
 
         //normals
         m_vertices[i*6  ].normal=axis;
@@ -236,15 +236,15 @@ void FlexMeshWheel::setVisible(bool visible)
 
 bool FlexMeshWheel::flexitPrepare()
 {
-    RoR::NodeSB* all_nodes = m_gfx_actor->GetSimNodeBuffer();
-    Vector3 center = (all_nodes[m_axis_node0_idx].AbsPosition + all_nodes[m_axis_node1_idx].AbsPosition) / 2.0;
+    const Ogre::Vector3* all_nodes = m_gfx_actor->GetSimNodePositions();
+    Vector3 center = (all_nodes[m_axis_node0_idx] + all_nodes[m_axis_node1_idx]) / 2.0;
     m_rim_scene_node->setPosition(center);
 
-    Vector3 axis = all_nodes[m_axis_node0_idx].AbsPosition - all_nodes[m_axis_node1_idx].AbsPosition;
+    Vector3 axis = all_nodes[m_axis_node0_idx] - all_nodes[m_axis_node1_idx];
     axis.normalise();
 
     if (m_is_rim_reverse) axis = -axis;
-    Vector3 ray = all_nodes[m_start_node_idx].AbsPosition - all_nodes[m_axis_node0_idx].AbsPosition;
+    Vector3 ray = all_nodes[m_start_node_idx] - all_nodes[m_axis_node0_idx];
     Vector3 onormal = axis.crossProduct(ray);
     onormal.normalise();
     ray = axis.crossProduct(onormal);
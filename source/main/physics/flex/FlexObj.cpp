@@ -185,12 +185,12 @@ int FlexObj::ComputeVertexPos(int tidx, int v, std::vector<CabSubmesh>& submeshe
 
 Vector3 FlexObj::UpdateMesh()
 {
-    RoR::NodeSB* all_nodes = m_gfx_actor->GetSimNodeBuffer();
-    Ogre::Vector3 center=(all_nodes[m_vertex_nodes[0]].AbsPosition+all_nodes[m_vertex_nodes[1]].AbsPosition)/2.0;
+    const Ogre::Vector3* all_nodes = m_gfx_actor->GetSimNodePositions();
+    Ogre::Vector3 center=(all_nodes[m_vertex_nodes[0]]+all_nodes[m_vertex_nodes[1]])/2.0;
     for (size_t i=0; i<m_vertex_count; i++)
     {
         //set position
-        m_vertices[i].position=all_nodes[m_vertex_nodes[i]].AbsPosition-center;
+        m_vertices[i].position=all_nodes[m_vertex_nodes[i]]-center;
         //reset normals
         m_vertices[i].normal=Vector3::ZERO;
     }
@@ -198,8 +198,8 @@ Vector3 FlexObj::UpdateMesh()
     for (size_t i=0; i<m_index_count/3; i++)
     {
         Vector3 v1, v2;
-        v1=all_nodes[m_vertex_nodes[m_indices[i*3+1]]].AbsPosition-all_nodes[m_vertex_nodes[m_indices[i*3]]].AbsPosition;
-        v2=all_nodes[m_vertex_nodes[m_indices[i*3+2]]].AbsPosition-all_nodes[m_vertex_nodes[m_indices[i*3]]].AbsPosition;
+        v1=all_nodes[m_vertex_nodes[m_indices[i*3+1]]]-all_nodes[m_vertex_nodes[m_indices[i*3]]];
+        v2=all_nodes[m_vertex_nodes[m_indices[i*3+2]]]-all_nodes[m_vertex_nodes[m_indices[i*3]]];
         v1=v1.crossProduct(v2);
         float s=v1.length();
 
@@ -0,0 +1,72 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ForsetNodeTree.h"
+
+#include <algorithm>
+
+using namespace RoR;
+
+ForsetNodeTree::ForsetNodeTree(const Ogre::Vector3* nodes, const std::vector<unsigned int>& node_indices)
+{
+    // Duplicates can't change the result of a scan (the first occurrence wins), skip them.
+    std::vector<bool> seen;
+    for (size_t i = 0; i < node_indices.size(); i++)
+    {
+        const unsigned int node = node_indices[i];
+        if (node >= seen.size())
+            seen.resize(node + 1, false);
+        if (seen[node])
+            continue;
+        seen[node] = true;
+
+        Entry entry;
+        entry.fne_pos = nodes[node];
+        entry.fne_node = static_cast<NodeNum_t>(node);
+        entry.fne_order = static_cast<int>(i);
+        entry.fne_axis = 0;
+        m_entries.push_back(entry);
+    }
+
+    this->BuildRecursive(0, static_cast<int>(m_entries.size()));
+}
+
+void ForsetNodeTree::BuildRecursive(int begin, int end)
+{
+    if (end - begin < 2)
+        return; // A leaf's axis doesn't matter.
+
+    Ogre::Vector3 bb_min = m_entries[begin].fne_pos;
+    Ogre::Vector3 bb_max = bb_min;
+    for (int i = begin + 1; i < end; i++)
+    {
+        bb_min.makeFloor(m_entries[i].fne_pos);
+        bb_max.makeCeil(m_entries[i].fne_pos);
+    }
+    const Ogre::Vector3 extent = bb_max - bb_min;
+    const uint8_t axis = (extent.x >= extent.y && extent.x >= extent.z) ? 0 : (extent.y >= extent.z ? 1 : 2);
+
+    const int mid = (begin + end) / 2;
+    std::nth_element(m_entries.begin() + begin, m_entries.begin() + mid, m_entries.begin() + end,
+        [axis](const Entry& a, const Entry& b) { return a.fne_pos[axis] < b.fne_pos[axis]; });
+    m_entries[mid].fne_axis = axis;
+
+    this->BuildRecursive(begin, mid);
+    this->BuildRecursive(mid + 1, end);
+}
@@ -0,0 +1,117 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+/// @brief  kd-tree over a flexbody's forset nodes, for finding vertex locators.
+
+#pragma once
+
+#include "ForwardDeclarations.h"
+
+#include <OgreVector3.h>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace RoR {
+
+/// @addtogroup Gfx
+/// @{
+
+/// @addtogroup Flex
+/// @{
+
+/// Static kd-tree (median splits along the axis of largest spread) over node positions.
+/// Queries give exactly the result of a linear scan over `node_indices` with a strict `<` comparison -
+/// equally distant nodes are resolved in favor of the one listed first. Read-only after construction,
+/// so it can be queried from multiple threads at once.
+class ForsetNodeTree
+{
+public:
+    ForsetNodeTree(const Ogre::Vector3* nodes, const std::vector<unsigned int>& node_indices);
+
+    /// Finds the nearest node for which `filter(NodeNum_t)` returns true.
+    /// @return Node index, or -1 if no node passed.
+    template <typename Filter> int FindNearest(const Ogre::Vector3& point, Filter filter) const
+    {
+        Candidate best;
+        this->SearchRecursive(point, 0, static_cast<int>(m_entries.size()), filter, best);
+        return best.fnc_node;
+    }
+
+private:
+
+    struct Entry
+    {
+        Ogre::Vector3 fne_pos;
+        NodeNum_t     fne_node;
+        int           fne_order;    //!< Position of first occurrence in `node_indices`; tie breaker.
+        uint8_t       fne_axis;     //!< Split axis of the subtree this entry is the root of.
+    };
+
+    struct Candidate
+    {
+        float         fnc_distance_sq = std::numeric_limits<float>::max();
+        int           fnc_node = -1;
+        int           fnc_order = std::numeric_limits<int>::max();
+    };
+
+    void BuildRecursive(int begin, int end);
+
+    template <typename Filter> void SearchRecursive(const Ogre::Vector3& point, int begin, int end, Filter& filter, Candidate& best) const
+    {
+        if (begin >= end)
+            return;
+
+        const int mid = (begin + end) / 2;
+        const Entry& entry = m_entries[mid];
+        const float distance_sq = point.squaredDistance(entry.fne_pos);
+        const bool better = (distance_sq < best.fnc_distance_sq)
+            || (distance_sq == best.fnc_distance_sq && best.fnc_node != -1 && entry.fne_order < best.fnc_order);
+        if (better && filter(entry.fne_node))
+        {
+            best.fnc_distance_sq = distance_sq;
+            best.fnc_node = entry.fne_node;
+            best.fnc_order = entry.fne_order;
+        }
+
+        // Visit the near side first; the far side only if the splitting plane is within reach
+        // (inclusive, an equally distant node may still win the tie).
+        const float delta = point[entry.fne_axis] - entry.fne_pos[entry.fne_axis];
+        if (delta < 0.f)
+        {
+            this->SearchRecursive(point, begin, mid, filter, best);
+            if (delta * delta <= best.fnc_distance_sq)
+                this->SearchRecursive(point, mid + 1, end, filter, best);
+        }
+        else
+        {
+            this->SearchRecursive(point, mid + 1, end, filter, best);
+            if (delta * delta <= best.fnc_distance_sq)
+                this->SearchRecursive(point, begin, mid, filter, best);
+        }
+    }
+
+    std::vector<Entry> m_entries; //!< Implicit tree: the root of range [begin, end) is at the middle.
+};
+
+/// @} // addtogroup Flex
+/// @} // addtogroup Gfx
+
+} // namespace RoR
@@ -0,0 +1,584 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "CacheIndex.h"
+
+#include "CacheSystem.h"
+
+#include <Ogre.h>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+
+using namespace RoR;
+
+static const char     CACHE_INDEX_SIGNATURE[8] = { 'R', 'o', 'R', 'M', 'o', 'd', 'I', 'x' };
+static const uint32_t CACHE_INDEX_VERSION      = 1;          // Layout of this file; the content follows CACHE_FILE_FORMAT.
+static const uint32_t CACHE_INDEX_BYTE_ORDER   = 0x01020304;
+
+// All offsets are multiples of 8 so the mapped records can be used in place.
+
+struct CacheIndex::Header
+{
+    char     cih_signature[8];
+    uint32_t cih_index_version;
+    uint32_t cih_format_version;     //!< CACHE_FILE_FORMAT
+    uint32_t cih_byte_order;
+    uint32_t cih_record_size;        //!< Catches layout differences between builds.
+    uint32_t cih_num_records;
+    uint32_t cih_num_authors;
+    uint32_t cih_num_list_items;
+    uint32_t cih_strings_size;
+    uint32_t cih_global_hash;
+    uint32_t cih_padding;
+};
+
+struct CacheIndex::Record
+{
+    int64_t  cir_addtimestamp;
+    int64_t  cir_filetime;
+
+    // Offsets into the string table
+    uint32_t cir_fpath;
+    uint32_t cir_fname;
+    uint32_t cir_fname_without_uid;
+    uint32_t cir_fext;
+    uint32_t cir_dname;
+    uint32_t cir_uniqueid;
+    uint32_t cir_guid;
+    uint32_t cir_resource_bundle_type;
+    uint32_t cir_resource_bundle_path;
+    uint32_t cir_filecachename;
+    uint32_t cir_description;
+    uint32_t cir_tags;
+    uint32_t cir_default_skin;
+    uint32_t cir_tuneup_associated_filename;
+    uint32_t cir_fname_lower;
+    uint32_t cir_fname_without_uid_lower;
+    uint32_t cir_bundle_name_lower;
+
+    // Ranges in the author/list item arrays
+    uint32_t cir_authors_first;
+    uint32_t cir_authors_count;
+    uint32_t cir_sectionconfigs_first;
+    uint32_t cir_sectionconfigs_count;
+    uint32_t cir_addonpart_guids_first;
+    uint32_t cir_addonpart_guids_count;
+    uint32_t cir_addonpart_filenames_first;
+    uint32_t cir_addonpart_filenames_count;
+
+    int32_t  cir_categoryid;
+    int32_t  cir_version;
+    int32_t  cir_usagecounter;
+    int32_t  cir_fileformatversion;
+    int32_t  cir_nodecount;
+    int32_t  cir_beamcount;
+    int32_t  cir_shockcount;
+    int32_t  cir_fixescount;
+    int32_t  cir_hydroscount;
+    int32_t  cir_wheelcount;
+    int32_t  cir_propwheelcount;
+    int32_t  cir_commandscount;
+    int32_t  cir_flarescount;
+    int32_t  cir_propscount;
+    int32_t  cir_wingscount;
+    int32_t  cir_turbopropscount;
+    int32_t  cir_turbojetcount;
+    int32_t  cir_rotatorscount;
+    int32_t  cir_exhaustscount;
+    int32_t  cir_flexbodiescount;
+    int32_t  cir_soundsourcescount;
+    int32_t  cir_driveable;
+    int32_t  cir_numgears;
+
+    float    cir_truckmass;
+    float    cir_loadmass;
+    float    cir_minrpm;
+    float    cir_maxrpm;
+    float    cir_torque;
+
+    uint8_t  cir_has_submeshs;
+    uint8_t  cir_customtach;
+    uint8_t  cir_custom_particles;
+    uint8_t  cir_forwardcommands;
+    uint8_t  cir_importcommands;
+    uint8_t  cir_rescuer;
+    char     cir_enginetype;
+    uint8_t  cir_padding;
+};
+
+struct CacheIndex::Author
+{
+    uint32_t cia_type;
+    uint32_t cia_name;
+    uint32_t cia_email;
+    int32_t  cia_id;
+};
+
+namespace {
+
+/// Builds the shared string table; identical strings (bundle paths, extensions...) are stored once.
+class StringTableBuilder
+{
+public:
+    StringTableBuilder()
+    {
+        m_data.push_back('\0'); // Offset 0 = empty string
+    }
+
+    uint32_t Add(std::string const& str)
+    {
+        if (str.empty())
+        {
+            return 0;
+        }
+        auto itor = m_offsets.find(str);
+        if (itor != m_offsets.end())
+        {
+            return itor->second;
+        }
+        const uint32_t offset = static_cast<uint32_t>(m_data.size());
+        m_data.insert(m_data.end(), str.begin(), str.end());
+        m_data.push_back('\0');
+        m_offsets.insert(std::make_pair(str, offset));
+        return offset;
+    }
+
+    std::string const& GetData() const { return m_data; }
+
+private:
+    std::string                               m_data;
+    std::unordered_map<std::string, uint32_t> m_offsets;
+};
+
+std::string ToLower(std::string str)
+{
+    Ogre::StringUtil::toLowerCase(str);
+    return str;
+}
+
+bool IsRangeValid(uint32_t first, uint32_t count, uint32_t size)
+{
+    return first <= size && count <= size - first;
+}
+
+} // namespace
+
+bool CacheIndex::Write(std::string const& path, std::vector<CacheEntryPtr> const& entries, std::string const& global_hash)
+{
+    static_assert(sizeof(Header) % 8 == 0, "CacheIndex header must keep 8-byte alignment");
+    static_assert(sizeof(Record) % 8 == 0, "CacheIndex record must keep 8-byte alignment");
+    static_assert(sizeof(Author) % 8 == 0, "CacheIndex author must keep 8-byte alignment");
+
+    StringTableBuilder strings;
+    std::vector<Record> records;
+    std::vector<Author> authors;
+    std::vector<uint32_t> list_items;
+
+    for (CacheEntryPtr const& entry : entries)
+    {
+        if (entry->deleted)
+        {
+            continue;
+        }
+
+        Record rec;
+        std::memset(&rec, 0, sizeof(Record)); // Also clears padding - keeps the output deterministic
+        rec.cir_addtimestamp               = static_cast<int64_t>(entry->addtimestamp);
+        rec.cir_filetime                   = static_cast<int64_t>(entry->filetime);
+
+        rec.cir_fpath                      = strings.Add(entry->fpath);
+        rec.cir_fname                      = strings.Add(entry->fname);
+        rec.cir_fname_without_uid          = strings.Add(entry->fname_without_uid);
+        rec.cir_fext                       = strings.Add(entry->fext);
+        rec.cir_dname                      = strings.Add(entry->dname);
+        rec.cir_uniqueid                   = strings.Add(entry->uniqueid);
+        rec.cir_guid                       = strings.Add(entry->guid);
+        rec.cir_resource_bundle_type       = strings.Add(entry->resource_bundle_type);
+        rec.cir_resource_bundle_path       = strings.Add(entry->resource_bundle_path);
+        rec.cir_filecachename              = strings.Add(entry->filecachename);
+        rec.cir_description                = strings.Add(entry->description);
+        rec.cir_tags                       = strings.Add(entry->tags);
+        rec.cir_default_skin               = strings.Add(entry->default_skin);
+        rec.cir_tuneup_associated_filename = strings.Add(entry->tuneup_associated_filename);
+
+        std::string bundle_name, bundle_dir;
+        Ogre::StringUtil::splitFilename(entry->resource_bundle_path, bundle_name, bundle_dir);
+        rec.cir_fname_lower                = strings.Add(ToLower(entry->fname));
+        rec.cir_fname_without_uid_lower    = strings.Add(ToLower(entry->fname_without_uid));
+        rec.cir_bundle_name_lower          = strings.Add(ToLower(bundle_name));
+
+        rec.cir_authors_first = static_cast<uint32_t>(authors.size());
+        for (AuthorInfo const& author : entry->authors)
+        {
+            Author a;
+            a.cia_type  = strings.Add(author.type);
+            a.cia_name  = strings.Add(author.name);
+            a.cia_email = strings.Add(author.email);
+            a.cia_id    = author.id;
+            authors.push_back(a);
+        }
+        rec.cir_authors_count = static_cast<uint32_t>(entry->authors.size());
+
+        rec.cir_sectionconfigs_first = static_cast<uint32_t>(list_items.size());
+        for (std::string const& module_name : entry->sectionconfigs)
+        {
+            list_items.push_back(strings.Add(module_name));
+        }
+        rec.cir_sectionconfigs_count = static_cast<uint32_t>(entry->sectionconfigs.size());
+
+        rec.cir_addonpart_guids_first = static_cast<uint32_t>(list_items.size());
+        for (std::string const& guid : entry->addonpart_guids)
+        {
+            list_items.push_back(strings.Add(guid));
+        }
+        rec.cir_addonpart_guids_count = static_cast<uint32_t>(entry->addonpart_guids.size());
+
+        rec.cir_addonpart_filenames_first = static_cast<uint32_t>(list_items.size());
+        for (std::string const& fname : entry->addonpart_filenames)
+        {
+            list_items.push_back(strings.Add(fname));
+        }
+        rec.cir_addonpart_filenames_count = static_cast<uint32_t>(entry->addonpart_filenames.size());
+
+        rec.cir_categoryid                 = entry->categoryid;
+        rec.cir_version                    = entry->version;
+        rec.cir_usagecounter               = entry->usagecounter;
+        rec.cir_fileformatversion          = entry->fileformatversion;
+        rec.cir_nodecount                  = entry->nodecount;
+        rec.cir_beamcount                  = entry->beamcount;
+        rec.cir_shockcount                 = entry->shockcount;
+        rec.cir_fixescount                 = entry->fixescount;
+        rec.cir_hydroscount                = entry->hydroscount;
+        rec.cir_wheelcount                 = entry->wheelcount;
+        rec.cir_propwheelcount             = entry->propwheelcount;
+        rec.cir_commandscount              = entry->commandscount;
+        rec.cir_flarescount                = entry->flarescount;
+        rec.cir_propscount                 = entry->propscount;
+        rec.cir_wingscount                 = entry->wingscount;
+        rec.cir_turbopropscount            = entry->turbopropscount;
+        rec.cir_turbojetcount              = entry->turbojetcount;
+        rec.cir_rotatorscount              = entry->rotatorscount;
+        rec.cir_exhaustscount              = entry->exhaustscount;
+        rec.cir_flexbodiescount            = entry->flexbodiescount;
+        rec.cir_soundsourcescount          = entry->soundsourcescount;
+        rec.cir_driveable                  = static_cast<int32_t>(entry->driveable);
+        rec.cir_numgears                   = entry->numgears;
+
+        rec.cir_truckmass                  = entry->truckmass;
+        rec.cir_loadmass                   = entry->loadmass;
+        rec.cir_minrpm                     = entry->minrpm;
+        rec.cir_maxrpm                     = entry->maxrpm;
+        rec.cir_torque                     = entry->torque;
+
+        rec.cir_has_submeshs               = entry->hasSubmeshs;
+        rec.cir_customtach                 = entry->customtach;
+        rec.cir_custom_particles           = entry->custom_particles;
+        rec.cir_forwardcommands            = entry->forwardcommands;
+        rec.cir_importcommands             = entry->importcommands;
+        rec.cir_rescuer                    = entry->rescuer;
+        rec.cir_enginetype                 = entry->enginetype;
+
+        records.push_back(rec);
+    }
+
+    Header header;
+    std::memset(&header, 0, sizeof(Header));
+    std::memcpy(header.cih_signature, CACHE_INDEX_SIGNATURE, sizeof(CACHE_INDEX_SIGNATURE));
+    header.cih_index_version  = CACHE_INDEX_VERSION;
+    header.cih_format_version = CACHE_FILE_FORMAT;
+    header.cih_byte_order     = CACHE_INDEX_BYTE_ORDER;
+    header.cih_record_size    = sizeof(Record);
+    header.cih_num_records    = static_cast<uint32_t>(records.size());
+    header.cih_num_authors    = static_cast<uint32_t>(authors.size());
+    header.cih_num_list_items = static_cast<uint32_t>(list_items.size());
+    header.cih_global_hash    = strings.Add(global_hash);
+    header.cih_strings_size   = static_cast<uint32_t>(strings.GetData().size());
+
+    // Write to a temporary file first - a half-written index must never be seen.
+    const std::string tmp_path = path + ".tmp";
+    FILE* file = fopen(tmp_path.c_str(), "wb");
+    if (!file)
+    {
+        return false;
+    }
+    bool written = fwrite(&header, sizeof(Header), 1, file) == 1;
+    written = written && fwrite(records.data(), sizeof(Record), records.size(), file) == records.size();
+    written = written && fwrite(authors.data(), sizeof(Author), authors.size(), file) == authors.size();
+    written = written && fwrite(list_items.data(), sizeof(uint32_t), list_items.size(), file) == list_items.size();
+    written = written && fwrite(strings.GetData().data(), 1, strings.GetData().size(), file) == strings.GetData().size();
+    const bool closed = (fclose(file) == 0);
+    if (!written || !closed)
+    {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+
+    std::remove(path.c_str()); // Required on Windows
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+    {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool CacheIndex::Open(std::string const& path)
+{
+    this->Close();
+    if (!m_file.Open(path))
+    {
+        return false;
+    }
+
+    const uint8_t* data = m_file.GetData();
+    const size_t size = m_file.GetSize();
+    if (size < sizeof(Header))
+    {
+        this->Close();
+        return false;
+    }
+
+    m_header = reinterpret_cast<const Header*>(data);
+    const size_t records_offset = sizeof(Header);
+    const size_t authors_offset = records_offset + size_t(m_header->cih_num_records) * sizeof(Record);
+    const size_t list_offset    = authors_offset + size_t(m_header->cih_num_authors) * sizeof(Author);
+    const size_t strings_offset = list_offset    + size_t(m_header->cih_num_list_items) * sizeof(uint32_t);
+    if (std::memcmp(m_header->cih_signature, CACHE_INDEX_SIGNATURE, sizeof(CACHE_INDEX_SIGNATURE)) != 0 ||
+        m_header->cih_index_version != CACHE_INDEX_VERSION ||
+        m_header->cih_format_version != CACHE_FILE_FORMAT ||
+        m_header->cih_byte_order != CACHE_INDEX_BYTE_ORDER ||
+        m_header->cih_record_size != sizeof(Record) ||
+        m_header->cih_strings_size == 0 ||
+        strings_offset + m_header->cih_strings_size != size)
+    {
+        this->Close();
+        return false;
+    }
+
+    m_records    = reinterpret_cast<const Record*>(data + records_offset);
+    m_authors    = reinterpret_cast<const Author*>(data + authors_offset);
+    m_list_items = reinterpret_cast<const uint32_t*>(data + list_offset);
+    m_strings    = reinterpret_cast<const char*>(data + strings_offset);
+
+    if (!this->Validate())
+    {
+        this->Close();
+        return false;
+    }
+    return true;
+}
+
+bool CacheIndex::Validate() const
+{
+    const uint32_t strings_size = m_header->cih_strings_size;
+    if (m_strings[strings_size - 1] != '\0' || m_header->cih_global_hash >= strings_size)
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < m_header->cih_num_list_items; i++)
+    {
+        if (m_list_items[i] >= strings_size)
+            return false;
+    }
+
+    for (uint32_t i = 0; i < m_header->cih_num_authors; i++)
+    {
+        const Author& a = m_authors[i];
+        if (a.cia_type >= strings_size || a.cia_name >= strings_size || a.cia_email >= strings_size)
+            return false;
+    }
+
+    for (uint32_t i = 0; i < m_header->cih_num_records; i++)
+    {
+        const Record& rec = m_records[i];
+        const uint32_t refs[] =
+        {
+            rec.cir_fpath, rec.cir_fname, rec.cir_fname_without_uid, rec.cir_fext, rec.cir_dname,
+            rec.cir_uniqueid, rec.cir_guid, rec.cir_resource_bundle_type, rec.cir_resource_bundle_path,
+            rec.cir_filecachename, rec.cir_description, rec.cir_tags, rec.cir_default_skin,
+            rec.cir_tuneup_associated_filename, rec.cir_fname_lower, rec.cir_fname_without_uid_lower,
+            rec.cir_bundle_name_lower
+        };
+        for (uint32_t ref : refs)
+        {
+            if (ref >= strings_size)
+                return false;
+        }
+
+        if (!IsRangeValid(rec.cir_authors_first, rec.cir_authors_count, m_header->cih_num_authors) ||
+            !IsRangeValid(rec.cir_sectionconfigs_first, rec.cir_sectionconfigs_count, m_header->cih_num_list_items) ||
+            !IsRangeValid(rec.cir_addonpart_guids_first, rec.cir_addonpart_guids_count, m_header->cih_num_list_items) ||
+            !IsRangeValid(rec.cir_addonpart_filenames_first, rec.cir_addonpart_filenames_count, m_header->cih_num_list_items))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void CacheIndex::Close()
+{
+    m_file.Close();
+    m_header = nullptr;
+    m_records = nullptr;
+    m_authors = nullptr;
+    m_list_items = nullptr;
+    m_strings = nullptr;
+}
+
+size_t CacheIndex::GetNumEntries() const
+{
+    return (m_header) ? m_header->cih_num_records : 0;
+}
+
+std::string CacheIndex::GetGlobalHash() const
+{
+    return this->GetString(m_header->cih_global_hash);
+}
+
+const char* CacheIndex::GetFext(size_t index) const
+{
+    return this->GetString(m_records[index].cir_fext);
+}
+
+const char* CacheIndex::GetFname(size_t index) const
+{
+    return this->GetString(m_records[index].cir_fname);
+}
+
+const char* CacheIndex::GetFnameLower(size_t index) const
+{
+    return this->GetString(m_records[index].cir_fname_lower);
+}
+
+const char* CacheIndex::GetFnameWithoutUidLower(size_t index) const
+{
+    return this->GetString(m_records[index].cir_fname_without_uid_lower);
+}
+
+const char* CacheIndex::GetBundleNameLower(size_t index) const
+{
+    return this->GetString(m_records[index].cir_bundle_name_lower);
+}
+
+const char* CacheIndex::GetBundleType(size_t index) const
+{
+    return this->GetString(m_records[index].cir_resource_bundle_type);
+}
+
+const char* CacheIndex::GetBundlePath(size_t index) const
+{
+    return this->GetString(m_records[index].cir_resource_bundle_path);
+}
+
+std::time_t CacheIndex::GetFiletime(size_t index) const
+{
+    return static_cast<std::time_t>(m_records[index].cir_filetime);
+}
+
+void CacheIndex::Materialize(size_t index, CacheEntryPtr& out_entry) const
+{
+    const Record& rec = m_records[index];
+
+    // Common details
+    out_entry->usagecounter =               rec.cir_usagecounter;
+    out_entry->addtimestamp =               static_cast<std::time_t>(rec.cir_addtimestamp);
+    out_entry->resource_bundle_type =       this->GetString(rec.cir_resource_bundle_type);
+    out_entry->resource_bundle_path =       this->GetString(rec.cir_resource_bundle_path);
+    out_entry->fpath =                      this->GetString(rec.cir_fpath);
+    out_entry->fname =                      this->GetString(rec.cir_fname);
+    out_entry->fname_without_uid =          this->GetString(rec.cir_fname_without_uid);
+    out_entry->fext =                       this->GetString(rec.cir_fext);
+    out_entry->filetime =                   static_cast<std::time_t>(rec.cir_filetime);
+    out_entry->dname =                      this->GetString(rec.cir_dname);
+    out_entry->uniqueid =                   this->GetString(rec.cir_uniqueid);
+    out_entry->version =                    rec.cir_version;
+    out_entry->filecachename =              this->GetString(rec.cir_filecachename);
+    out_entry->guid =                       this->GetString(rec.cir_guid);
+    out_entry->categoryid =                 rec.cir_categoryid;
+
+    // Common - Authors
+    for (uint32_t i = rec.cir_authors_first; i < rec.cir_authors_first + rec.cir_authors_count; i++)
+    {
+        AuthorInfo author;
+        author.type  = this->GetString(m_authors[i].cia_type);
+        author.name  = this->GetString(m_authors[i].cia_name);
+        author.email = this->GetString(m_authors[i].cia_email);
+        author.id    = m_authors[i].cia_id;
+        out_entry->authors.push_back(author);
+    }
+
+    // Vehicle details
+    out_entry->description =       this->GetString(rec.cir_description);
+    out_entry->tags =              this->GetString(rec.cir_tags);
+    out_entry->default_skin =      this->GetString(rec.cir_default_skin);
+    out_entry->fileformatversion = rec.cir_fileformatversion;
+    out_entry->hasSubmeshs =       rec.cir_has_submeshs != 0;
+    out_entry->nodecount =         rec.cir_nodecount;
+    out_entry->beamcount =         rec.cir_beamcount;
+    out_entry->shockcount =        rec.cir_shockcount;
+    out_entry->fixescount =        rec.cir_fixescount;
+    out_entry->hydroscount =       rec.cir_hydroscount;
+    out_entry->wheelcount =        rec.cir_wheelcount;
+    out_entry->propwheelcount =    rec.cir_propwheelcount;
+    out_entry->commandscount =     rec.cir_commandscount;
+    out_entry->flarescount =       rec.cir_flarescount;
+    out_entry->propscount =        rec.cir_propscount;
+    out_entry->wingscount =        rec.cir_wingscount;
+    out_entry->turbopropscount =   rec.cir_turbopropscount;
+    out_entry->turbojetcount =     rec.cir_turbojetcount;
+    out_entry->rotatorscount =     rec.cir_rotatorscount;
+    out_entry->exhaustscount =     rec.cir_exhaustscount;
+    out_entry->flexbodiescount =   rec.cir_flexbodiescount;
+    out_entry->soundsourcescount = rec.cir_soundsourcescount;
+    out_entry->truckmass =         rec.cir_truckmass;
+    out_entry->loadmass =          rec.cir_loadmass;
+    out_entry->minrpm =            rec.cir_minrpm;
+    out_entry->maxrpm =            rec.cir_maxrpm;
+    out_entry->torque =            rec.cir_torque;
+    out_entry->customtach =        rec.cir_customtach != 0;
+    out_entry->custom_particles =  rec.cir_custom_particles != 0;
+    out_entry->forwardcommands =   rec.cir_forwardcommands != 0;
+    out_entry->importcommands =    rec.cir_importcommands != 0;
+    out_entry->rescuer =           rec.cir_rescuer != 0;
+    out_entry->driveable =         ActorType(rec.cir_driveable);
+    out_entry->numgears =          rec.cir_numgears;
+    out_entry->enginetype =        rec.cir_enginetype;
+
+    // Vehicle 'section-configs' (aka Modules in RigDef namespace)
+    for (uint32_t i = rec.cir_sectionconfigs_first; i < rec.cir_sectionconfigs_first + rec.cir_sectionconfigs_count; i++)
+    {
+        out_entry->sectionconfigs.push_back(this->GetString(m_list_items[i]));
+    }
+
+    // Addon part details
+    for (uint32_t i = rec.cir_addonpart_guids_first; i < rec.cir_addonpart_guids_first + rec.cir_addonpart_guids_count; i++)
+    {
+        out_entry->addonpart_guids.insert(this->GetString(m_list_items[i]));
+    }
+    for (uint32_t i = rec.cir_addonpart_filenames_first; i < rec.cir_addonpart_filenames_first + rec.cir_addonpart_filenames_count; i++)
+    {
+        out_entry->addonpart_filenames.insert(this->GetString(m_list_items[i]));
+    }
+
+    // Tuneup details
+    out_entry->tuneup_associated_filename = this->GetString(rec.cir_tuneup_associated_filename);
+}
@@ -0,0 +1,81 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+/// @brief  Binary, memory-mapped index of the mod cache - loads in no time compared to the JSON cache file.
+
+#pragma once
+
+#include "ForwardDeclarations.h"
+#include "MappedFile.h"
+
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <vector>
+
+namespace RoR {
+
+/// Read-only view of the file CACHE_INDEX_FILE, written alongside the JSON cache file (which remains as export/debug format).
+/// Layout: header, fixed-size entry records, author records, string list items, shared string table.
+/// Lowercase lookup keys are precomputed, so entries can be searched without creating `CacheEntry` objects;
+/// those are only created (see `Materialize()`) when the `CacheSystem` actually needs them.
+class CacheIndex
+{
+public:
+    static bool Write(std::string const& path, std::vector<CacheEntryPtr> const& entries, std::string const& global_hash); //!< Skips deleted entries.
+
+    bool        Open(std::string const& path); //!< Maps and validates the file; false if missing, outdated or damaged.
+    void        Close();
+    bool        IsOpen() const { return m_file.IsOpen(); }
+
+    size_t      GetNumEntries() const;
+    std::string GetGlobalHash() const;
+
+    /// @name Direct record access (no `CacheEntry` needed)
+    /// @{
+    const char* GetFext(size_t index) const;
+    const char* GetFname(size_t index) const;
+    const char* GetFnameLower(size_t index) const;
+    const char* GetFnameWithoutUidLower(size_t index) const;
+    const char* GetBundleNameLower(size_t index) const; //!< Filename of the ZIP/directory.
+    const char* GetBundleType(size_t index) const;
+    const char* GetBundlePath(size_t index) const;
+    std::time_t GetFiletime(size_t index) const;
+    /// @}
+
+    void        Materialize(size_t index, CacheEntryPtr& out_entry) const; //!< Fills in everything except `number` and `categoryname`.
+
+private:
+    struct Header;
+    struct Record;
+    struct Author;
+
+    bool        Validate() const;
+    const char* GetString(uint32_t ref) const { return m_strings + ref; }
+
+    MappedFile        m_file;
+    const Header*     m_header = nullptr;
+    const Record*     m_records = nullptr;
+    const Author*     m_authors = nullptr;
+    const uint32_t*   m_list_items = nullptr; //!< String refs of `sectionconfigs`, `addonpart_guids` and `addonpart_filenames`.
+    const char*       m_strings = nullptr;
+};
+
+} // namespace RoR
@@ -44,17 +44,20 @@
 #include "SkinFileFormat.h"
 #include "Terrain.h"
 #include "Terrn2FileFormat.h"
+#include "ThreadPool.h"
 #include "TuneupFileFormat.h"
 #include "Utils.h"
 
 #include <OgreException.h>
 #include <OgreFileSystem.h>
 #include <OgreFileSystemLayer.h>
+#include <OgreZip.h>
 #include <rapidjson/document.h>
 #include <rapidjson/istreamwrapper.h>
 #include <rapidjson/ostreamwrapper.h>
 #include <rapidjson/writer.h>
 #include <fstream>
+#include <sstream>
 
 using namespace Ogre;
 using namespace RoR;
@@ -117,6 +120,22 @@ CreateProjectRequest::~CreateProjectRequest()
     // Destructs `ActorPtr` - doesn't compile without `#include Actor.h` - not pretty if in header (even if auto-generated by C++).
 }
 
+static Ogre::Archive* CreateScanArchive(std::string const& path, std::string const& type)
+{
+    if (type == "FileSystem")
+        return Ogre::FileSystemArchiveFactory().createInstance(path, /*readOnly:*/true);
+    else
+        return Ogre::ZipArchiveFactory().createInstance(path, /*readOnly:*/true);
+}
+
+static void DestroyScanArchive(Ogre::Archive* archive)
+{
+    if (archive->getType() == "FileSystem")
+        Ogre::FileSystemArchiveFactory().destroyInstance(archive);
+    else
+        Ogre::ZipArchiveFactory().destroyInstance(archive);
+}
+
 CacheQueryResult::CacheQueryResult(CacheEntryPtr entry, size_t score):
     cqr_entry(entry),
     cqr_score(score)
@@ -148,6 +167,30 @@ CacheSystem::CacheSystem()
     m_content_dirs.push_back("terrains");
     m_content_dirs.push_back("vehicles");
     m_content_dirs.push_back("projects");
+
+    m_background_pool = std::unique_ptr<ThreadPool>(new ThreadPool(1));
+    m_background_pool->RunTask([]() { LowerCurrentThreadPriority(); });
+}
+
+CacheSystem::~CacheSystem()
+{
+    // The scans/jobs are referenced by the tasks.
+    for (auto& scan: m_watch_scans)
+    {
+        scan.second->join();
+        if (scan.first->czs_archive)
+        {
+            DestroyScanArchive(scan.first->czs_archive);
+        }
+    }
+    for (auto& job: m_thumbnail_jobs)
+    {
+        job.second->ctj_cancelled = true;
+    }
+    for (auto& job: m_thumbnail_jobs)
+    {
+        job.second->ctj_task->join();
+    }
 }
 
 void CacheSystem::LoadModCache(CacheValidity validity)
@@ -166,6 +209,7 @@ void CacheSystem::LoadModCache(CacheValidity validity)
         {
             RoR::Log("[RoR|ModCache] Performing update ...");
             this->ClearResourceGroups();
+            this->GenerateDirFingerprints(); // Content may have changed since startup
             this->PruneCache();
         }
         const bool orig_echo = App::diag_log_console_echo->getBool();
@@ -175,12 +219,33 @@ void CacheSystem::LoadModCache(CacheValidity validity)
         App::diag_log_console_echo->setVal(orig_echo);
         this->DetectDuplicates();
         this->WriteCacheFileJson();
+        this->WriteCacheIndex(m_filenames_hash_generated);
+        this->WriteDirFingerprints();
 
-        this->LoadCacheFileJson();
+        this->LoadCacheFile();
+    }
+    else if (m_dir_fingerprints_loaded != m_dir_fingerprints_generated)
+    {
+        this->WriteDirFingerprints(); // The changed directories were checked - no need to do it again next time.
     }
 
     RoR::Log("[RoR|ModCache] Cache loaded");
     m_loaded = true;
+    this->StartWatchingContentDirs();
+}
+
+static std::string GetBundleParentDir(std::string const& bundle_path)
+{
+    // ZIP paths are composed by `PathCombine()` from the directory's archive name, see `ParseZipArchives()`.
+    const size_t pos = bundle_path.rfind(PATH_SLASH);
+    return (pos != std::string::npos) ? bundle_path.substr(0, pos) : "";
+}
+
+static bool IsLookupTypeMatch(LoaderType type, std::string const& fext)
+{
+    return (type == LT_Terrain) == (fext == "terrn2") &&
+        (type == LT_DashBoard) == (fext == "dashboard") &&
+        !(type == LT_AllBeam && fext == "skin");
 }
 
 CacheEntryPtr CacheSystem::FindEntryByFilename(LoaderType type, bool partial, const std::string& _filename_maybe_bundlequalified)
@@ -194,47 +259,50 @@ CacheEntryPtr CacheSystem::FindEntryByFilename(LoaderType type, bool partial, co
     SplitBundleQualifiedFilename(_filename_maybe_bundlequalified, bundlename, filename);
     StringUtil::toLowerCase(filename);
     StringUtil::toLowerCase(bundlename);
-    size_t partial_match_length = std::numeric_limits<size_t>::max();
     CacheEntryPtr partial_match = nullptr;
     std::vector<CacheEntryPtr> log_candidates;
-    for (CacheEntryPtr& entry : m_entries)
+
+    // Exact match - by filename or by filename without UID.
+    auto found = m_lookup_by_fname.find(filename);
+    if (found != m_lookup_by_fname.end())
     {
-        if ((type == LT_Terrain) != (entry->fext == "terrn2") ||
-            (type == LT_DashBoard) != (entry->fext == "dashboard") ||
-            (type == LT_AllBeam && entry->fext == "skin"))
-            continue;
+        for (size_t i: found->second)
+        {
+            if (!IsLookupTypeMatch(type, m_lookup_keys[i].clk_fext))
+                continue;
 
-        String fname = entry->fname;
-        String fname_without_uid = entry->fname_without_uid;
-        String bname;
-        String _path_placeholder;
-        StringUtil::splitFilename(entry->resource_bundle_path, bname, _path_placeholder);
-        StringUtil::toLowerCase(fname);
-        StringUtil::toLowerCase(fname_without_uid);
-        StringUtil::toLowerCase(bname);
-        if (fname == filename || fname_without_uid == filename)
-        {
-            if (bundlename == "" || bname == bundlename)
+            if (bundlename == "" || m_lookup_keys[i].clk_bundle_name == bundlename)
             {
-                return entry;
+                return this->MaterializeEntry(i);
             }
             else
             {
-                log_candidates.push_back(entry);
+                log_candidates.push_back(this->MaterializeEntry(i));
             }
         }
-        else if (partial &&
-            fname.length() < partial_match_length &&
-            fname.find(filename) != std::string::npos)
+    }
+
+    // Partial match - the shortest filename wins; names shorter than the search string can't contain it.
+    if (partial)
+    {
+        auto itor = std::lower_bound(m_lookup_by_length.begin(), m_lookup_by_length.end(), filename.length(),
+            [this](size_t slot, size_t length) { return m_lookup_keys[slot].clk_fname.length() < length; });
+        for (; itor != m_lookup_by_length.end(); ++itor)
         {
-            if (bundlename == "" || bname == bundlename)
+            const CacheLookupKeys& keys = m_lookup_keys[*itor];
+            if (!IsLookupTypeMatch(type, keys.clk_fext) ||
+                keys.clk_fname == filename || keys.clk_fname_without_uid == filename || // Already checked above
+                keys.clk_fname.find(filename) == std::string::npos)
+                continue;
+
+            if (bundlename == "" || keys.clk_bundle_name == bundlename)
             {
-                partial_match = entry;
-                partial_match_length = fname.length();
+                partial_match = this->MaterializeEntry(*itor);
+                break;
             }
             else
             {
-                log_candidates.push_back(entry);
+                log_candidates.push_back(this->MaterializeEntry(*itor));
             }
         }
     }
@@ -259,9 +327,11 @@ CacheEntryPtr CacheSystem::FindEntryByFilename(LoaderType type, bool partial, co
 CacheValidity CacheSystem::EvaluateCacheValidity()
 {
     this->GenerateHashFromFilenames();
+    this->GenerateDirFingerprints();
+    this->LoadDirFingerprints();
 
     // Load cache file
-    CacheValidity validity = this->LoadCacheFileJson();
+    CacheValidity validity = this->LoadCacheFile();
 
     if (validity != CacheValidity::VALID)
     {
@@ -276,15 +346,25 @@ CacheValidity CacheSystem::EvaluateCacheValidity()
         return CacheValidity::NEEDS_UPDATE;
     }
 
-    for (auto& entry : m_entries)
+    std::string last_checked_fn;
+    for (size_t i = 0; i < m_entries.size(); i++)
     {
-        std::string fn = entry->resource_bundle_path;
-        if (entry->resource_bundle_type == "FileSystem")
+        // Read from the index if possible, so that no entries get materialized on startup.
+        const CacheEntryPtr& entry = m_entries[i];
+        std::string fn = (entry) ? entry->resource_bundle_path : m_index.GetBundlePath(i);
+        const std::string bundle_type = (entry) ? entry->resource_bundle_type : m_index.GetBundleType(i);
+        if (bundle_type == "FileSystem")
         {
-            fn = PathCombine(fn, entry->fname);
+            fn = PathCombine(fn, (entry) ? entry->fname : m_index.GetFname(i));
         }
+        else if (fn == last_checked_fn || this->IsDirUnchanged(GetBundleParentDir(fn)))
+        {
+            continue; // Entries from one ZIP are listed together; ZIPs in unchanged directories need no check.
+        }
+        last_checked_fn = fn;
 
-        if ((entry->filetime != RoR::GetFileLastModifiedTime(fn)))
+        const std::time_t filetime = (entry) ? entry->filetime : m_index.GetFiletime(i);
+        if ((filetime != RoR::GetFileLastModifiedTime(fn)))
         {
             return CacheValidity::NEEDS_UPDATE;
         }
@@ -294,6 +374,91 @@ CacheValidity CacheSystem::EvaluateCacheValidity()
     return CacheValidity::VALID;
 }
 
+void CacheSystem::GenerateDirFingerprints()
+{
+    m_dir_fingerprints_generated.clear();
+
+    // Group the files by directory; sort them because the listing order isn't guaranteed.
+    std::map<std::string, std::vector<std::pair<std::string, size_t>>> dir_listings;
+    auto file_list = ResourceGroupManager::getSingleton().listResourceFileInfo(RGN_CONTENT, false);
+    for (const auto& file: *file_list)
+    {
+        if (file.archive && file.archive->getType() == "FileSystem")
+        {
+            dir_listings[file.archive->getName()].emplace_back(file.filename, file.uncompressedSize);
+        }
+    }
+
+    for (auto& dir_listing: dir_listings)
+    {
+        std::sort(dir_listing.second.begin(), dir_listing.second.end());
+        std::stringstream buf;
+        for (auto& file: dir_listing.second)
+        {
+            buf << file.first << '\t' << file.second << std::endl;
+        }
+        const std::string listing = buf.str();
+
+        CacheDirFingerprint& fingerprint = m_dir_fingerprints_generated[dir_listing.first];
+        fingerprint.cdf_mtime = RoR::GetFileLastModifiedTime(dir_listing.first);
+        fingerprint.cdf_listing_hash = HashData(listing.c_str(), static_cast<int>(listing.size()));
+    }
+}
+
+void CacheSystem::LoadDirFingerprints()
+{
+    m_dir_fingerprints_loaded.clear();
+
+    rapidjson::Document j_doc;
+    if (!App::GetContentManager()->LoadAndParseJson(CACHE_DIRS_FILE, RGN_CACHE, j_doc) ||
+        !j_doc.IsObject() || !j_doc.HasMember("dirs") || !j_doc["dirs"].IsArray() ||
+        !j_doc.HasMember("format_version") || j_doc["format_version"].GetInt() != CACHE_FILE_FORMAT)
+    {
+        RoR::Log("[RoR|ModCache] Directory fingerprints missing or invalid, all files will be checked");
+        return;
+    }
+
+    for (rapidjson::Value& j_dir: j_doc["dirs"].GetArray())
+    {
+        CacheDirFingerprint& fingerprint = m_dir_fingerprints_loaded[j_dir["path"].GetString()];
+        fingerprint.cdf_mtime = static_cast<std::time_t>(j_dir["mtime"].GetInt64());
+        fingerprint.cdf_listing_hash = j_dir["listing_hash"].GetString();
+    }
+}
+
+void CacheSystem::WriteDirFingerprints()
+{
+    rapidjson::Document j_doc;
+    j_doc.SetObject();
+    j_doc.AddMember("format_version", CACHE_FILE_FORMAT, j_doc.GetAllocator());
+
+    rapidjson::Value j_dirs(rapidjson::kArrayType);
+    for (auto& dir_fingerprint: m_dir_fingerprints_generated)
+    {
+        rapidjson::Value j_dir(rapidjson::kObjectType);
+        j_dir.AddMember("path", rapidjson::StringRef(dir_fingerprint.first.c_str()), j_doc.GetAllocator());
+        j_dir.AddMember("mtime", static_cast<int64_t>(dir_fingerprint.second.cdf_mtime), j_doc.GetAllocator());
+        j_dir.AddMember("listing_hash", rapidjson::StringRef(dir_fingerprint.second.cdf_listing_hash.c_str()), j_doc.GetAllocator());
+        j_dirs.PushBack(j_dir, j_doc.GetAllocator());
+    }
+    j_doc.AddMember("dirs", j_dirs, j_doc.GetAllocator());
+
+    if (App::GetContentManager()->SerializeAndWriteJson(CACHE_DIRS_FILE, RGN_CACHE, j_doc)) // Logs errors
+    {
+        RoR::LogFormat("[RoR|ModCache] File '%s' written OK", CACHE_DIRS_FILE);
+        m_dir_fingerprints_loaded = m_dir_fingerprints_generated;
+    }
+}
+
+bool CacheSystem::IsDirUnchanged(std::string const& dir) const
+{
+    auto loaded = m_dir_fingerprints_loaded.find(dir);
+    auto generated = m_dir_fingerprints_generated.find(dir);
+    return loaded != m_dir_fingerprints_loaded.end()
+        && generated != m_dir_fingerprints_generated.end()
+        && loaded->second == generated->second;
+}
+
 void CacheSystem::ImportEntryFromJson(rapidjson::Value& j_entry, CacheEntryPtr & out_entry)
 {
     // Common details
@@ -315,14 +480,8 @@ void CacheSystem::ImportEntryFromJson(rapidjson::Value& j_entry, CacheEntryPtr &
     Ogre::StringUtil::trim(out_entry->guid);
 
     // Category
-    int category_id = j_entry["categoryid"].GetInt();
-    auto category_itor = m_categories.find(category_id);
-    if (category_itor == m_categories.end() || category_id >= CID_Max)
-    {
-        category_itor = m_categories.find(CID_Unsorted);
-    }
-    out_entry->categoryname = category_itor->second;
-    out_entry->categoryid = category_itor->first;
+    out_entry->categoryid = j_entry["categoryid"].GetInt();
+    this->ResolveCategory(out_entry);
 
      // Common - Authors
     for (rapidjson::Value& j_author: j_entry["authors"].GetArray())
@@ -400,6 +559,9 @@ CacheValidity CacheSystem::LoadCacheFileJson()
 {
     // Clear existing entries
     m_entries.clear();
+    m_index.Close();
+    m_num_lazy_entries = 0;
+    this->RebuildLookupIndexes();
 
     rapidjson::Document j_doc;
     if (!App::GetContentManager()->LoadAndParseJson(CACHE_FILE, RGN_CACHE, j_doc) ||
@@ -422,15 +584,257 @@ CacheValidity CacheSystem::LoadCacheFileJson()
         entry->number = static_cast<int>(m_entries.size() + 1); // Let's number mods from 1
         m_entries.push_back(entry);
     }
+    this->RebuildLookupIndexes();
 
     m_filenames_hash_loaded = j_doc["global_hash"].GetString();
 
     return CacheValidity::VALID;
 }
 
+CacheValidity CacheSystem::LoadCacheFile()
+{
+    if (this->LoadCacheIndex() == CacheValidity::VALID)
+    {
+        return CacheValidity::VALID;
+    }
+
+    CacheValidity validity = this->LoadCacheFileJson(); // i.e. first start after update
+    if (validity == CacheValidity::VALID)
+    {
+        this->WriteCacheIndex(m_filenames_hash_loaded); // For the next start
+    }
+    return validity;
+}
+
+CacheValidity CacheSystem::LoadCacheIndex()
+{
+    // Clear existing entries
+    m_entries.clear();
+    m_num_lazy_entries = 0;
+    this->RebuildLookupIndexes();
+
+    if (!m_index.Open(PathCombine(App::sys_cache_dir->getStr(), CACHE_INDEX_FILE)))
+    {
+        RoR::Log("[RoR|ModCache] Cache index missing, outdated or damaged");
+        return CacheValidity::NEEDS_REBUILD;
+    }
+
+    // The entries are created on first access, see `MaterializeEntry()`
+    m_entries.resize(m_index.GetNumEntries());
+    m_num_lazy_entries = m_entries.size();
+    m_filenames_hash_loaded = m_index.GetGlobalHash();
+    this->RebuildLookupIndexes(); // Needs the index mapped
+    if (m_num_lazy_entries == 0)
+    {
+        m_index.Close();
+    }
+
+    RoR::LogFormat("[RoR|ModCache] Mapped cache index with %d entries", static_cast<int>(m_entries.size()));
+    return CacheValidity::VALID;
+}
+
+void CacheSystem::WriteCacheIndex(std::string const& global_hash)
+{
+    this->MaterializeAllEntries(); // Also unmaps the current index
+    const std::string path = PathCombine(App::sys_cache_dir->getStr(), CACHE_INDEX_FILE);
+    if (CacheIndex::Write(path, m_entries, global_hash))
+    {
+        RoR::LogFormat("[RoR|ModCache] File '%s' written OK", CACHE_INDEX_FILE);
+    }
+    else
+    {
+        RoR::LogFormat("[RoR|ModCache] Error writing file '%s'", path.c_str());
+    }
+}
+
+CacheEntryPtr CacheSystem::MaterializeEntry(size_t index)
+{
+    if (!m_entries[index])
+    {
+        CacheEntryPtr entry = new CacheEntry();
+        m_index.Materialize(index, entry);
+        Ogre::StringUtil::trim(entry->guid);
+        this->ResolveCategory(entry);
+        entry->number = static_cast<int>(index + 1); // Let's number mods from 1
+        m_entries[index] = entry;
+        this->AddMaterializedLookupKeys(index);
+
+        if (--m_num_lazy_entries == 0)
+        {
+            m_index.Close();
+        }
+    }
+    return m_entries[index];
+}
+
+void CacheSystem::MaterializeAllEntries()
+{
+    for (size_t i = 0; m_num_lazy_entries > 0 && i < m_entries.size(); i++)
+    {
+        this->MaterializeEntry(i);
+    }
+}
+
+void CacheSystem::ResolveCategory(CacheEntryPtr& entry)
+{
+    auto category_itor = m_categories.find(entry->categoryid);
+    if (category_itor == m_categories.end() || entry->categoryid >= CID_Max)
+    {
+        category_itor = m_categories.find(CID_Unsorted);
+    }
+    entry->categoryname = category_itor->second;
+    entry->categoryid = category_itor->first;
+}
+
+void CacheSystem::AddToLookupIndexes(size_t slot)
+{
+    m_entries_revision++;
+    this->AddLookupKeys(slot);
+
+    // Slots are appended, so among equally long filenames this one goes last.
+    auto pos = std::upper_bound(m_lookup_by_length.begin(), m_lookup_by_length.end(), m_lookup_keys[slot].clk_fname.length(),
+        [this](size_t length, size_t other) { return length < m_lookup_keys[other].clk_fname.length(); });
+    m_lookup_by_length.insert(pos, slot);
+}
+
+void CacheSystem::RebuildLookupIndexes()
+{
+    m_entries_revision++;
+    m_lookup_keys.clear();
+    m_lookup_by_fname.clear();
+    m_lookup_by_guid.clear();
+    m_lookup_by_length.clear();
+    m_search_trigrams.clear();
+
+    m_lookup_keys.reserve(m_entries.size());
+    m_lookup_by_length.reserve(m_entries.size());
+    for (size_t i = 0; i < m_entries.size(); i++)
+    {
+        this->AddLookupKeys(i);
+        m_lookup_by_length.push_back(i);
+    }
+    std::sort(m_lookup_by_length.begin(), m_lookup_by_length.end(), [this](size_t a, size_t b)
+        {
+            const size_t len_a = m_lookup_keys[a].clk_fname.length();
+            const size_t len_b = m_lookup_keys[b].clk_fname.length();
+            return (len_a != len_b) ? (len_a < len_b) : (a < b);
+        });
+}
+
+void CacheSystem::AddLookupKeys(size_t slot)
+{
+    ROR_ASSERT(slot == m_lookup_keys.size());
+    CacheLookupKeys keys;
+    if (m_entries[slot])
+    {
+        keys.clk_fext = m_entries[slot]->fext;
+        keys.clk_fname = m_entries[slot]->fname;
+        keys.clk_fname_without_uid = m_entries[slot]->fname_without_uid;
+        std::string _path_placeholder;
+        StringUtil::splitFilename(m_entries[slot]->resource_bundle_path, keys.clk_bundle_name, _path_placeholder);
+        StringUtil::toLowerCase(keys.clk_fname);
+        StringUtil::toLowerCase(keys.clk_fname_without_uid);
+        StringUtil::toLowerCase(keys.clk_bundle_name);
+    }
+    else
+    {
+        // Not materialized yet - use the precomputed keys from the index.
+        keys.clk_fext = m_index.GetFext(slot);
+        keys.clk_fname = m_index.GetFnameLower(slot);
+        keys.clk_fname_without_uid = m_index.GetFnameWithoutUidLower(slot);
+        keys.clk_bundle_name = m_index.GetBundleNameLower(slot);
+    }
+
+    m_lookup_by_fname[keys.clk_fname].push_back(slot);
+    if (keys.clk_fname_without_uid != keys.clk_fname)
+    {
+        m_lookup_by_fname[keys.clk_fname_without_uid].push_back(slot);
+    }
+    m_lookup_keys.push_back(keys);
+
+    if (m_entries[slot])
+    {
+        this->AddMaterializedLookupKeys(slot);
+    }
+}
+
+static uint32_t MakeTrigram(std::string const& str, size_t pos)
+{
+    return (static_cast<uint32_t>(static_cast<unsigned char>(str[pos])) << 16) |
+        (static_cast<uint32_t>(static_cast<unsigned char>(str[pos + 1])) << 8) |
+        static_cast<uint32_t>(static_cast<unsigned char>(str[pos + 2]));
+}
+
+static void CollectTrigrams(std::string const& str, std::vector<uint32_t>& out_trigrams)
+{
+    for (size_t i = 0; i + 3 <= str.length(); i++)
+    {
+        out_trigrams.push_back(MakeTrigram(str, i));
+    }
+}
+
+void CacheSystem::AddMaterializedLookupKeys(size_t slot)
+{
+    // Entries get materialized in any order - keep the slot lists sorted.
+    auto add_key = [this, slot](std::string const& guid)
+        {
+            std::vector<size_t>& slots = m_lookup_by_guid[guid];
+            slots.insert(std::upper_bound(slots.begin(), slots.end(), slot), slot);
+        };
+
+    const CacheEntryPtr& entry = m_entries[slot];
+    CacheLookupKeys& keys = m_lookup_keys[slot];
+
+    // Full-text keys, lowercase like the search string - see `Query()`
+    keys.clk_dname = entry->dname;
+    keys.clk_description = entry->description;
+    keys.clk_guid = entry->guid;
+    StringUtil::toLowerCase(keys.clk_dname);
+    StringUtil::toLowerCase(keys.clk_description);
+    StringUtil::toLowerCase(keys.clk_guid);
+    keys.clk_authors.clear();
+    for (AuthorInfo const& author: entry->authors)
+    {
+        keys.clk_authors.emplace_back(author.name, author.email);
+        StringUtil::toLowerCase(keys.clk_authors.back().first);
+        StringUtil::toLowerCase(keys.clk_authors.back().second);
+    }
+
+    std::vector<uint32_t> trigrams;
+    CollectTrigrams(keys.clk_dname, trigrams);
+    CollectTrigrams(keys.clk_fname, trigrams);
+    CollectTrigrams(keys.clk_description, trigrams);
+    CollectTrigrams(keys.clk_guid, trigrams);
+    for (auto& author: keys.clk_authors)
+    {
+        CollectTrigrams(author.first, trigrams);
+        CollectTrigrams(author.second, trigrams);
+    }
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+    for (uint32_t trigram: trigrams)
+    {
+        m_search_trigrams[trigram].push_back(static_cast<uint32_t>(slot)); // Order doesn't matter, see `FindSearchCandidates()`
+    }
+
+    // GUIDs
+    if (entry->fext == "addonpart")
+    {
+        for (std::string const& guid: entry->addonpart_guids) // Addon parts have `guid` empty
+        {
+            add_key(guid);
+        }
+    }
+    else if (entry->guid != "")
+    {
+        add_key(entry->guid);
+    }
+}
+
 void CacheSystem::PruneCache()
 {
-    this->LoadCacheFileJson();
+    this->LoadCacheFile();
+    this->MaterializeAllEntries();
 
     std::vector<String> paths;
     for (auto& entry : m_entries)
@@ -440,6 +844,11 @@ void CacheSystem::PruneCache()
         {
             fn = PathCombine(fn, entry->fname);
         }
+        else if (this->IsDirUnchanged(GetBundleParentDir(fn)))
+        {
+            m_resource_paths.insert(fn); // Only ZIPs in changed directories need checking
+            continue;
+        }
 
         if (!RoR::FileExists(fn.c_str()) || (entry->filetime != RoR::GetFileLastModifiedTime(fn)))
         {
@@ -463,6 +872,7 @@ void CacheSystem::PruneCache()
 
 void CacheSystem::ClearResourceGroups()
 {
+    this->MaterializeAllEntries();
     for (auto& entry : m_entries)
     {
         String group = entry->resource_group;
@@ -476,6 +886,7 @@ void CacheSystem::ClearResourceGroups()
 
 void CacheSystem::DetectDuplicates()
 {
+    this->MaterializeAllEntries();
     RoR::Log("[RoR|ModCache] Searching for duplicates ...");
     std::map<String, String> possible_duplicates;
     for (int i=0; i<m_entries.size(); i++) 
@@ -548,6 +959,12 @@ void CacheSystem::DetectDuplicates()
 
 CacheEntryPtr CacheSystem::GetEntryByNumber(int modid)
 {
+    // While some entries are still in the index, all entries are numbered by position (see `MaterializeEntry()`).
+    if (m_num_lazy_entries > 0 && modid >= 1 && modid <= static_cast<int>(m_entries.size()))
+    {
+        return this->MaterializeEntry(static_cast<size_t>(modid - 1));
+    }
+
     for (CacheEntryPtr& entry: m_entries)
     {
         if (modid == entry->number)
@@ -558,6 +975,7 @@ CacheEntryPtr CacheSystem::GetEntryByNumber(int modid)
 
 String CacheSystem::GetPrettyName(String fname)
 {
+    this->MaterializeAllEntries();
     for (CacheEntryPtr& entry: m_entries)
     {
         if (fname == entry->fname)
@@ -685,6 +1103,7 @@ void CacheSystem::ExportEntryToJson(rapidjson::Value& j_entries, rapidjson::Docu
 
 void CacheSystem::WriteCacheFileJson()
 {
+    this->MaterializeAllEntries();
     // Basic file structure
     rapidjson::Document j_doc;
     j_doc.SetObject();
@@ -711,7 +1130,11 @@ void CacheSystem::WriteCacheFileJson()
 
 void CacheSystem::ClearCache()
 {
+    this->MaterializeAllEntries(); // Also unmaps the index
     App::GetContentManager()->DeleteDiskFile(CACHE_FILE, RGN_CACHE);
+    App::GetContentManager()->DeleteDiskFile(CACHE_INDEX_FILE, RGN_CACHE);
+    App::GetContentManager()->DeleteDiskFile(CACHE_DIRS_FILE, RGN_CACHE);
+    m_dir_fingerprints_loaded.clear();
     for (auto& entry : m_entries)
     {
         String group = entry->resource_group;
@@ -723,6 +1146,7 @@ void CacheSystem::ClearCache()
         this->RemoveFileCache(entry);
     }
     m_entries.clear();
+    this->RebuildLookupIndexes();
 }
 
 Ogre::String CacheSystem::StripUIDfromString(Ogre::String uidstr)
@@ -741,8 +1165,9 @@ Ogre::String CacheSystem::StripSHA1fromString(Ogre::String sha1str)
     return sha1str;
 }
 
-void CacheSystem::AddFile(String group, Ogre::FileInfo f, String ext)
+void CacheSystem::AddFile(Ogre::FileInfo f, String ext, RigDef::DocumentPtr truck_def)
 {
+    this->MaterializeAllEntries();
     String type = f.archive ? f.archive->getType() : "FileSystem";
     String path = f.archive ? f.archive->getName() : "";
 
@@ -754,7 +1179,7 @@ void CacheSystem::AddFile(String group, Ogre::FileInfo f, String ext)
 
     try
     {
-        DataStreamPtr ds = ResourceGroupManager::getSingleton().openResource(f.filename, group);
+        DataStreamPtr ds = f.archive->open(f.filename);
         // ds closes automatically, so do _not_ close it explicitly below
 
         std::vector<CacheEntryPtr> new_entries;
@@ -810,8 +1235,12 @@ void CacheSystem::AddFile(String group, Ogre::FileInfo f, String ext)
         }
         else
         {
+            if (!truck_def)
+            {
+                truck_def = CacheSystem::ParseTruckDetailInfo(ds, path);
+            }
             CacheEntryPtr entry = new CacheEntry();
-            FillTruckDetailInfo(entry, ds, f.filename, group);
+            FillTruckDetailInfo(entry, truck_def, f.filename);
             new_entries.push_back(entry);
         }
 
@@ -834,8 +1263,9 @@ void CacheSystem::AddFile(String group, Ogre::FileInfo f, String ext)
             entry->resource_bundle_path = path;
             entry->number = static_cast<int>(m_entries.size() + 1); // Let's number mods from 1
             entry->addtimestamp = m_update_time;
-            this->GenerateFileCache(entry, group);
+            this->GenerateFileCache(entry, f.archive);
             m_entries.push_back(entry);
+            this->AddToLookupIndexes(m_entries.size() - 1);
             // This isn't just for script, it also triggers retry-spawn in multiplayer, see `case MSG_SIM_SCRIPT_EVENT_TRIGGERED:` in main.cpp
             TRIGGER_EVENT_ASYNC(SE_GENERIC_MODCACHE_ACTIVITY, MODCACHEACTIVITY_ENTRY_ADDED, entry->number, 0,0, entry->fname, entry->fext);
         }
@@ -847,19 +1277,18 @@ void CacheSystem::AddFile(String group, Ogre::FileInfo f, String ext)
     }
 }
 
-void CacheSystem::FillTruckDetailInfo(CacheEntryPtr& entry, Ogre::DataStreamPtr stream, String file_name, String group)
+RigDef::DocumentPtr CacheSystem::ParseTruckDetailInfo(Ogre::DataStreamPtr stream, String bundle_path)
 {
-    /* LOAD AND PARSE THE VEHICLE */
     RigDef::Parser parser;
     parser.Prepare();
-    parser.ProcessOgreStream(stream.get(), group);
+    parser.ProcessOgreStream(stream.get(), bundle_path);
     parser.GetSequentialImporter()->Disable();
     parser.Finalize();
+    return parser.GetFile();
+}
 
-    /* RETRIEVE DATA */
-
-    RigDef::DocumentPtr def = parser.GetFile();
-
+void CacheSystem::FillTruckDetailInfo(CacheEntryPtr& entry, RigDef::DocumentPtr def, String file_name)
+{
     /* Name */
     if (!def->name.empty())
     {
@@ -1051,15 +1480,15 @@ void CacheSystem::FillTruckDetailInfo(CacheEntryPtr& entry, Ogre::DataStreamPtr
     /* NOTE: std::shared_ptr cleans everything up. */
 }
 
-Ogre::String detectMiniType(String filename, String group)
+Ogre::String detectMiniType(String filename, Ogre::Archive* archive)
 {
-    if (ResourceGroupManager::getSingleton().resourceExists(group, filename + "dds"))
+    if (archive->exists(filename + "dds"))
         return "dds";
 
-    if (ResourceGroupManager::getSingleton().resourceExists(group, filename + "png"))
+    if (archive->exists(filename + "png"))
         return "png";
 
-    if (ResourceGroupManager::getSingleton().resourceExists(group, filename + "jpg"))
+    if (archive->exists(filename + "jpg"))
         return "jpg";
 
     return "";
@@ -1070,10 +1499,26 @@ void CacheSystem::RemoveFileCache(CacheEntryPtr& entry)
     if (!entry->filecachename.empty())
     {
         App::GetContentManager()->DeleteDiskFile(entry->filecachename, RGN_CACHE);
+
+        // The mod may be updated under the same name - forget the old image.
+        m_thumbnail_failures.erase(entry->filecachename);
+        auto itor = std::find(m_thumbnail_textures.begin(), m_thumbnail_textures.end(), entry->filecachename);
+        if (itor != m_thumbnail_textures.end())
+        {
+            Ogre::TextureManager::getSingleton().remove(entry->filecachename, RGN_CACHE);
+            m_thumbnail_textures.erase(itor);
+        }
+        auto file_itor = std::find_if(m_thumbnail_files.begin(), m_thumbnail_files.end(),
+            [&entry](std::pair<std::string, size_t> const& file) { return file.first == entry->filecachename; });
+        if (file_itor != m_thumbnail_files.end())
+        {
+            m_thumbnail_files_size -= file_itor->second;
+            m_thumbnail_files.erase(file_itor);
+        }
     }
 }
 
-void CacheSystem::GenerateFileCache(CacheEntryPtr& entry, String group)
+void CacheSystem::GenerateFileCache(CacheEntryPtr& entry, Ogre::Archive* archive)
 {
     if (entry->fname.empty())
         return;
@@ -1081,13 +1526,11 @@ void CacheSystem::GenerateFileCache(CacheEntryPtr& entry, String group)
     String bundle_basename, bundle_path;
     StringUtil::splitFilename(entry->resource_bundle_path, bundle_basename, bundle_path);
 
-    String src_path;
     String dst_path;
     if (entry->fext == "skin")
     {
         if (entry->skin_def->thumbnail.empty())
             return;
-        src_path = entry->skin_def->thumbnail;
         String mini_fbase, minitype;
         StringUtil::splitBaseFilename(entry->skin_def->thumbnail, mini_fbase, minitype);
         dst_path = bundle_basename + "_" + mini_fbase + ".mini." + minitype;
@@ -1097,31 +1540,239 @@ void CacheSystem::GenerateFileCache(CacheEntryPtr& entry, String group)
         String fbase, fext;
         StringUtil::splitBaseFilename(entry->fname, fbase, fext);
         String minifn = fbase + "-mini.";
-        String minitype = detectMiniType(minifn, group);
+        String minitype = detectMiniType(minifn, archive);
         if (minitype.empty())
             return;
-        src_path = minifn + minitype;
         dst_path = bundle_basename + "_" + entry->fname + ".mini." + minitype;
     }
 
+    // The image is only extracted when first displayed, see `FetchThumbnail()`
+    entry->filecachename = dst_path;
+}
+
+static std::string GetThumbnailSourceName(const CacheEntryPtr& entry)
+{
+    // Reverses the naming in `GenerateFileCache()`
+    String bundle_basename, bundle_path;
+    StringUtil::splitFilename(entry->resource_bundle_path, bundle_basename, bundle_path);
+    const std::string prefix = bundle_basename + "_";
+    const size_t mini_pos = entry->filecachename.rfind(".mini.");
+    if (entry->filecachename.compare(0, prefix.length(), prefix) != 0 || mini_pos == std::string::npos || mini_pos < prefix.length())
+    {
+        return "";
+    }
+
+    const std::string minitype = entry->filecachename.substr(mini_pos + 6);
+    if (entry->fext == "skin")
+    {
+        return entry->filecachename.substr(prefix.length(), mini_pos - prefix.length()) + "." + minitype;
+    }
+    else
+    {
+        String fbase, fext;
+        StringUtil::splitBaseFilename(entry->fname, fbase, fext);
+        return fbase + "-mini." + minitype;
+    }
+}
+
+Ogre::TexturePtr CacheSystem::FetchThumbnail(const CacheEntryPtr& entry)
+{
+    if (entry->filecachename.empty() || m_thumbnail_failures.count(entry->filecachename))
+    {
+        return Ogre::TexturePtr();
+    }
+
+    // Already in GPU?
+    Ogre::TexturePtr tex = Ogre::TextureManager::getSingleton().getByName(entry->filecachename, RGN_CACHE);
+    if (tex)
+    {
+        auto itor = std::find(m_thumbnail_textures.begin(), m_thumbnail_textures.end(), entry->filecachename);
+        if (itor != m_thumbnail_textures.end())
+        {
+            m_thumbnail_textures.splice(m_thumbnail_textures.begin(), m_thumbnail_textures, itor);
+        }
+        return tex;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    auto found = m_thumbnail_jobs.find(entry->filecachename);
+    if (found == m_thumbnail_jobs.end())
+    {
+        // Drop what isn't on screen anymore and keep the queue short, so the worker only decodes what's wanted now.
+        for (auto itor = m_thumbnail_jobs.begin(); itor != m_thumbnail_jobs.end(); )
+        {
+            if (now - itor->second->ctj_last_request < std::chrono::milliseconds(CACHE_THUMBNAILS_STALE_TIME_MS))
+            {
+                ++itor;
+            }
+            else if (itor->second->ctj_task->is_finished())
+            {
+                itor = m_thumbnail_jobs.erase(itor);
+            }
+            else
+            {
+                itor->second->ctj_cancelled = true; // Finishes quickly; erased next time.
+                ++itor;
+            }
+        }
+        if (m_thumbnail_jobs.size() >= CACHE_THUMBNAILS_MAX_JOBS)
+        {
+            return Ogre::TexturePtr(); // Will be requested again.
+        }
+
+        std::unique_ptr<CacheThumbnailJob> job(new CacheThumbnailJob());
+        job->ctj_name = entry->filecachename;
+        job->ctj_bundle_path = entry->resource_bundle_path;
+        job->ctj_bundle_type = entry->resource_bundle_type;
+        job->ctj_src_name = GetThumbnailSourceName(entry);
+        job->ctj_downscale = (entry->fext != "dashboard");
+        job->ctj_last_request = now;
+        CacheThumbnailJob* job_ptr = job.get();
+        job->ctj_task = m_background_pool->RunTask([job_ptr]()
+            {
+                CacheSystem::PrepareThumbnail(*job_ptr);
+            });
+        m_thumbnail_jobs.insert(std::make_pair(entry->filecachename, std::move(job)));
+        return Ogre::TexturePtr();
+    }
+    found->second->ctj_last_request = now;
+    if (!found->second->ctj_task->is_finished())
+    {
+        return Ogre::TexturePtr();
+    }
+
+    // The image is decoded (and downscaled) - upload it.
+    std::unique_ptr<CacheThumbnailJob> job = std::move(found->second);
+    m_thumbnail_jobs.erase(found);
+    if (job->ctj_image.getWidth() == 0 && job->ctj_cancelled)
+    {
+        return Ogre::TexturePtr(); // Skipped by the worker - not a failure, retry.
+    }
+    if (job->ctj_image.getWidth() == 0)
+    {
+        RoR::LogFormat("[RoR|ModCache] Could not prepare preview image '%s': %s", job->ctj_name.c_str(), job->ctj_error.c_str());
+        m_thumbnail_failures.insert(job->ctj_name);
+        return Ogre::TexturePtr();
+    }
+    this->TouchThumbnailFile(job->ctj_name, job->ctj_disk_size);
+
+    try
+    {
+        tex = Ogre::TextureManager::getSingleton().loadImage(job->ctj_name, RGN_CACHE, job->ctj_image);
+    }
+    catch (Ogre::Exception& e)
+    {
+        RoR::LogFormat("[RoR|ModCache] Could not load preview image '%s': %s", job->ctj_name.c_str(), e.getFullDescription().c_str());
+        m_thumbnail_failures.insert(job->ctj_name);
+        return Ogre::TexturePtr();
+    }
+
+    // Keep the number of textures in check; the least recently used are not on screen anymore.
+    m_thumbnail_textures.push_front(job->ctj_name);
+    while (m_thumbnail_textures.size() > CACHE_THUMBNAILS_MAX_TEXTURES)
+    {
+        Ogre::TextureManager::getSingleton().remove(m_thumbnail_textures.back(), RGN_CACHE);
+        m_thumbnail_textures.pop_back();
+    }
+    return tex;
+}
+
+void CacheSystem::PrepareThumbnail(CacheThumbnailJob& job)
+{
+    if (job.ctj_cancelled)
+    {
+        return;
+    }
+
+    // Open the cache directory directly, the resource group system isn't thread-safe.
+    Ogre::Archive* cache_dir = Ogre::FileSystemArchiveFactory().createInstance(App::sys_cache_dir->getStr(), /*readOnly:*/false);
+    Ogre::Archive* bundle = nullptr;
     try
     {
-        DataStreamPtr src_ds = ResourceGroupManager::getSingleton().openResource(src_path, group);
-        DataStreamPtr dst_ds = ResourceGroupManager::getSingleton().createResource(dst_path, RGN_CACHE, true);
-        std::vector<char> buf(src_ds->size());
-        size_t read = src_ds->read(buf.data(), src_ds->size());
-        if (read > 0)
+        Ogre::DataStreamPtr data;
+        if (cache_dir->exists(job.ctj_name))
         {
-            dst_ds->write(buf.data(), read); 
-            entry->filecachename = dst_path;
+            Ogre::DataStreamPtr src = cache_dir->open(job.ctj_name);
+            data = Ogre::DataStreamPtr(OGRE_NEW Ogre::MemoryDataStream(src));
+        }
+        else
+        {
+            if (job.ctj_src_name.empty())
+            {
+                OGRE_EXCEPT(Ogre::Exception::ERR_INVALIDPARAMS, "Unknown source image", "CacheSystem::PrepareThumbnail");
+            }
+            bundle = CreateScanArchive(job.ctj_bundle_path, job.ctj_bundle_type);
+            bundle->load();
+            Ogre::DataStreamPtr src = bundle->open(job.ctj_src_name);
+            data = Ogre::DataStreamPtr(OGRE_NEW Ogre::MemoryDataStream(src));
+
+            // Cache the file for the next time
+            Ogre::DataStreamPtr dst = cache_dir->create(job.ctj_name);
+            dst->write(static_cast<Ogre::MemoryDataStream*>(data.get())->getPtr(), data->size());
+        }
+        job.ctj_disk_size = data->size();
+
+        String mini_fbase, minitype;
+        StringUtil::splitBaseFilename(job.ctj_name, mini_fbase, minitype);
+        job.ctj_image.load(data, minitype);
+
+        const size_t width = job.ctj_image.getWidth();
+        const size_t height = job.ctj_image.getHeight();
+        if (job.ctj_downscale && std::max(width, height) > CACHE_THUMBNAIL_MAX_SIZE
+            && !Ogre::PixelUtil::isCompressed(job.ctj_image.getFormat()))
+        {
+            const float scale = static_cast<float>(CACHE_THUMBNAIL_MAX_SIZE) / static_cast<float>(std::max(width, height));
+            job.ctj_image.resize(
+                static_cast<Ogre::ushort>(std::max(1.f, width * scale)),
+                static_cast<Ogre::ushort>(std::max(1.f, height * scale)));
         }
     }
     catch (Ogre::Exception& e)
     {
-        LOG("error while generating file cache: " + e.getFullDescription());
+        job.ctj_error = e.getFullDescription();
+        job.ctj_image = Ogre::Image();
+    }
+
+    if (bundle)
+    {
+        DestroyScanArchive(bundle);
+    }
+    Ogre::FileSystemArchiveFactory().destroyInstance(cache_dir);
+}
+
+void CacheSystem::TouchThumbnailFile(std::string const& name, size_t size)
+{
+    if (!m_thumbnail_files_listed)
+    {
+        // Files from previous runs count as least recently used.
+        auto files = ResourceGroupManager::getSingleton().findResourceFileInfo(RGN_CACHE, "*.mini.*");
+        for (const auto& file : *files)
+        {
+            m_thumbnail_files.emplace_back(file.filename, file.uncompressedSize);
+            m_thumbnail_files_size += file.uncompressedSize;
+        }
+        m_thumbnail_files_listed = true;
     }
 
-    LOG("done generating file cache!");
+    auto itor = std::find_if(m_thumbnail_files.begin(), m_thumbnail_files.end(),
+        [&name](std::pair<std::string, size_t> const& file) { return file.first == name; });
+    if (itor != m_thumbnail_files.end())
+    {
+        m_thumbnail_files.splice(m_thumbnail_files.begin(), m_thumbnail_files, itor);
+    }
+    else
+    {
+        m_thumbnail_files.emplace_front(name, size);
+        m_thumbnail_files_size += size;
+    }
+
+    // Evicted files are simply extracted again when needed.
+    while (m_thumbnail_files_size > CACHE_THUMBNAILS_MAX_DISK_SIZE && m_thumbnail_files.size() > 1)
+    {
+        App::GetContentManager()->DeleteDiskFile(m_thumbnail_files.back().first, RGN_CACHE);
+        m_thumbnail_files_size -= m_thumbnail_files.back().second;
+        m_thumbnail_files.pop_back();
+    }
 }
 
 void CacheSystem::ParseZipArchives(String group)
@@ -1131,16 +1782,44 @@ void CacheSystem::ParseZipArchives(String group)
     for (const auto& skinzip : *skinzips)
         files->push_back(skinzip);
 
-    int i = 0, count = static_cast<int>(files->size());
+    std::vector<std::unique_ptr<CacheZipScan>> scans;
     for (const auto& file : *files)
     {
-        int progress = ((float)i++ / (float)count) * 100;
+        String path = PathCombine(file.archive->getName(), file.filename);
+        if (m_resource_paths.insert(path).second)
+        {
+            scans.emplace_back(new CacheZipScan());
+            scans.back()->czs_path = path;
+        }
+    }
+
+    // Scan and parse the archives on the thread pool, merge the results on this thread in the original order.
+    // Only a limited number of archives is submitted ahead, because the parsed truckfiles are held until merged.
+    const size_t max_ahead = static_cast<size_t>(std::max(App::app_num_workers->getInt(), 1)) * 2;
+    std::vector<std::shared_ptr<Task>> tasks(scans.size());
+    size_t num_submitted = 0;
+    int count = static_cast<int>(scans.size());
+    for (int i = 0; i < count; i++)
+    {
+        for (; num_submitted < scans.size() && num_submitted < static_cast<size_t>(i) + max_ahead; num_submitted++)
+        {
+            CacheZipScan* scan = scans[num_submitted].get();
+            const std::vector<Ogre::String>* known_extensions = &m_known_extensions;
+            tasks[num_submitted] = App::GetThreadPool()->RunTask([scan, known_extensions]()
+                {
+                    CacheSystem::ScanZip(*scan, *known_extensions);
+                });
+        }
+        tasks[i]->join();
+
+        int progress = ((float)i / (float)count) * 100;
         std::string text = fmt::format("{}{}\n{}\n{}/{}",
-            _L("Loading zips in group "), group, file.filename, i, count);
+            _L("Loading zips in group "), group, scans[i]->czs_path, i + 1, count);
         RoR::App::GetGuiManager()->LoadingWindow.SetProgress(progress, text);
 
-        String path = PathCombine(file.archive->getName(), file.filename);
-        this->ParseSingleZip(path);
+        this->MergeZipScan(*scans[i]);
+        scans[i].reset(); // Release the parsed truckfiles
+        tasks[i].reset();
     }
 
     RoR::App::GetGuiManager()->LoadingWindow.SetVisible(false);
@@ -1149,25 +1828,243 @@ void CacheSystem::ParseZipArchives(String group)
 
 void CacheSystem::ParseSingleZip(String path)
 {
-    if (std::find(m_resource_paths.begin(), m_resource_paths.end(), path) == m_resource_paths.end())
+    if (m_resource_paths.insert(path).second)
     {
-        RoR::LogFormat("[RoR|ModCache] Adding archive '%s'", path.c_str());
-        ResourceGroupManager::getSingleton().createResourceGroup(RGN_TEMP, false);
-        try
+        CacheZipScan scan;
+        scan.czs_path = path;
+        CacheSystem::ScanZip(scan, m_known_extensions);
+        this->MergeZipScan(scan);
+    }
+}
+
+void CacheSystem::ScanZip(CacheZipScan& scan, std::vector<Ogre::String> const& known_extensions)
+{
+    try
+    {
+        scan.czs_archive = CreateScanArchive(scan.czs_path, scan.czs_archive_type);
+        scan.czs_archive->load();
+    }
+    catch (Ogre::Exception& e)
+    {
+        scan.czs_error = e.getFullDescription();
+        if (scan.czs_archive)
         {
-            ResourceGroupManager::getSingleton().addResourceLocation(path, "Zip", RGN_TEMP);
-            if (ParseKnownFiles(RGN_TEMP))
+            DestroyScanArchive(scan.czs_archive);
+            scan.czs_archive = nullptr;
+        }
+        return;
+    }
+
+    for (auto ext : known_extensions)
+    {
+        auto files = scan.czs_archive->findFileInfo("*." + ext, /*recursive:*/false, /*dirs:*/false);
+        for (const auto& file : *files)
+        {
+            CacheZipScan::File scanned;
+            scanned.czf_info = file;
+            scanned.czf_ext = ext;
+            if (ext != "terrn2" && ext != "skin" && ext != "addonpart" && ext != "tuneup"
+                && ext != "assetpack" && ext != "dashboard" && ext != "gadget")
             {
-                LOG("No usable content in: '" + path + "'");
+                try
+                {
+                    scanned.czf_truck_def = CacheSystem::ParseTruckDetailInfo(scan.czs_archive->open(file.filename), scan.czs_path);
+                }
+                catch (std::exception&)
+                {
+                    // `AddFile()` will retry and report the error
+                }
             }
+            scan.czs_files.push_back(scanned);
         }
-        catch (Ogre::Exception& e)
+    }
+}
+
+void CacheSystem::MergeZipScan(CacheZipScan& scan)
+{
+    RoR::LogFormat("[RoR|ModCache] Adding archive '%s'", scan.czs_path.c_str());
+    if (!scan.czs_archive)
+    {
+        LOG("Error while opening archive: '" + scan.czs_path + "': " + scan.czs_error);
+        return;
+    }
+
+    if (scan.czs_files.empty())
+    {
+        LOG("No usable content in: '" + scan.czs_path + "'");
+    }
+    for (CacheZipScan::File& file : scan.czs_files)
+    {
+        this->AddFile(file.czf_info, file.czf_ext, file.czf_truck_def);
+    }
+    scan.czs_files.clear();
+
+    DestroyScanArchive(scan.czs_archive);
+    scan.czs_archive = nullptr;
+}
+
+void CacheSystem::StartWatchingContentDirs()
+{
+    if (!App::app_watch_mod_dirs->getBool() || m_watcher.IsRunning())
+    {
+        return;
+    }
+
+    std::vector<std::string> dirs;
+    dirs.push_back(PathCombine(App::sys_user_dir->getStr(), "mods"));
+    dirs.push_back(PathCombine(App::sys_user_dir->getStr(), "packs"));
+    m_watcher.Start(dirs); // Logs errors
+}
+
+void CacheSystem::UpdateWatchedContent()
+{
+    // Merge finished scans - all entries of a bundle appear at once.
+    for (auto itor = m_watch_scans.begin(); itor != m_watch_scans.end(); )
+    {
+        if (itor->second->is_finished())
+        {
+            m_update_time = getTimeStamp(); // Mark the entries as fresh
+            this->MergeZipScan(*itor->first);
+            itor = m_watch_scans.erase(itor);
+        }
+        else
         {
-            LOG("Error while opening archive: '" + path + "': " + e.getFullDescription());
+            ++itor;
         }
-        ResourceGroupManager::getSingleton().destroyResourceGroup(RGN_TEMP);
-        m_resource_paths.insert(path);
     }
+
+    // Find the bundles affected by the changes; a bundle is either a ZIP archive or a directory with the files directly in it.
+    std::vector<ContentDirWatcher::Change> changes;
+    m_watcher.Poll(changes);
+    for (ContentDirWatcher::Change& change: changes)
+    {
+        if (change.cdc_rescan)
+        {
+            // Changes were lost - recheck all known bundles; existing ones are reported as separate changes.
+            for (const CacheEntryPtr& entry: m_entries)
+            {
+                if (entry->resource_bundle_path.compare(0, change.cdc_path.length(), change.cdc_path) == 0)
+                {
+                    m_watch_pending.insert(entry->resource_bundle_path);
+                }
+            }
+            continue;
+        }
+
+        std::string basename, ext, dir;
+        Ogre::StringUtil::splitFullFilename(change.cdc_path, basename, ext, dir);
+        Ogre::StringUtil::toLowerCase(ext);
+        if (change.cdc_is_dir || ext == "zip" || ext == "skinzip")
+        {
+            m_watch_pending.insert(change.cdc_path);
+        }
+        else if (std::find(m_known_extensions.begin(), m_known_extensions.end(), ext) != m_known_extensions.end())
+        {
+            m_watch_pending.insert(GetBundleParentDir(change.cdc_path));
+        }
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (changes.empty() && now < m_watch_retry_time)
+    {
+        return;
+    }
+    m_watch_retry_time = now + std::chrono::seconds(1);
+
+    // Remove outdated entries and scan the bundles on the thread pool.
+    for (auto itor = m_watch_pending.begin(); itor != m_watch_pending.end(); )
+    {
+        const std::string bundle_path = *itor;
+        const bool is_scanning = std::find_if(m_watch_scans.begin(), m_watch_scans.end(),
+            [&bundle_path](std::pair<std::unique_ptr<CacheZipScan>, std::shared_ptr<Task>>& s) { return s.first->czs_path == bundle_path; }) != m_watch_scans.end();
+        size_t num_kept = 0;
+        if (is_scanning || !this->RemoveOutdatedBundleEntries(bundle_path, num_kept))
+        {
+            ++itor; // Retry later
+            continue;
+        }
+        itor = m_watch_pending.erase(itor);
+
+        std::unique_ptr<CacheZipScan> scan(new CacheZipScan());
+        scan->czs_path = bundle_path;
+        if (FolderExists(bundle_path))
+        {
+            scan->czs_archive_type = "FileSystem"; // Unchanged files are skipped by `AddFile()`
+        }
+        else if (!FileExists(bundle_path) || num_kept > 0)
+        {
+            continue; // Removed, or up to date (i.e. just installed by the repository UI)
+        }
+        else
+        {
+            m_resource_paths.insert(bundle_path);
+        }
+
+        RoR::LogFormat("[RoR|ModCache] Change detected in '%s', rescanning", bundle_path.c_str());
+        CacheZipScan* scan_ptr = scan.get();
+        const std::vector<Ogre::String>* known_extensions = &m_known_extensions;
+        std::shared_ptr<Task> task = m_background_pool->RunTask([scan_ptr, known_extensions]()
+            {
+                CacheSystem::ScanZip(*scan_ptr, *known_extensions);
+            });
+        m_watch_scans.emplace_back(std::move(scan), task);
+    }
+}
+
+bool CacheSystem::RemoveOutdatedBundleEntries(std::string const& bundle_path, size_t& out_num_kept)
+{
+    std::vector<CacheEntryPtr> outdated;
+    bool in_use = false;
+    for (const CacheEntryPtr& entry: this->GetEntries())
+    {
+        if (entry->resource_bundle_path != bundle_path)
+        {
+            continue;
+        }
+        in_use = in_use || entry->resource_group != "";
+
+        std::string fn = entry->resource_bundle_path;
+        if (entry->resource_bundle_type == "FileSystem")
+        {
+            fn = PathCombine(fn, entry->fname);
+        }
+        if (!RoR::FileExists(fn) || entry->filetime != RoR::GetFileLastModifiedTime(fn))
+        {
+            outdated.push_back(entry);
+        }
+        else
+        {
+            out_num_kept++;
+        }
+    }
+
+    if (outdated.empty())
+    {
+        return true;
+    }
+    if (in_use)
+    {
+        return false; // Spawned actors use the bundle - see `main.cpp`, `MSG_EDI_DELETE_BUNDLE_REQUESTED`
+    }
+
+    for (CacheEntryPtr& entry: outdated)
+    {
+        entry->deleted = true; // The object must remain in memory until all references expire.
+        TRIGGER_EVENT_ASYNC(SE_GENERIC_MODCACHE_ACTIVITY,
+            /*ints*/ MODCACHEACTIVITY_ENTRY_DELETED, entry->number);
+        RoR::LogFormat("[RoR|ModCache] Removing outdated %s '%s' from bundle '%s'", entry->fext.c_str(), entry->fname.c_str(), bundle_path.c_str());
+    }
+    RoR::EraseIf(m_entries, [](CacheEntryPtr& e) { return e->deleted; });
+    this->RebuildLookupIndexes();
+
+    // Make sure the next load doesn't use a stale archive listing.
+    // Directories are shared with RGN_CONTENT (see `ContentManager`) and list files live - unloading would leave it a dangling archive.
+    if (outdated.front()->resource_bundle_type == "Zip")
+    {
+        Ogre::ArchiveManager::getSingleton().unload(bundle_path);
+    }
+    m_resource_paths.erase(bundle_path);
+    return true;
 }
 
 bool CacheSystem::ParseKnownFiles(Ogre::String group)
@@ -1178,7 +2075,7 @@ bool CacheSystem::ParseKnownFiles(Ogre::String group)
         auto files = ResourceGroupManager::getSingleton().findResourceFileInfo(group, "*." + ext);
         for (const auto& file : *files)
         {
-            this->AddFile(group, file, ext);
+            this->AddFile(file, ext);
             empty = false;
         }
     }
@@ -1539,6 +2436,7 @@ bool CacheSystem::IsPathContentDirRoot(const std::string& path) const
 
 void CacheSystem::LoadResource(CacheEntryPtr& entry)
 {
+    this->MaterializeAllEntries();
     if (!entry)
         return;
 
@@ -1648,6 +2546,7 @@ void CacheSystem::ReLoadResource(CacheEntryPtr& entry)
 
 void CacheSystem::UnLoadResource(CacheEntryPtr& entry)
 {
+    this->MaterializeAllEntries();
     if (entry->resource_group == "")
     {
         return; // Not loaded - nothing to do
@@ -1674,6 +2573,7 @@ void CacheSystem::UnLoadResource(CacheEntryPtr& entry)
 
 CacheEntryPtr CacheSystem::FetchSkinByName(std::string const & skin_name)
 {
+    this->MaterializeAllEntries();
     for (CacheEntryPtr & entry: m_entries)
     {
         if (entry->dname == skin_name && entry->fext == "skin")
@@ -1686,6 +2586,7 @@ CacheEntryPtr CacheSystem::FetchSkinByName(std::string const & skin_name)
 
 void CacheSystem::LoadAssociatedSkinDef(CacheEntryPtr& cache_entry)
 {
+    this->MaterializeAllEntries();
     // A .skin file defines multiple skins, so we need to locate and update all associated cache entries.
     // --------------------------------------------------------------------------------------------------
 
@@ -1735,6 +2636,7 @@ void CacheSystem::LoadAssociatedSkinDef(CacheEntryPtr& cache_entry)
 
 void CacheSystem::LoadAssociatedTuneupDef(CacheEntryPtr& cache_entry)
 {
+    this->MaterializeAllEntries();
     // A .tuneup file defines multiple tuneups, so we need to locate and update all associated cache entries.
     // --------------------------------------------------------------------------------------------------
 
@@ -1864,9 +2766,36 @@ CacheEntryPtr CacheSystem::CreateProject(CreateProjectRequest* request)
             tuneup->filename = request->cpr_source_entry->fname; // For additional filtering of results (GUID marks a family, not individual mod).
         tuneup->name = request->cpr_name;
         tuneup->description = request->cpr_description;
-        tuneup->thumbnail = request->cpr_source_entry->filecachename;
         tuneup->category_id = (CacheCategoryId)project_entry->categoryid;
 
+        // Copy the preview image into the project - the source's `filecachename` may not be extracted (or may be trimmed from RGN_CACHE).
+        const std::string src_image = GetThumbnailSourceName(request->cpr_source_entry);
+        if (!src_image.empty())
+        {
+            try
+            {
+                String src_fbase, minitype;
+                StringUtil::splitBaseFilename(src_image, src_fbase, minitype);
+                const std::string dst_image = fmt::format("{}-mini.{}", request->cpr_name, minitype); // Picked up by `GenerateFileCache()`
+                DataStreamPtr src_ds = ResourceGroupManager::getSingleton().openResource(src_image, request->cpr_source_entry->resource_group);
+                DataStreamPtr dst_ds = ResourceGroupManager::getSingleton().createResource(dst_image, project_entry->resource_group, /*overwrite:*/true);
+                std::vector<char> buf(src_ds->size());
+                size_t read = src_ds->read(buf.data(), src_ds->size());
+                if (read > 0)
+                {
+                    dst_ds->write(buf.data(), read);
+                }
+                tuneup->thumbnail = dst_image;
+                this->RemoveFileCache(project_entry); // When overwriting, drop the previous preview.
+                project_entry->filecachename = fmt::format("{}_{}.mini.{}", request->cpr_name, project_entry->fname, minitype);
+            }
+            catch (Ogre::Exception& oex)
+            {
+                RoR::LogFormat("[RoR|ModCache] Could not copy preview image '%s' to tuneup '%s', message: %s",
+                    src_image.c_str(), request->cpr_name.c_str(), oex.getDescription().c_str());
+            }
+        }
+
         // Write out the .tuneup file.
         Ogre::DataStreamPtr datastream = Ogre::ResourceGroupManager::getSingleton().createResource(
             project_entry->fname, project_entry->resource_group, request->cpr_overwrite);
@@ -2000,6 +2929,7 @@ CacheEntryPtr CacheSystem::CreateProject(CreateProjectRequest* request)
     {
         // Add the new entry to database
         m_entries.push_back(project_entry);
+        this->AddToLookupIndexes(m_entries.size() - 1);
     }
 
     // Reload the underlying OGRE resource group to properly pick up all added files.
@@ -2257,6 +3187,7 @@ void CacheSystem::ModifyProject(ModifyProjectRequest* request)
 
 void CacheSystem::DeleteProject(CacheEntryPtr& entry)
 {
+    this->MaterializeAllEntries();
 
         this->UnLoadResource(entry);
 
@@ -2288,6 +3219,7 @@ void CacheSystem::DeleteProject(CacheEntryPtr& entry)
 
         // Remove the entry
         RoR::EraseIf(m_entries, [entry](CacheEntryPtr& e) { return e == entry; });
+        this->RebuildLookupIndexes();
 
         // Force update of Tuning menu in TopMenubarUI.
         App::GetGuiManager()->TopMenubar.tuning_actor = nullptr;
@@ -2295,22 +3227,33 @@ void CacheSystem::DeleteProject(CacheEntryPtr& entry)
 
 size_t CacheSystem::Query(CacheQuery& query)
 {
+    this->MaterializeAllEntries();
     Ogre::StringUtil::toLowerCase(query.cqy_search_string);
     Ogre::StringUtil::toLowerCase(query.cqy_filter_guid);
     Ogre::StringUtil::toLowerCase(query.cqy_filter_target_filename);
     std::time_t cur_time = std::time(nullptr);
-    for (CacheEntryPtr& entry: m_entries)
+
+    // Search - only entries which contain all trigrams of the search string can match
+    std::vector<bool> candidates;
+    const bool use_candidates = query.cqy_search_method != CacheSearchMethod::NONE
+        && query.cqy_search_method != CacheSearchMethod::WHEELS // Not indexed
+        && this->FindSearchCandidates(query.cqy_search_string, candidates);
+
+    // Filter by GUID - only visit the indexed slots
+    const std::vector<size_t>* guid_slots = nullptr;
+    const std::vector<size_t> no_slots;
+    if (query.cqy_filter_guid != "")
     {
-        // Filter by GUID
-        if (query.cqy_filter_guid != "")
-        {
-            // Addon parts have `guid` empty
-            if ((entry->fext == "addonpart" && entry->addonpart_guids.count(query.cqy_filter_guid) == 0) ||
-                (entry->fext != "addonpart" && entry->guid != query.cqy_filter_guid))
-            {
-                continue;
-            }
-        }
+        auto found = m_lookup_by_guid.find(query.cqy_filter_guid);
+        guid_slots = (found != m_lookup_by_guid.end()) ? &found->second : &no_slots;
+    }
+
+    const size_t num_slots = (guid_slots) ? guid_slots->size() : m_entries.size();
+    for (size_t n = 0; n < num_slots; n++)
+    {
+        const size_t slot = (guid_slots) ? (*guid_slots)[n] : n;
+        CacheEntryPtr& entry = m_entries[slot];
+        const CacheLookupKeys& keys = m_lookup_keys[slot];
 
         // Filter by target filename; pass items which have no target filenames listed.
         if (query.cqy_filter_target_filename != "")
@@ -2385,28 +3328,32 @@ size_t CacheSystem::Query(CacheQuery& query)
         size_t score = 0;
         bool match = false;
         Str<100> wheels_str;
-        switch (query.cqy_search_method)
+        switch ((use_candidates && !candidates[slot]) ? CacheSearchMethod::NONE : query.cqy_search_method)
         {
+        case CacheSearchMethod::NONE:
+            match = !use_candidates;
+            break;
+
         case CacheSearchMethod::FULLTEXT:
-            if (match = this->Match(score, entry->dname,       query.cqy_search_string, 0))   { break; }
-            if (match = this->Match(score, entry->fname,       query.cqy_search_string, 100)) { break; }
-            if (match = this->Match(score, entry->description, query.cqy_search_string, 200)) { break; }
-            for (AuthorInfo const& author: entry->authors)
+            if (match = this->Match(score, keys.clk_dname,       query.cqy_search_string, 0))   { break; }
+            if (match = this->Match(score, keys.clk_fname,       query.cqy_search_string, 100)) { break; }
+            if (match = this->Match(score, keys.clk_description, query.cqy_search_string, 200)) { break; }
+            for (auto& author: keys.clk_authors)
             {
-                if (match = this->Match(score, author.name,  query.cqy_search_string, 300)) { break; }
-                if (match = this->Match(score, author.email, query.cqy_search_string, 400)) { break; }
+                if (match = this->Match(score, author.first,  query.cqy_search_string, 300)) { break; }
+                if (match = this->Match(score, author.second, query.cqy_search_string, 400)) { break; }
             }
             break;
 
         case CacheSearchMethod::GUID:
-            match = this->Match(score, entry->guid, query.cqy_search_string, 0);
+            match = this->Match(score, keys.clk_guid, query.cqy_search_string, 0);
             break;
 
         case CacheSearchMethod::AUTHORS:
-            for (AuthorInfo const& author: entry->authors)
+            for (auto& author: keys.clk_authors)
             {
-                if (match = this->Match(score, author.name,  query.cqy_search_string, 0)) { break; }
-                if (match = this->Match(score, author.email, query.cqy_search_string, 0)) { break; }
+                if (match = this->Match(score, author.first,  query.cqy_search_string, 0)) { break; }
+                if (match = this->Match(score, author.second, query.cqy_search_string, 0)) { break; }
             }
             break;
 
@@ -2416,7 +3363,7 @@ size_t CacheSystem::Query(CacheQuery& query)
             break;
 
         case CacheSearchMethod::FILENAME:
-            match = this->Match(score, entry->fname, query.cqy_search_string, 100);
+            match = this->Match(score, keys.clk_fname, query.cqy_search_string, 100);
             break;
 
         default: // CacheSearchMethod::
@@ -2435,9 +3382,52 @@ size_t CacheSystem::Query(CacheQuery& query)
     return query.cqy_results.size();
 }
 
-bool CacheSystem::Match(size_t& out_score, std::string data, std::string const& query, size_t score)
+bool CacheSystem::FindSearchCandidates(std::string const& search_string, std::vector<bool>& out_candidates)
+{
+    if (search_string.length() < 3)
+    {
+        return false; // Any entry may match
+    }
+
+    std::vector<const std::vector<uint32_t>*> slot_lists;
+    for (size_t i = 0; i + 3 <= search_string.length(); i++)
+    {
+        auto found = m_search_trigrams.find(MakeTrigram(search_string, i));
+        if (found == m_search_trigrams.end())
+        {
+            out_candidates.assign(m_entries.size(), false); // No entry can match
+            return true;
+        }
+        slot_lists.push_back(&found->second);
+    }
+
+    // Repeated trigrams must be counted once.
+    std::sort(slot_lists.begin(), slot_lists.end());
+    slot_lists.erase(std::unique(slot_lists.begin(), slot_lists.end()), slot_lists.end());
+
+    // Count in how many lists each slot is present; every list holds a slot at most once.
+    std::vector<uint32_t> counts(m_entries.size(), 0);
+    for (uint32_t list_index = 0; list_index < slot_lists.size(); list_index++)
+    {
+        for (uint32_t slot: *slot_lists[list_index])
+        {
+            if (counts[slot] == list_index)
+            {
+                counts[slot]++;
+            }
+        }
+    }
+
+    out_candidates.resize(m_entries.size());
+    for (size_t i = 0; i < m_entries.size(); i++)
+    {
+        out_candidates[i] = (counts[i] == slot_lists.size());
+    }
+    return true;
+}
+
+bool CacheSystem::Match(size_t& out_score, std::string const& data, std::string const& query, size_t score)
 {
-    Ogre::StringUtil::toLowerCase(data);
     size_t pos = data.find(query);
     if (pos != std::string::npos)
     {
@@ -2454,11 +3444,11 @@ bool CacheQueryResult::operator<(CacheQueryResult const& other) const
 {
     if (cqr_score == other.cqr_score)
     {
-        Ogre::String first = this->cqr_entry->dname;
-        Ogre::String second = other.cqr_entry->dname;
-        Ogre::StringUtil::toLowerCase(first);
-        Ogre::StringUtil::toLowerCase(second);
-        return first < second;
+        // Case-insensitive, without allocating - this runs for every comparison when sorting results.
+        std::string const& first = this->cqr_entry->dname;
+        std::string const& second = other.cqr_entry->dname;
+        return std::lexicographical_compare(first.begin(), first.end(), second.begin(), second.end(),
+            [](char a, char b) { return std::tolower(static_cast<unsigned char>(a)) < std::tolower(static_cast<unsigned char>(b)); });
     }
 
     return cqr_score < other.cqr_score;
@@ -2489,6 +3479,7 @@ void CacheSystem::DeleteResourceBundleByFilename(const std::string& bundle_filen
 
     // Erase the 'deleted' entries from memory
     RoR::EraseIf(m_entries, [](CacheEntryPtr& e) { return e->deleted; });
+    this->RebuildLookupIndexes();
 
     // Actually delete the bundle from disk
     try
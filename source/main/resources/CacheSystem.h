@@ -27,6 +27,8 @@
 #pragma once
 
 #include "Application.h"
+#include "CacheIndex.h"
+#include "ContentDirWatcher.h"
 #include "Language.h"
 #include "RefCountingObject.h"
 #include "RefCountingObjectPtr.h"
@@ -35,12 +37,26 @@
 
 #include <Ogre.h>
 #include <rapidjson/document.h>
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <map>
+#include <memory>
 #include <string>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 #define CACHE_FILE "mods.cache"
+#define CACHE_INDEX_FILE "mods.cache.index"
+#define CACHE_DIRS_FILE "mods.cache.dirs"
 #define CACHE_FILE_FORMAT 14
 #define CACHE_FILE_FRESHNESS 86400 // 60*60*24 = one day
+#define CACHE_THUMBNAIL_MAX_SIZE 512 // Pixels; larger preview images are downscaled before uploading to GPU
+#define CACHE_THUMBNAILS_MAX_TEXTURES 64
+#define CACHE_THUMBNAILS_MAX_DISK_SIZE (256 * 1024 * 1024) // Bytes
+#define CACHE_THUMBNAILS_MAX_JOBS 4 // In flight; the rest is requested again on following frames
+#define CACHE_THUMBNAILS_STALE_TIME_MS 500 // Jobs not requested for this long (i.e. scrolled out of view) are dropped
 
 namespace RoR {
 
@@ -84,7 +100,7 @@ public:
     bool deleted;                       //!< is this mod deleted?
     int usagecounter;                   //!< how much it was used already
     std::vector<AuthorInfo> authors;    //!< authors
-    Ogre::String filecachename;         //!< preview image filename
+    Ogre::String filecachename;         //!< preview image filename in RGN_CACHE; extracted on demand, see `CacheSystem::FetchThumbnail()`
 
     Ogre::String resource_group;        //!< Resource group of the loaded bundle. Empty if not loaded yet.
 
@@ -268,14 +284,63 @@ struct ModifyProjectRequest
     int mpr_value_int;       // forced wheel side
 };
 
+/// Result of scanning a single ZIP archive (or directory) on a worker thread, see `CacheSystem::ParseZipArchives()`.
+/// Deliberately holds no `RefCountingObject`s (i.e. `CacheEntry`) - those may only be touched by the main thread.
+struct CacheZipScan
+{
+    struct File
+    {
+        Ogre::FileInfo        czf_info;
+        std::string           czf_ext;
+        RigDef::DocumentPtr   czf_truck_def;          //!< Pre-parsed truckfile; empty for other file types or if parsing failed.
+    };
+
+    std::string               czs_path;
+    std::string               czs_archive_type = "Zip"; //!< "Zip" or "FileSystem"
+    Ogre::Archive*            czs_archive = nullptr;  //!< Opened directly, without a resource group. Destroyed after merging.
+    std::string               czs_error;              //!< Set if the archive couldn't be opened.
+    std::vector<File>         czs_files;
+};
+
+/// A preview image being prepared on the background worker, see `CacheSystem::FetchThumbnail()`.
+/// Deliberately holds no `RefCountingObject`s (i.e. `CacheEntry`) - those may only be touched by the main thread.
+struct CacheThumbnailJob
+{
+    std::string               ctj_name;               //!< `CacheEntry::filecachename`
+    std::string               ctj_bundle_path;
+    std::string               ctj_bundle_type;
+    std::string               ctj_src_name;           //!< Image file in the bundle
+    bool                      ctj_downscale = true;   //!< Dashboards are previewed in actual size.
+    Ogre::Image               ctj_image;              //!< Result; empty if failed.
+    size_t                    ctj_disk_size = 0;      //!< Of the file in RGN_CACHE.
+    std::string               ctj_error;
+    std::shared_ptr<Task>     ctj_task;
+    std::chrono::steady_clock::time_point ctj_last_request;
+    std::atomic<bool>         ctj_cancelled{false};   //!< No longer wanted; skipped if not started yet.
+};
+
+/// Detects changes in a content directory without checking each file in it, see `CacheSystem::GenerateDirFingerprints()`.
+struct CacheDirFingerprint
+{
+    std::time_t               cdf_mtime = 0;          //!< Of the directory itself - changes when files are added, removed or renamed.
+    std::string               cdf_listing_hash;       //!< Names and sizes of the files in the directory.
+
+    bool operator==(CacheDirFingerprint const& other) const { return cdf_mtime == other.cdf_mtime && cdf_listing_hash == other.cdf_listing_hash; }
+    bool operator!=(CacheDirFingerprint const& other) const { return !(*this == other); }
+};
+
 /// A content database
 /// MOTIVATION:
 ///    RoR users usually have A LOT of content installed. Traversing it all on every game startup would be a pain.
 /// HOW IT WORKS:
 ///    For each recognized resource type (vehicle, terrain, skin...) an instance of 'CacheEntry' is created.
 ///       These entries are persisted in file CACHE_FILE (see above)
+///       and in binary CACHE_INDEX_FILE which is memory-mapped on startup; entries are only created from it when accessed.
 ///    Associated media live in a "resource bundle" (ZIP archive or subdirectory) in content directory (ROR_HOME/mods) and subdirectories.
 ///       If multiple CacheEntries share a bundle, the bundle is loaded only once. Each bundle has dedicated OGRE resource group.
+/// DETECTING CHANGES:
+///    A hash of all filenames detects added/removed content. Modified bundles are detected by timestamp,
+///       except ZIPs in directories whose fingerprint (see CACHE_DIRS_FILE) didn't change - these aren't checked one by one.
 /// UPDATING THE CACHE:
 ///    Historically it was a synchronous process which could only happen at main menu, in bulk.
 ///    In October 2023 it became an ad-hoc process but all synchronous logic was kept, to be slowly phased out later.
@@ -287,6 +352,7 @@ public:
     typedef std::map<int, Ogre::String> CategoryIdNameMap;
 
     CacheSystem();
+    ~CacheSystem();
 
     /// @name Startup
     /// @{
@@ -319,7 +385,7 @@ public:
     void                  DeleteProject(CacheEntryPtr& entry);
     /// @}
 
-    const std::vector<CacheEntryPtr>   &GetEntries()        const { return m_entries; }
+    const std::vector<CacheEntryPtr>   &GetEntries()              { this->MaterializeAllEntries(); return m_entries; }
     const CategoryIdNameMap         &GetCategories()     const { return m_categories; }
 
     Ogre::String GetPrettyName(Ogre::String fname);
@@ -330,6 +396,18 @@ public:
     void DeleteResourceBundleByFilename(const std::string& bundle_filename); //!< Deletes all CacheEntries which share the given resource bundle (ZIP or directory).
     void ParseSingleZip(Ogre::String path);
 
+    /// @name Thumbnails
+    /// @{
+    Ogre::TexturePtr      FetchThumbnail(const CacheEntryPtr& entry); //!< Returns null until ready - the image is extracted, cached and decoded on the background worker. Must be called every frame while the image is wanted.
+    /// @}
+
+    /// @name Watching content directories
+    /// @{
+    void                  StartWatchingContentDirs(); //!< Picks up mods added/modified/removed while the game runs; see `UpdateWatchedContent()`.
+    void                  UpdateWatchedContent(); //!< Call every frame; never blocks - changed bundles are scanned on the thread pool.
+    size_t                GetEntriesRevision() const { return m_entries_revision; } //!< Changes whenever entries are added or removed.
+    /// @}
+
 private:
 
     CacheValidity EvaluateCacheValidity(); // Called by `ContentManager` on startup only.
@@ -338,6 +416,21 @@ private:
     void ExportEntryToJson(rapidjson::Value& j_entries, rapidjson::Document& j_doc, CacheEntryPtr const & entry);
     CacheValidity LoadCacheFileJson();
     void ImportEntryFromJson(rapidjson::Value& j_entry, CacheEntryPtr & out_entry);
+    CacheValidity LoadCacheFile(); //!< Maps the binary index, falls back to JSON.
+    CacheValidity LoadCacheIndex();
+    void WriteCacheIndex(std::string const& global_hash);
+    CacheEntryPtr MaterializeEntry(size_t index); //!< Creates the entry from the index if not done yet.
+    void MaterializeAllEntries(); //!< Must be called before iterating `m_entries` - until then, slots may be empty.
+    void ResolveCategory(CacheEntryPtr& entry);
+
+    /// @name Lookup indexes
+    /// @{
+    void AddToLookupIndexes(size_t slot); //!< Call after appending an entry to `m_entries`.
+    void RebuildLookupIndexes(); //!< Call after `m_entries` was cleared, resized or erased from.
+    void AddLookupKeys(size_t slot);
+    void AddMaterializedLookupKeys(size_t slot); //!< GUIDs and full-text keys; needs the materialized entry, the index doesn't store these.
+    bool FindSearchCandidates(std::string const& search_string, std::vector<bool>& out_candidates); //!< Returns false if the string is too short to narrow the search down.
+    /// @}
 
     static Ogre::String StripUIDfromString(Ogre::String uidstr); 
     static Ogre::String StripSHA1fromString(Ogre::String sha1str);
@@ -345,13 +438,18 @@ private:
 
     void ParseZipArchives(Ogre::String group);
     bool ParseKnownFiles(Ogre::String group); // returns true if no known files are found
+    static void ScanZip(CacheZipScan& scan, std::vector<Ogre::String> const& known_extensions); //!< Thread-safe: uses no resource groups and creates no `CacheEntry` objects.
+    void MergeZipScan(CacheZipScan& scan); //!< Adds the scanned files to the cache and closes the archive; main thread only.
+    static void PrepareThumbnail(CacheThumbnailJob& job); //!< Thread-safe: uses no resource groups.
+    void TouchThumbnailFile(std::string const& name, size_t size); //!< Marks the file as recently used and trims the thumbnail cache to size.
+    bool RemoveOutdatedBundleEntries(std::string const& bundle_path, size_t& out_num_kept); //!< Removes entries whose file changed or vanished; false if the bundle is in use (retry later).
     
 
     void ClearCache(); // removes                   all files from the cache
     void PruneCache(); // removes modified (or deleted) files from the cache
     void ClearResourceGroups();
 
-    void AddFile(Ogre::String group, Ogre::FileInfo f, Ogre::String ext);
+    void AddFile(Ogre::FileInfo f, Ogre::String ext, RigDef::DocumentPtr truck_def = nullptr); //!< Opens the file from `f.archive`; `truck_def` may be pre-parsed by `ScanZip()`.
 
     void DetectDuplicates();
 
@@ -364,7 +462,8 @@ private:
     /// @name Cache update helpers
     /// @{
     void FillTerrainDetailInfo(CacheEntryPtr &entry, Ogre::DataStreamPtr ds, Ogre::String fname);
-    void FillTruckDetailInfo(CacheEntryPtr &entry, Ogre::DataStreamPtr ds, Ogre::String fname, Ogre::String group);
+    static RigDef::DocumentPtr ParseTruckDetailInfo(Ogre::DataStreamPtr ds, Ogre::String bundle_path); //!< Thread-safe.
+    void FillTruckDetailInfo(CacheEntryPtr &entry, RigDef::DocumentPtr def, Ogre::String fname);
     void FillSkinDetailInfo(CacheEntryPtr &entry, std::shared_ptr<SkinDocument>& skin_def);
     void FillAddonPartDetailInfo(CacheEntryPtr &entry, Ogre::DataStreamPtr ds);
     void FillTuneupDetailInfo(CacheEntryPtr &entry, TuneupDefPtr& tuneup_def);
@@ -374,11 +473,15 @@ private:
     /// @}
 
     void GenerateHashFromFilenames();         //!< For quick detection of added/removed content
+    void GenerateDirFingerprints();           //!< For quick detection of modified content; needs RGN_CONTENT.
+    void LoadDirFingerprints();
+    void WriteDirFingerprints();
+    bool IsDirUnchanged(std::string const& dir) const; //!< Compares the fingerprints; false if unknown.
 
-    void GenerateFileCache(CacheEntryPtr &entry, Ogre::String group);
+    void GenerateFileCache(CacheEntryPtr &entry, Ogre::Archive* archive);
     void RemoveFileCache(CacheEntryPtr &entry);
 
-    bool Match(size_t& out_score, std::string data, std::string const& query, size_t );
+    bool Match(size_t& out_score, std::string const& data, std::string const& query, size_t score); //!< `data` must be lowercase.
 
     bool IsPathContentDirRoot(const std::string& path) const;
 
@@ -386,10 +489,44 @@ private:
     std::time_t                          m_update_time;      //!< Ensures that all inserted files share the same timestamp
     std::string                          m_filenames_hash_loaded;   //!< hash from cachefile, for quick update detection
     std::string                          m_filenames_hash_generated;   //!< stores hash over the content, for quick update detection
+    std::map<std::string, CacheDirFingerprint> m_dir_fingerprints_loaded;    //!< Content directories as of the last cache update.
+    std::map<std::string, CacheDirFingerprint> m_dir_fingerprints_generated; //!< Content directories as of now.
+    ContentDirWatcher                    m_watcher;
+    std::set<std::string>                m_watch_pending;    //!< Changed bundles (ZIP or directory paths) waiting to be processed.
+    std::unique_ptr<ThreadPool>          m_background_pool;  //!< Single low-priority worker; keeps the general pool free for the simulation.
+    std::vector<std::pair<std::unique_ptr<CacheZipScan>, std::shared_ptr<Task>>> m_watch_scans; //!< Running on `m_background_pool`.
+    std::chrono::steady_clock::time_point m_watch_retry_time; //!< Bundles in use are re-checked periodically, not every frame.
+    std::map<std::string, std::unique_ptr<CacheThumbnailJob>> m_thumbnail_jobs; //!< Running on `m_background_pool`.
+    std::set<std::string>                m_thumbnail_failures;  //!< Not retried.
+    std::list<std::string>               m_thumbnail_textures;  //!< Loaded in GPU, most recently used first.
+    std::list<std::pair<std::string, size_t>> m_thumbnail_files; //!< Files in RGN_CACHE with sizes, most recently used first.
+    size_t                               m_thumbnail_files_size = 0;
+    bool                                 m_thumbnail_files_listed = false;
     std::vector<CacheEntryPtr>           m_entries;
     std::vector<Ogre::String>            m_known_extensions; //!< the extensions we track in the cache system
     std::vector<std::string>             m_content_dirs;     //!< the various mod directories we track in the cache system
     std::set<Ogre::String>               m_resource_paths;   //!< A temporary list of existing resource paths
+    CacheIndex                           m_index;            //!< Mapped while some `m_entries` are not materialized yet.
+    size_t                               m_num_lazy_entries = 0; //!< Empty slots in `m_entries`, to be filled from `m_index`.
+
+    struct CacheLookupKeys //!< Lowercase, so that lookups don't need to touch (or materialize) the entries.
+    {
+        std::string clk_fext;
+        std::string clk_fname;
+        std::string clk_fname_without_uid;
+        std::string clk_bundle_name;  //!< Filename of the ZIP/directory.
+        // Full-text search; empty until the entry is materialized.
+        std::string clk_dname;
+        std::string clk_description;
+        std::string clk_guid;
+        std::vector<std::pair<std::string, std::string>> clk_authors; //!< Name, email
+    };
+    std::vector<CacheLookupKeys>         m_lookup_keys;       //!< Parallel to `m_entries`.
+    std::unordered_map<std::string, std::vector<size_t>> m_lookup_by_fname; //!< Filename (with and without UID) -> slots, ascending.
+    std::unordered_map<std::string, std::vector<size_t>> m_lookup_by_guid;  //!< GUID (also addonpart target GUIDs) -> slots, ascending; materialized entries only.
+    std::vector<size_t>                  m_lookup_by_length;  //!< All slots, ordered by filename length - for partial lookups.
+    std::unordered_map<uint32_t, std::vector<uint32_t>> m_search_trigrams;  //!< 3 consecutive chars of any full-text field -> slots; materialized entries only.
+    size_t                               m_entries_revision = 0; //!< Bumped whenever the lookup indexes are updated.
     std::map<int, Ogre::String>          m_categories = {
             // these are the category numbers from the repository. do not modify them!
 
@@ -0,0 +1,213 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ContentDirWatcher.h"
+
+#include "Application.h"
+#include "PlatformUtils.h"
+
+#ifdef __linux__
+#   include <dirent.h>
+#   include <sys/inotify.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+using namespace RoR;
+
+ContentDirWatcher::~ContentDirWatcher()
+{
+    this->Stop();
+}
+
+#ifdef __linux__
+
+// Files are reported once fully written or moved in, not while being copied.
+static const uint32_t WATCH_EVENTS = IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF;
+
+bool ContentDirWatcher::Start(std::vector<std::string> const& dirs)
+{
+    this->Stop();
+    m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_fd == -1)
+    {
+        RoR::LogFormat("[RoR|ContentDirWatcher] Could not initialize inotify, error %d", errno);
+        return false;
+    }
+
+    m_roots = dirs;
+    for (std::string const& dir: dirs)
+    {
+        this->AddWatch(dir, nullptr);
+    }
+
+    if (m_watches.empty())
+    {
+        this->Stop();
+        return false;
+    }
+    RoR::LogFormat("[RoR|ContentDirWatcher] Watching %d directories", static_cast<int>(m_watches.size()));
+    return true;
+}
+
+void ContentDirWatcher::Stop()
+{
+    if (m_fd != -1)
+    {
+        close(m_fd); // Also removes all watches
+        m_fd = -1;
+    }
+    m_watches.clear();
+    m_roots.clear();
+}
+
+void ContentDirWatcher::AddWatch(std::string const& dir, std::vector<Change>* out_new_items)
+{
+    const int wd = inotify_add_watch(m_fd, dir.c_str(), WATCH_EVENTS | IN_ONLYDIR);
+    if (wd == -1)
+    {
+        return; // Doesn't exist or no permission - nothing to watch.
+    }
+    m_watches[wd] = dir;
+
+    DIR* dir_handle = opendir(dir.c_str());
+    if (!dir_handle)
+    {
+        return;
+    }
+    while (dirent* item = readdir(dir_handle))
+    {
+        const std::string name = item->d_name;
+        if (name == "." || name == "..")
+        {
+            continue;
+        }
+
+        // Some filesystems (i.e. NFS, XFS or overlays) don't fill in the type.
+        // Note `FolderExists()` can't be used, it doesn't tell files from directories.
+        const std::string path = PathCombine(dir, name);
+        struct stat st;
+        const bool is_dir = (item->d_type == DT_DIR)
+            || (item->d_type == DT_UNKNOWN && stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode));
+        if (out_new_items)
+        {
+            Change change;
+            change.cdc_path = path;
+            change.cdc_is_dir = is_dir;
+            out_new_items->push_back(change);
+        }
+        if (is_dir)
+        {
+            this->AddWatch(path, out_new_items);
+        }
+    }
+    closedir(dir_handle);
+}
+
+void ContentDirWatcher::Poll(std::vector<Change>& out_changes)
+{
+    if (m_fd == -1)
+    {
+        return;
+    }
+
+    alignas(inotify_event) char buf[4096];
+    bool overflow = false;
+    for (;;)
+    {
+        const ssize_t len = read(m_fd, buf, sizeof(buf));
+        if (len <= 0)
+        {
+            break; // EAGAIN - no more events
+        }
+
+        for (ssize_t pos = 0; pos < len; pos += sizeof(inotify_event) + reinterpret_cast<inotify_event*>(buf + pos)->len)
+        {
+            const inotify_event* event = reinterpret_cast<inotify_event*>(buf + pos);
+            auto itor = m_watches.find(event->wd);
+            if (event->mask & IN_Q_OVERFLOW)
+            {
+                overflow = true;
+                continue;
+            }
+            if (itor == m_watches.end())
+            {
+                continue;
+            }
+            if (event->mask & (IN_DELETE_SELF | IN_IGNORED))
+            {
+                m_watches.erase(itor); // Removing the directory itself is reported by the parent.
+                continue;
+            }
+            if (event->len == 0 || ((event->mask & IN_CREATE) && !(event->mask & IN_ISDIR)))
+            {
+                continue; // New files are reported when closed (IN_CLOSE_WRITE)
+            }
+
+            Change change;
+            change.cdc_path = PathCombine(itor->second, event->name);
+            change.cdc_is_dir = (event->mask & IN_ISDIR) != 0;
+            change.cdc_removed = (event->mask & (IN_DELETE | IN_MOVED_FROM)) != 0;
+            out_changes.push_back(change);
+
+            if (change.cdc_is_dir && !change.cdc_removed)
+            {
+                this->AddWatch(change.cdc_path, &out_changes); // Directories moved in may already have contents.
+            }
+        }
+    }
+
+    if (overflow)
+    {
+        // Report everything - the receiver must also check what it knows for removals.
+        // Re-adding the watches picks up directories whose creation was lost.
+        RoR::Log("[RoR|ContentDirWatcher] Event queue overflow, requesting full rescan");
+        for (std::string const& root: m_roots)
+        {
+            Change change;
+            change.cdc_path = root;
+            change.cdc_is_dir = true;
+            change.cdc_rescan = true;
+            out_changes.push_back(change);
+            this->AddWatch(root, &out_changes);
+        }
+    }
+}
+
+#else // __linux__
+
+bool ContentDirWatcher::Start(std::vector<std::string> const& dirs)
+{
+    RoR::Log("[RoR|ContentDirWatcher] Watching directories is not supported on this platform");
+    return false;
+}
+
+void ContentDirWatcher::Stop()
+{
+}
+
+void ContentDirWatcher::AddWatch(std::string const& dir, std::vector<Change>* out_new_items)
+{
+}
+
+void ContentDirWatcher::Poll(std::vector<Change>& out_changes)
+{
+}
+
+#endif // __linux__
@@ -0,0 +1,65 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+/// @brief  Reports changes in mod directories, so that the mod cache can pick them up while the game runs.
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace RoR {
+
+/// Watches directories, including subdirectories, for added/modified/removed files.
+/// Linux only (inotify); elsewhere `Start()` fails and the mod cache has to be updated manually as before.
+/// `Poll()` never blocks - it only picks up events already queued by the OS.
+class ContentDirWatcher
+{
+public:
+
+    struct Change
+    {
+        std::string   cdc_path;                 //!< Full path of the file or directory.
+        bool          cdc_is_dir = false;
+        bool          cdc_removed = false;      //!< Deleted or moved away; otherwise created, modified or moved in.
+        bool          cdc_rescan = false;       //!< Events were lost (queue overflow) - anything under this watched root may have changed.
+    };
+
+    ContentDirWatcher() {}
+    ~ContentDirWatcher();
+    ContentDirWatcher(const ContentDirWatcher&) = delete;
+    ContentDirWatcher& operator=(const ContentDirWatcher&) = delete;
+
+    bool Start(std::vector<std::string> const& dirs); //!< Returns false if none of the directories can be watched.
+    void Stop();
+    bool IsRunning() const { return m_fd != -1; }
+    void Poll(std::vector<Change>& out_changes);
+
+private:
+
+    void AddWatch(std::string const& dir, std::vector<Change>* out_new_items); //!< Recursive; reports the contents (files and subdirectories) if requested.
+
+    int                           m_fd = -1;
+    std::map<int, std::string>    m_watches;    //!< Watch descriptor -> directory path
+    std::vector<std::string>      m_roots;      //!< As passed to `Start()`
+};
+
+} // namespace RoR
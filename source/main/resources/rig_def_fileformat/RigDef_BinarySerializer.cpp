@@ -0,0 +1,895 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+/// @brief  Binary (de)serialization of `RigDef::Document`.
+///
+/// Each data structure has a single `Io()` function which both writes and reads it,
+/// depending on the archive type, so the two directions can't get out of sync.
+/// Shared defaults (`NodeDefaults`, `BeamDefaults`, `Inertia`...) are stored once and
+/// referenced by index, so the loaded document has the same sharing as the parsed one.
+
+#include "RigDef_BinarySerializer.h"
+
+#include "MappedFile.h"
+#include "RigDef_Serializer.h"
+#include "RoRVersion.h"
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <type_traits>
+
+using namespace RigDef;
+
+namespace {
+
+const char     TRUCKC_SIGNATURE[] = "RoR.truckc";
+const uint32_t TRUCKC_BYTE_ORDER_MARK = 0x01020304u;
+
+uint64_t HashBytes(const char* data, size_t len)
+{
+    uint64_t hash = 14695981039346656037ull; // FNV-1a
+    for (size_t i = 0; i < len; i++)
+    {
+        hash = (hash ^ static_cast<uint8_t>(data[i])) * 1099511628211ull;
+    }
+    return hash;
+}
+
+// --------------------------------
+// Archives
+
+class BinaryWriter
+{
+public:
+    static const bool IS_READER = false;
+
+    template <typename T> void Raw(T& value)
+    {
+        m_buf.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void Bytes(std::string& str, uint32_t len)
+    {
+        m_buf.append(str.data(), len);
+    }
+
+    template <typename T> void Shared(std::shared_ptr<T>& ptr);
+
+    void CheckCount(uint32_t) {}
+
+    std::string& GetOutput() { return m_buf; }
+
+private:
+    std::string                      m_buf;
+    std::map<const void*, uint32_t>  m_shared_indices; //!< 1-based, 0 means null
+};
+
+class BinaryReader
+{
+public:
+    static const bool IS_READER = true;
+
+    BinaryReader(const char* data, size_t size): m_pos(data), m_end(data + size) {}
+
+    template <typename T> void Raw(T& value)
+    {
+        this->Check(sizeof(T));
+        std::memcpy(&value, m_pos, sizeof(T));
+        m_pos += sizeof(T);
+    }
+
+    void Bytes(std::string& str, uint32_t len)
+    {
+        this->Check(len);
+        str.assign(m_pos, len);
+        m_pos += len;
+    }
+
+    template <typename T> void Shared(std::shared_ptr<T>& ptr);
+
+    void CheckCount(uint32_t count) { this->Check(count); } //!< Every element takes at least 1 byte - rejects garbage counts before allocating.
+    bool IsAtEnd() const { return m_pos == m_end; }
+
+private:
+    void Check(size_t len)
+    {
+        if (len > static_cast<size_t>(m_end - m_pos))
+            throw std::runtime_error("unexpected end of data");
+    }
+
+    const char*                         m_pos;
+    const char*                         m_end;
+    std::vector<std::shared_ptr<void>>  m_shared_objects;
+};
+
+// --------------------------------
+// Generic types
+
+template <class A, typename T>
+typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value>::type
+Io(A& ar, T& value)
+{
+    ar.Raw(value);
+}
+
+template <class A> void Io(A& ar, std::string& str)
+{
+    uint32_t len = static_cast<uint32_t>(str.size());
+    ar.Raw(len);
+    ar.Bytes(str, len);
+}
+
+template <class A> void Io(A& ar, Ogre::Vector3& v)
+{
+    Io(ar, v.x); Io(ar, v.y); Io(ar, v.z);
+}
+
+template <class A> void Io(A& ar, Ogre::ColourValue& c)
+{
+    Io(ar, c.r); Io(ar, c.g); Io(ar, c.b); Io(ar, c.a);
+}
+
+template <class A> uint32_t IoCount(A& ar, size_t size)
+{
+    uint32_t count = static_cast<uint32_t>(size);
+    ar.Raw(count);
+    ar.CheckCount(count);
+    return count;
+}
+
+template <class A, typename T> void Io(A& ar, std::vector<T>& vec)
+{
+    vec.resize(IoCount(ar, vec.size()));
+    for (T& elem: vec)
+        Io(ar, elem);
+}
+
+template <class A, typename T> void Io(A& ar, std::list<T>& list)
+{
+    list.resize(IoCount(ar, list.size()));
+    for (T& elem: list)
+        Io(ar, elem);
+}
+
+template <class A, typename T, size_t N> void Io(A& ar, T (&arr)[N])
+{
+    for (size_t i = 0; i < N; i++)
+        Io(ar, arr[i]);
+}
+
+template <class A, typename T> void Io(A& ar, std::shared_ptr<T>& ptr)
+{
+    ar.Shared(ptr);
+}
+
+template <typename T> void BinaryWriter::Shared(std::shared_ptr<T>& ptr)
+{
+    uint32_t index = 0;
+    if (!ptr)
+    {
+        this->Raw(index);
+        return;
+    }
+    auto found = m_shared_indices.find(ptr.get());
+    if (found != m_shared_indices.end())
+    {
+        index = found->second;
+        this->Raw(index);
+        return;
+    }
+    // First occurrence: the index is followed by the data.
+    index = static_cast<uint32_t>(m_shared_indices.size()) + 1;
+    m_shared_indices[ptr.get()] = index;
+    this->Raw(index);
+    Io(*this, *ptr);
+}
+
+template <typename T> void BinaryReader::Shared(std::shared_ptr<T>& ptr)
+{
+    uint32_t index = 0;
+    this->Raw(index);
+    if (index == 0)
+    {
+        ptr = nullptr;
+    }
+    else if (index <= m_shared_objects.size())
+    {
+        // Types are not stored; a corrupted index would be caught by the checksum beforehand.
+        ptr = std::static_pointer_cast<T>(m_shared_objects[index - 1]);
+    }
+    else if (index == m_shared_objects.size() + 1)
+    {
+        ptr = std::make_shared<T>();
+        m_shared_objects.push_back(ptr);
+        Io(*this, *ptr);
+    }
+    else
+    {
+        throw std::runtime_error("invalid shared object index");
+    }
+}
+
+// --------------------------------
+// Node identification
+
+template <class A> void Io(A& ar, Node::Id& id)
+{
+    uint8_t type = id.IsTypeNumbered() ? 1 : (id.IsTypeNamed() ? 2 : 0);
+    uint32_t num = id.Num();
+    std::string str = id.Str();
+    Io(ar, type);
+    Io(ar, num);
+    Io(ar, str);
+    if (A::IS_READER)
+    {
+        if (type == 1)
+            id.SetNum(num);
+        else if (type == 2)
+            id.setStr(str);
+        else
+            id.Invalidate();
+    }
+}
+
+template <class A> void Io(A& ar, Node::Ref& ref)
+{
+    std::string str = ref.Str();
+    uint32_t num = ref.Num();
+    uint32_t flags = ref.GetFlags();
+    uint32_t line = ref.GetLineNumber();
+    Io(ar, str);
+    Io(ar, num);
+    Io(ar, flags);
+    Io(ar, line);
+    if (A::IS_READER)
+    {
+        ref = Node::Ref(str, num, flags, line);
+    }
+}
+
+template <class A> void Io(A& ar, std::vector<Node::Range>& vec) // `Node::Range` is not default-constructible
+{
+    const uint32_t count = IoCount(ar, vec.size());
+    if (A::IS_READER)
+    {
+        vec.clear();
+        for (uint32_t i = 0; i < count; i++)
+        {
+            Node::Ref start, end;
+            Io(ar, start);
+            Io(ar, end);
+            vec.push_back(Node::Range(start, end));
+        }
+    }
+    else
+    {
+        for (Node::Range& range: vec)
+        {
+            Io(ar, range.start);
+            Io(ar, range.end);
+        }
+    }
+}
+
+// --------------------------------
+// Shared/helper rig definition data
+
+template <class A> void Io(A& ar, AeroAnimator& d)       { Io(ar, d.flags); Io(ar, d.engine_idx); }
+template <class A> void Io(A& ar, Assetpack& d)          { Io(ar, d.filename); }
+template <class A> void Io(A& ar, Inertia& d)            { Io(ar, d.start_delay_factor); Io(ar, d.stop_delay_factor); Io(ar, d.start_function); Io(ar, d.stop_function); }
+template <class A> void Io(A& ar, DocComment& d)         { Io(ar, d.comment_text); Io(ar, d.commented_keyword); Io(ar, d.commented_datapos); }
+template <class A> void Io(A& ar, DefaultMinimass& d)    { Io(ar, d.min_mass_Kg); }
+template <class A> void Io(A& ar, CameraSettings& d)     { Io(ar, d.mode); }
+
+template <class A> void Io(A& ar, NodeDefaults& d)
+{
+    Io(ar, d.load_weight); Io(ar, d.friction); Io(ar, d.volume); Io(ar, d.surface); Io(ar, d.options);
+}
+
+template <class A> void Io(A& ar, BeamDefaultsScale& d)
+{
+    Io(ar, d.springiness); Io(ar, d.damping_constant); Io(ar, d.deformation_threshold_constant); Io(ar, d.breaking_threshold_constant);
+}
+
+template <class A> void Io(A& ar, BeamDefaults& d)
+{
+    Io(ar, d.springiness); Io(ar, d.damping_constant); Io(ar, d.deformation_threshold); Io(ar, d.breaking_threshold);
+    Io(ar, d.visual_beam_diameter); Io(ar, d.beam_material_name); Io(ar, d.plastic_deform_coef);
+    Io(ar, d._enable_advanced_deformation); Io(ar, d._is_plastic_deform_coef_user_defined); Io(ar, d._is_user_defined);
+    Io(ar, d.scale);
+}
+
+template <class A> void Io(A& ar, BaseWheel& d)
+{
+    Io(ar, d.width); Io(ar, d.num_rays); Io(ar, d.nodes); Io(ar, d.rigidity_node); Io(ar, d.braking); Io(ar, d.propulsion);
+    Io(ar, d.reference_arm_node); Io(ar, d.mass); Io(ar, d.node_defaults); Io(ar, d.beam_defaults);
+}
+
+template <class A> void Io(A& ar, BaseMeshWheel& d)
+{
+    Io(ar, static_cast<BaseWheel&>(d));
+    Io(ar, d.side); Io(ar, d.mesh_name); Io(ar, d.material_name); Io(ar, d.rim_radius); Io(ar, d.tyre_radius); Io(ar, d.spring); Io(ar, d.damping);
+}
+
+template <class A> void Io(A& ar, BaseWheel2& d)
+{
+    Io(ar, static_cast<BaseWheel&>(d));
+    Io(ar, d.rim_radius); Io(ar, d.tyre_radius); Io(ar, d.tyre_springiness); Io(ar, d.tyre_damping);
+}
+
+template <class A> void Io(A& ar, Animation::MotorSource& d) { Io(ar, d.source); Io(ar, d.motor); }
+
+template <class A> void Io(A& ar, Animation& d)
+{
+    Io(ar, d.ratio); Io(ar, d.lower_limit); Io(ar, d.upper_limit); Io(ar, d.source); Io(ar, d.motor_sources);
+    Io(ar, d.mode); Io(ar, d.event_name); Io(ar, d.dash_link_name);
+}
+
+// --------------------------------
+// Rig definition data for individual elements
+
+template <class A> void Io(A& ar, Airbrake& d)
+{
+    Io(ar, d.reference_node); Io(ar, d.x_axis_node); Io(ar, d.y_axis_node); Io(ar, d.aditional_node); Io(ar, d.offset);
+    Io(ar, d.width); Io(ar, d.height); Io(ar, d.max_inclination_angle);
+    Io(ar, d.texcoord_x1); Io(ar, d.texcoord_x2); Io(ar, d.texcoord_y1); Io(ar, d.texcoord_y2); Io(ar, d.lift_coefficient);
+}
+
+template <class A> void Io(A& ar, Animator& d)
+{
+    Io(ar, d.nodes); Io(ar, d.lenghtening_factor); Io(ar, d.flags); Io(ar, d.short_limit); Io(ar, d.long_limit);
+    Io(ar, d.aero_animator); Io(ar, d.inertia_defaults); Io(ar, d.beam_defaults); Io(ar, d.detacher_group);
+}
+
+template <class A> void Io(A& ar, AntiLockBrakes& d)
+{
+    Io(ar, d.regulation_force); Io(ar, d.min_speed); Io(ar, d.pulse_per_sec); Io(ar, d.attr_is_on); Io(ar, d.attr_no_dashboard); Io(ar, d.attr_no_toggle);
+}
+
+template <class A> void Io(A& ar, Author& d)
+{
+    Io(ar, d.type); Io(ar, d.forum_account_id); Io(ar, d.name); Io(ar, d.email); Io(ar, d._has_forum_account);
+}
+
+template <class A> void Io(A& ar, Axle& d)               { Io(ar, d.wheels); Io(ar, d.options); }
+
+template <class A> void Io(A& ar, Beam& d)
+{
+    Io(ar, d.nodes); Io(ar, d.options); Io(ar, d.extension_break_limit); Io(ar, d._has_extension_break_limit); Io(ar, d.detacher_group); Io(ar, d.defaults);
+}
+
+template <class A> void Io(A& ar, Brakes& d)             { Io(ar, d.default_braking_force); Io(ar, d.parking_brake_force); }
+template <class A> void Io(A& ar, Cab& d)                { Io(ar, d.nodes); Io(ar, d.options); }
+template <class A> void Io(A& ar, Camera& d)             { Io(ar, d.center_node); Io(ar, d.back_node); Io(ar, d.left_node); }
+template <class A> void Io(A& ar, CameraRail& d)         { Io(ar, d.nodes); }
+
+template <class A> void Io(A& ar, Cinecam& d)
+{
+    Io(ar, d.position); Io(ar, d.nodes); Io(ar, d.spring); Io(ar, d.damping); Io(ar, d.node_mass); Io(ar, d.beam_defaults); Io(ar, d.node_defaults);
+}
+
+template <class A> void Io(A& ar, CollisionBox& d)       { Io(ar, d.nodes); }
+template <class A> void Io(A& ar, CollisionRange& d)     { Io(ar, d.node_collision_range); }
+
+template <class A> void Io(A& ar, Command2& d)
+{
+    Io(ar, d.nodes); Io(ar, d.shorten_rate); Io(ar, d.lengthen_rate); Io(ar, d.max_contraction); Io(ar, d.max_extension);
+    Io(ar, d.contract_key); Io(ar, d.extend_key); Io(ar, d.description); Io(ar, d.inertia); Io(ar, d.affect_engine);
+    Io(ar, d.needs_engine); Io(ar, d.plays_sound); Io(ar, d.beam_defaults); Io(ar, d.inertia_defaults); Io(ar, d.detacher_group);
+    Io(ar, d.option_i_invisible); Io(ar, d.option_r_rope); Io(ar, d.option_c_auto_center);
+    Io(ar, d.option_f_not_faster); Io(ar, d.option_p_1press); Io(ar, d.option_o_1press_center);
+}
+
+template <class A> void Io(A& ar, CruiseControl& d)          { Io(ar, d.min_speed); Io(ar, d.autobrake); }
+template <class A> void Io(A& ar, CustomDashboardInput& d)   { Io(ar, d.name); Io(ar, d.data_type); }
+template <class A> void Io(A& ar, DefaultSkin& d)            { Io(ar, d.skin_name); }
+
+template <class A> void Io(A& ar, Engine& d)
+{
+    Io(ar, d.shift_down_rpm); Io(ar, d.shift_up_rpm); Io(ar, d.torque); Io(ar, d.global_gear_ratio);
+    Io(ar, d.reverse_gear_ratio); Io(ar, d.neutral_gear_ratio); Io(ar, d.gear_ratios);
+}
+
+template <class A> void Io(A& ar, Engoption& d)
+{
+    Io(ar, d.inertia); Io(ar, d.type); Io(ar, d.clutch_force); Io(ar, d.shift_time); Io(ar, d.clutch_time); Io(ar, d.post_shift_time);
+    Io(ar, d.idle_rpm); Io(ar, d.stall_rpm); Io(ar, d.max_idle_mixture); Io(ar, d.min_idle_mixture); Io(ar, d.braking_torque);
+}
+
+template <class A> void Io(A& ar, Engturbo& d)
+{
+    Io(ar, d.version); Io(ar, d.tinertiaFactor); Io(ar, d.nturbos);
+    Io(ar, d.param1); Io(ar, d.param2); Io(ar, d.param3); Io(ar, d.param4); Io(ar, d.param5); Io(ar, d.param6);
+    Io(ar, d.param7); Io(ar, d.param8); Io(ar, d.param9); Io(ar, d.param10); Io(ar, d.param11);
+}
+
+template <class A> void Io(A& ar, Exhaust& d)            { Io(ar, d.reference_node); Io(ar, d.direction_node); Io(ar, d.particle_name); }
+template <class A> void Io(A& ar, ExtCamera& d)          { Io(ar, d.mode); Io(ar, d.node); }
+template <class A> void Io(A& ar, FileFormatVersion& d)  { Io(ar, d.version); }
+template <class A> void Io(A& ar, Fileinfo& d)           { Io(ar, d.unique_id); Io(ar, d.category_id); Io(ar, d.file_version); }
+
+template <class A> void Io(A& ar, FlareBase& d)
+{
+    Io(ar, d.reference_node); Io(ar, d.node_axis_x); Io(ar, d.node_axis_y); Io(ar, d.offset); Io(ar, d.type);
+    Io(ar, d.control_number); Io(ar, d.dashboard_link); Io(ar, d.blink_delay_milis); Io(ar, d.size); Io(ar, d.material_name);
+}
+
+template <class A> void Io(A& ar, Flare2& d)             { Io(ar, static_cast<FlareBase&>(d)); }
+template <class A> void Io(A& ar, Flare3& d)             { Io(ar, static_cast<FlareBase&>(d)); Io(ar, d.inertia_defaults); }
+template <class A> void Io(A& ar, FlaregroupNoImport& d) { Io(ar, d.type); Io(ar, d.control_number); }
+
+template <class A> void Io(A& ar, Forvert& d)
+{
+    Io(ar, d.node_ref); Io(ar, d.node_x); Io(ar, d.node_y); Io(ar, d.vert_index); Io(ar, d.line_number);
+}
+
+template <class A> void Io(A& ar, Flexbody& d)
+{
+    Io(ar, d.reference_node); Io(ar, d.x_axis_node); Io(ar, d.y_axis_node); Io(ar, d.offset); Io(ar, d.rotation); Io(ar, d.mesh_name);
+    Io(ar, d.animations); Io(ar, d.node_list_to_import); Io(ar, d.node_list); Io(ar, d.forvert); Io(ar, d.camera_settings);
+}
+
+template <class A> void Io(A& ar, FlexBodyWheel& d)
+{
+    Io(ar, static_cast<BaseWheel2&>(d));
+    Io(ar, d.side); Io(ar, d.rim_springiness); Io(ar, d.rim_damping); Io(ar, d.rim_mesh_name); Io(ar, d.tyre_mesh_name);
+}
+
+template <class A> void Io(A& ar, Fusedrag& d)
+{
+    Io(ar, d.autocalc); Io(ar, d.front_node); Io(ar, d.rear_node); Io(ar, d.approximate_width); Io(ar, d.airfoil_name); Io(ar, d.area_coefficient);
+}
+
+template <class A> void Io(A& ar, Globals& d)            { Io(ar, d.dry_mass); Io(ar, d.cargo_mass); Io(ar, d.material_name); }
+template <class A> void Io(A& ar, Guid& d)               { Io(ar, d.guid); }
+template <class A> void Io(A& ar, GuiSettings& d)        { Io(ar, d.key); Io(ar, d.value); }
+template <class A> void Io(A& ar, Help& d)               { Io(ar, d.material); }
+
+template <class A> void Io(A& ar, Hook& d)
+{
+    Io(ar, d.node); Io(ar, d.option_hook_range); Io(ar, d.option_speed_coef); Io(ar, d.option_max_force);
+    Io(ar, d.option_hookgroup); Io(ar, d.option_lockgroup); Io(ar, d.option_timer); Io(ar, d.option_min_range_meters);
+
+    // Bit-fields can't be bound to references.
+    bool self_lock = d.flag_self_lock, auto_lock = d.flag_auto_lock, no_disable = d.flag_no_disable, no_rope = d.flag_no_rope, visible = d.flag_visible;
+    Io(ar, self_lock); Io(ar, auto_lock); Io(ar, no_disable); Io(ar, no_rope); Io(ar, visible);
+    d.flag_self_lock = self_lock; d.flag_auto_lock = auto_lock; d.flag_no_disable = no_disable; d.flag_no_rope = no_rope; d.flag_visible = visible;
+}
+
+template <class A> void Io(A& ar, Hydro& d)
+{
+    Io(ar, d.nodes); Io(ar, d.lenghtening_factor); Io(ar, d.options); Io(ar, d.inertia);
+    Io(ar, d.inertia_defaults); Io(ar, d.beam_defaults); Io(ar, d.detacher_group);
+}
+
+template <class A> void Io(A& ar, InterAxle& d)          { Io(ar, d.a1); Io(ar, d.a2); Io(ar, d.options); }
+template <class A> void Io(A& ar, Lockgroup& d)          { Io(ar, d.number); Io(ar, d.nodes); }
+
+template <class A> void Io(A& ar, ManagedMaterial& d)
+{
+    Io(ar, d.name); Io(ar, d.type); Io(ar, d.options.double_sided); Io(ar, d.diffuse_map); Io(ar, d.damaged_diffuse_map); Io(ar, d.specular_map);
+}
+
+template <class A> void Io(A& ar, MaterialFlareBinding& d) { Io(ar, d.flare_number); Io(ar, d.material_name); }
+template <class A> void Io(A& ar, Minimass& d)           { Io(ar, d.global_min_mass_Kg); Io(ar, d.option); }
+template <class A> void Io(A& ar, MeshWheel& d)          { Io(ar, static_cast<BaseMeshWheel&>(d)); }
+template <class A> void Io(A& ar, MeshWheel2& d)         { Io(ar, static_cast<BaseMeshWheel&>(d)); }
+
+template <class A> void Io(A& ar, Node& d)
+{
+    Io(ar, d.id); Io(ar, d.position); Io(ar, d.options); Io(ar, d.load_weight_override); Io(ar, d._has_load_weight_override);
+    Io(ar, d.node_defaults); Io(ar, d.default_minimass); Io(ar, d.beam_defaults); Io(ar, d.detacher_group);
+}
+
+template <class A> void Io(A& ar, Particle& d)           { Io(ar, d.emitter_node); Io(ar, d.reference_node); Io(ar, d.particle_system_name); }
+
+template <class A> void Io(A& ar, Pistonprop& d)
+{
+    Io(ar, d.reference_node); Io(ar, d.axis_node); Io(ar, d.blade_tip_nodes); Io(ar, d.couple_node);
+    Io(ar, d.turbine_power_kW); Io(ar, d.pitch); Io(ar, d.airfoil);
+}
+
+template <class A> void Io(A& ar, Prop& d)
+{
+    Io(ar, d.reference_node); Io(ar, d.x_axis_node); Io(ar, d.y_axis_node); Io(ar, d.offset); Io(ar, d.rotation); Io(ar, d.mesh_name);
+    Io(ar, d.animations); Io(ar, d.camera_settings); Io(ar, d.special);
+    Io(ar, d.special_prop_beacon.flare_material_name); Io(ar, d.special_prop_beacon.color);
+    Io(ar, d.special_prop_dashboard.offset); Io(ar, d.special_prop_dashboard._offset_is_set);
+    Io(ar, d.special_prop_dashboard.rotation_angle); Io(ar, d.special_prop_dashboard.mesh_name);
+}
+
+template <class A> void Io(A& ar, RailGroup& d)          { Io(ar, d.id); Io(ar, d.node_list); }
+template <class A> void Io(A& ar, Ropable& d)            { Io(ar, d.node); Io(ar, d.group); Io(ar, d.has_multilock); }
+
+template <class A> void Io(A& ar, Rope& d)
+{
+    Io(ar, d.root_node); Io(ar, d.end_node); Io(ar, d.invisible); Io(ar, d.beam_defaults); Io(ar, d.detacher_group);
+}
+
+template <class A> void Io(A& ar, Rotator& d)
+{
+    Io(ar, d.axis_nodes); Io(ar, d.base_plate_nodes); Io(ar, d.rotating_plate_nodes); Io(ar, d.rate);
+    Io(ar, d.spin_left_key); Io(ar, d.spin_right_key); Io(ar, d.inertia); Io(ar, d.inertia_defaults);
+    Io(ar, d.engine_coupling); Io(ar, d.needs_engine);
+}
+
+template <class A> void Io(A& ar, Rotator2& d)
+{
+    Io(ar, static_cast<Rotator&>(d));
+    Io(ar, d.rotating_force); Io(ar, d.tolerance); Io(ar, d.description);
+}
+
+template <class A> void Io(A& ar, Screwprop& d)          { Io(ar, d.prop_node); Io(ar, d.back_node); Io(ar, d.top_node); Io(ar, d.power); }
+template <class A> void Io(A& ar, Script& d)             { Io(ar, d.filename); }
+
+template <class A> void Io(A& ar, Shock& d)
+{
+    Io(ar, d.nodes); Io(ar, d.spring_rate); Io(ar, d.damping); Io(ar, d.short_bound); Io(ar, d.long_bound);
+    Io(ar, d.precompression); Io(ar, d.options); Io(ar, d.beam_defaults); Io(ar, d.detacher_group);
+}
+
+template <class A> void Io(A& ar, Shock2& d)
+{
+    Io(ar, d.nodes); Io(ar, d.spring_in); Io(ar, d.damp_in); Io(ar, d.progress_factor_spring_in); Io(ar, d.progress_factor_damp_in);
+    Io(ar, d.spring_out); Io(ar, d.damp_out); Io(ar, d.progress_factor_spring_out); Io(ar, d.progress_factor_damp_out);
+    Io(ar, d.short_bound); Io(ar, d.long_bound); Io(ar, d.precompression); Io(ar, d.options); Io(ar, d.beam_defaults); Io(ar, d.detacher_group);
+}
+
+template <class A> void Io(A& ar, Shock3& d)
+{
+    Io(ar, d.nodes); Io(ar, d.spring_in); Io(ar, d.damp_in); Io(ar, d.spring_out); Io(ar, d.damp_out);
+    Io(ar, d.damp_in_slow); Io(ar, d.split_vel_in); Io(ar, d.damp_in_fast); Io(ar, d.damp_out_slow); Io(ar, d.split_vel_out); Io(ar, d.damp_out_fast);
+    Io(ar, d.short_bound); Io(ar, d.long_bound); Io(ar, d.precompression); Io(ar, d.options); Io(ar, d.beam_defaults); Io(ar, d.detacher_group);
+}
+
+template <class A> void Io(A& ar, SkeletonSettings& d)   { Io(ar, d.visibility_range_meters); Io(ar, d.beam_thickness_meters); }
+
+template <class A> void Io(A& ar, SlideNode& d)
+{
+    Io(ar, d.slide_node); Io(ar, d.rail_node_ranges); Io(ar, d.constraint_flags);
+    Io(ar, d.spring_rate);     Io(ar, d._spring_rate_set);
+    Io(ar, d.break_force);     Io(ar, d._break_force_set);
+    Io(ar, d.tolerance);       Io(ar, d._tolerance_set);
+    Io(ar, d.attachment_rate); Io(ar, d._attachment_rate_set);
+    Io(ar, d.railgroup_id);    Io(ar, d._railgroup_id_set);
+    Io(ar, d.max_attach_dist); Io(ar, d._max_attach_dist_set);
+}
+
+template <class A> void Io(A& ar, SoundSource& d)        { Io(ar, d.node); Io(ar, d.sound_script_name); }
+template <class A> void Io(A& ar, SoundSource2& d)       { Io(ar, static_cast<SoundSource&>(d)); Io(ar, d.mode); }
+template <class A> void Io(A& ar, SpeedLimiter& d)       { Io(ar, d.max_speed); Io(ar, d.is_enabled); }
+template <class A> void Io(A& ar, Texcoord& d)           { Io(ar, d.node); Io(ar, d.u); Io(ar, d.v); }
+template <class A> void Io(A& ar, Submesh& d)            { Io(ar, d.backmesh); Io(ar, d.texcoords); Io(ar, d.cab_triangles); }
+
+template <class A> void Io(A& ar, Tie& d)
+{
+    Io(ar, d.root_node); Io(ar, d.max_reach_length); Io(ar, d.auto_shorten_rate); Io(ar, d.min_length); Io(ar, d.max_length);
+    Io(ar, d.options); Io(ar, d.max_stress); Io(ar, d.beam_defaults); Io(ar, d.detacher_group); Io(ar, d.group);
+}
+
+template <class A> void Io(A& ar, TorqueCurve::Sample& d) { Io(ar, d.power); Io(ar, d.torque_percent); }
+template <class A> void Io(A& ar, TorqueCurve& d)        { Io(ar, d.samples); Io(ar, d.predefined_func_name); }
+
+template <class A> void Io(A& ar, TractionControl& d)
+{
+    Io(ar, d.regulation_force); Io(ar, d.wheel_slip); Io(ar, d.fade_speed); Io(ar, d.pulse_per_sec);
+    Io(ar, d.attr_is_on); Io(ar, d.attr_no_dashboard); Io(ar, d.attr_no_toggle);
+}
+
+template <class A> void Io(A& ar, TransferCase& d)
+{
+    Io(ar, d.a1); Io(ar, d.a2); Io(ar, d.has_2wd); Io(ar, d.has_2wd_lo); Io(ar, d.gear_ratios);
+}
+
+template <class A> void Io(A& ar, Trigger& d)
+{
+    Io(ar, d.nodes); Io(ar, d.contraction_trigger_limit); Io(ar, d.expansion_trigger_limit); Io(ar, d.options); Io(ar, d.boundary_timer);
+    Io(ar, d.beam_defaults); Io(ar, d.detacher_group); Io(ar, d.shortbound_trigger_action); Io(ar, d.longbound_trigger_action);
+}
+
+template <class A> void Io(A& ar, Turbojet& d)
+{
+    Io(ar, d.front_node); Io(ar, d.back_node); Io(ar, d.side_node); Io(ar, d.is_reversable); Io(ar, d.dry_thrust); Io(ar, d.wet_thrust);
+    Io(ar, d.front_diameter); Io(ar, d.back_diameter); Io(ar, d.nozzle_length);
+}
+
+template <class A> void Io(A& ar, Turboprop2& d)
+{
+    Io(ar, d.reference_node); Io(ar, d.axis_node); Io(ar, d.blade_tip_nodes); Io(ar, d.turbine_power_kW); Io(ar, d.airfoil); Io(ar, d.couple_node);
+}
+
+template <class A> void Io(A& ar, VideoCamera& d)
+{
+    Io(ar, d.reference_node); Io(ar, d.left_node); Io(ar, d.bottom_node); Io(ar, d.alt_reference_node); Io(ar, d.alt_orientation_node);
+    Io(ar, d.offset); Io(ar, d.rotation); Io(ar, d.field_of_view); Io(ar, d.texture_width); Io(ar, d.texture_height);
+    Io(ar, d.min_clip_distance); Io(ar, d.max_clip_distance); Io(ar, d.camera_role); Io(ar, d.camera_mode);
+    Io(ar, d.material_name); Io(ar, d.camera_name);
+}
+
+template <class A> void Io(A& ar, Wheel& d)
+{
+    Io(ar, static_cast<BaseWheel&>(d));
+    Io(ar, d.radius); Io(ar, d.springiness); Io(ar, d.damping); Io(ar, d.face_material_name); Io(ar, d.band_material_name);
+}
+
+template <class A> void Io(A& ar, Wheel2& d)
+{
+    Io(ar, static_cast<BaseWheel2&>(d));
+    Io(ar, d.rim_springiness); Io(ar, d.rim_damping); Io(ar, d.face_material_name); Io(ar, d.band_material_name);
+}
+
+template <class A> void Io(A& ar, WheelDetacher& d)      { Io(ar, d.wheel_id); Io(ar, d.detacher_group); }
+
+template <class A> void Io(A& ar, Wing& d)
+{
+    Io(ar, d.nodes); Io(ar, d.tex_coords); Io(ar, d.control_surface); Io(ar, d.chord_point);
+    Io(ar, d.min_deflection); Io(ar, d.max_deflection); Io(ar, d.airfoil); Io(ar, d.efficacy_coef);
+}
+
+// --------------------------------
+// The document
+
+template <class A> void Io(A& ar, Document::Module& m)
+{
+    // Note `origin_addonpart` is runtime-only (addonparts are never precompiled).
+    Io(ar, m.name);
+    Io(ar, m.airbrakes);             Io(ar, m.animators);             Io(ar, m.antilockbrakes);        Io(ar, m.assetpacks);
+    Io(ar, m.author);                Io(ar, m.axles);                 Io(ar, m.beams);                 Io(ar, m.brakes);
+    Io(ar, m.cameras);               Io(ar, m.camerarail);            Io(ar, m.collisionboxes);        Io(ar, m.cinecam);
+    Io(ar, m.commands2);             Io(ar, m.cruisecontrol);         Io(ar, m.contacters);            Io(ar, m.customdashboardinputs);
+    Io(ar, m.default_skin);          Io(ar, m.description);           Io(ar, m.engine);                Io(ar, m.engoption);
+    Io(ar, m.engturbo);              Io(ar, m.exhausts);              Io(ar, m.extcamera);             Io(ar, m.fileformatversion);
+    Io(ar, m.fixes);                 Io(ar, m.fileinfo);              Io(ar, m.flares2);               Io(ar, m.flares3);
+    Io(ar, m.flaregroups_no_import); Io(ar, m.flexbodies);            Io(ar, m.flexbodywheels);        Io(ar, m.fusedrag);
+    Io(ar, m.globals);               Io(ar, m.guid);                  Io(ar, m.guisettings);           Io(ar, m.help);
+    Io(ar, m.hooks);                 Io(ar, m.hydros);                Io(ar, m.interaxles);            Io(ar, m.lockgroups);
+    Io(ar, m.managedmaterials);      Io(ar, m.materialflarebindings); Io(ar, m.meshwheels);            Io(ar, m.meshwheels2);
+    Io(ar, m.minimass);              Io(ar, m.nodes);                 Io(ar, m.particles);             Io(ar, m.pistonprops);
+    Io(ar, m.props);                 Io(ar, m.railgroups);            Io(ar, m.ropables);              Io(ar, m.ropes);
+    Io(ar, m.rotators);              Io(ar, m.rotators2);             Io(ar, m.screwprops);            Io(ar, m.scripts);
+    Io(ar, m.shocks);                Io(ar, m.shocks2);               Io(ar, m.shocks3);               Io(ar, m.set_collision_range);
+    Io(ar, m.set_skeleton_settings); Io(ar, m.slidenodes);            Io(ar, m.soundsources);          Io(ar, m.soundsources2);
+    Io(ar, m.speedlimiter);          Io(ar, m.submesh_groundmodel);   Io(ar, m.submeshes);             Io(ar, m.ties);
+    Io(ar, m.torquecurve);           Io(ar, m.tractioncontrol);       Io(ar, m.transfercase);          Io(ar, m.triggers);
+    Io(ar, m.turbojets);             Io(ar, m.turboprops2);           Io(ar, m.videocameras);          Io(ar, m.wheeldetachers);
+    Io(ar, m.wheels);                Io(ar, m.wheels2);               Io(ar, m.wings);
+
+    Io(ar, m._hint_nodes12_start_linenumber); Io(ar, m._hint_nodes12_end_linenumber);
+    Io(ar, m._hint_beams_start_linenumber);   Io(ar, m._hint_beams_end_linenumber);
+    Io(ar, m._comments);
+}
+
+template <class A> void Io(A& ar, Document& doc)
+{
+    Io(ar, doc.hide_in_chooser); Io(ar, doc.enable_advanced_deformation); Io(ar, doc.slide_nodes_connect_instantly);
+    Io(ar, doc.rollon); Io(ar, doc.forward_commands); Io(ar, doc.import_commands); Io(ar, doc.lockgroup_default_nolock);
+    Io(ar, doc.rescuer); Io(ar, doc.disable_default_sounds); Io(ar, doc.name); Io(ar, doc.hash);
+
+    Io(ar, *doc.root_module); // Always exists
+
+    const uint32_t num_user_modules = IoCount(ar, doc.user_modules.size());
+    if (A::IS_READER)
+    {
+        doc.user_modules.clear();
+        for (uint32_t i = 0; i < num_user_modules; i++)
+        {
+            std::string key;
+            Io(ar, key);
+            auto module = std::make_shared<Document::Module>(key);
+            Io(ar, *module);
+            doc.user_modules[key] = module;
+        }
+    }
+    else
+    {
+        for (auto& entry: doc.user_modules)
+        {
+            std::string key = entry.first;
+            Io(ar, key);
+            Io(ar, *entry.second);
+        }
+    }
+}
+
+// --------------------------------
+// Layout guard: a change of any serialized struct must be reflected in its `Io()` and `BinarySerializer::FORMAT_VERSION`.
+// When an assert fails, update the `Io()`, bump the version and then the expected size here.
+// Sizes are ABI-specific, so they're only checked on the reference platform (64-bit libstdc++).
+
+#if defined(__x86_64__) && defined(__GLIBCXX__)
+#   define ROR_TRUCKC_LAYOUT(TYPE, SIZE) static_assert(sizeof(TYPE) == SIZE, "RigDef::" #TYPE " changed - update its Io() and bump BinarySerializer::FORMAT_VERSION")
+#else
+#   define ROR_TRUCKC_LAYOUT(TYPE, SIZE) static_assert(true, "")
+#endif
+
+ROR_TRUCKC_LAYOUT(Node::Id, 48);              ROR_TRUCKC_LAYOUT(Node::Ref, 48);             ROR_TRUCKC_LAYOUT(Node::Range, 96);
+ROR_TRUCKC_LAYOUT(AeroAnimator, 8);           ROR_TRUCKC_LAYOUT(Assetpack, 32);             ROR_TRUCKC_LAYOUT(Inertia, 72);
+ROR_TRUCKC_LAYOUT(DocComment, 40);            ROR_TRUCKC_LAYOUT(DefaultMinimass, 4);        ROR_TRUCKC_LAYOUT(CameraSettings, 4);
+ROR_TRUCKC_LAYOUT(NodeDefaults, 20);          ROR_TRUCKC_LAYOUT(BeamDefaultsScale, 16);     ROR_TRUCKC_LAYOUT(BeamDefaults, 80);
+ROR_TRUCKC_LAYOUT(BaseWheel, 248);            ROR_TRUCKC_LAYOUT(BaseMeshWheel, 336);        ROR_TRUCKC_LAYOUT(BaseWheel2, 264);
+ROR_TRUCKC_LAYOUT(Animation::MotorSource, 8); ROR_TRUCKC_LAYOUT(Animation, 120);            ROR_TRUCKC_LAYOUT(Airbrake, 240);
+ROR_TRUCKC_LAYOUT(Animator, 160);             ROR_TRUCKC_LAYOUT(AntiLockBrakes, 16);        ROR_TRUCKC_LAYOUT(Author, 112);
+ROR_TRUCKC_LAYOUT(Axle, 216);                 ROR_TRUCKC_LAYOUT(Beam, 128);                 ROR_TRUCKC_LAYOUT(Brakes, 8);
+ROR_TRUCKC_LAYOUT(Cab, 152);                  ROR_TRUCKC_LAYOUT(Camera, 144);               ROR_TRUCKC_LAYOUT(CameraRail, 24);
+ROR_TRUCKC_LAYOUT(Cinecam, 448);              ROR_TRUCKC_LAYOUT(CollisionBox, 24);          ROR_TRUCKC_LAYOUT(CollisionRange, 4);
+ROR_TRUCKC_LAYOUT(Command2, 280);             ROR_TRUCKC_LAYOUT(CruiseControl, 8);          ROR_TRUCKC_LAYOUT(CustomDashboardInput, 40);
+ROR_TRUCKC_LAYOUT(DefaultSkin, 32);           ROR_TRUCKC_LAYOUT(Engine, 48);                ROR_TRUCKC_LAYOUT(Engoption, 44);
+ROR_TRUCKC_LAYOUT(Engturbo, 56);              ROR_TRUCKC_LAYOUT(Exhaust, 128);              ROR_TRUCKC_LAYOUT(ExtCamera, 56);
+ROR_TRUCKC_LAYOUT(FileFormatVersion, 4);      ROR_TRUCKC_LAYOUT(Fileinfo, 40);              ROR_TRUCKC_LAYOUT(FlareBase, 240);
+ROR_TRUCKC_LAYOUT(Flare2, 240);               ROR_TRUCKC_LAYOUT(Flare3, 256);               ROR_TRUCKC_LAYOUT(FlaregroupNoImport, 8);
+ROR_TRUCKC_LAYOUT(Forvert, 152);              ROR_TRUCKC_LAYOUT(Flexbody, 304);             ROR_TRUCKC_LAYOUT(FlexBodyWheel, 344);
+ROR_TRUCKC_LAYOUT(Fusedrag, 152);             ROR_TRUCKC_LAYOUT(Globals, 40);               ROR_TRUCKC_LAYOUT(Guid, 32);
+ROR_TRUCKC_LAYOUT(GuiSettings, 64);           ROR_TRUCKC_LAYOUT(Help, 32);                  ROR_TRUCKC_LAYOUT(Hook, 80);
+ROR_TRUCKC_LAYOUT(Hydro, 216);                ROR_TRUCKC_LAYOUT(InterAxle, 32);             ROR_TRUCKC_LAYOUT(Lockgroup, 32);
+ROR_TRUCKC_LAYOUT(ManagedMaterial, 136);      ROR_TRUCKC_LAYOUT(MaterialFlareBinding, 40);  ROR_TRUCKC_LAYOUT(Minimass, 8);
+ROR_TRUCKC_LAYOUT(MeshWheel, 336);            ROR_TRUCKC_LAYOUT(MeshWheel2, 336);           ROR_TRUCKC_LAYOUT(Node, 128);
+ROR_TRUCKC_LAYOUT(Particle, 128);             ROR_TRUCKC_LAYOUT(Pistonprop, 376);           ROR_TRUCKC_LAYOUT(Prop, 336);
+ROR_TRUCKC_LAYOUT(RailGroup, 32);             ROR_TRUCKC_LAYOUT(Ropable, 56);               ROR_TRUCKC_LAYOUT(Rope, 128);
+ROR_TRUCKC_LAYOUT(Rotator, 592);              ROR_TRUCKC_LAYOUT(Rotator2, 632);             ROR_TRUCKC_LAYOUT(Screwprop, 152);
+ROR_TRUCKC_LAYOUT(Script, 32);                ROR_TRUCKC_LAYOUT(Shock, 144);                ROR_TRUCKC_LAYOUT(Shock2, 168);
+ROR_TRUCKC_LAYOUT(Shock3, 176);               ROR_TRUCKC_LAYOUT(SkeletonSettings, 8);       ROR_TRUCKC_LAYOUT(SlideNode, 128);
+ROR_TRUCKC_LAYOUT(SoundSource, 80);           ROR_TRUCKC_LAYOUT(SoundSource2, 88);          ROR_TRUCKC_LAYOUT(SpeedLimiter, 8);
+ROR_TRUCKC_LAYOUT(Texcoord, 56);              ROR_TRUCKC_LAYOUT(Submesh, 56);               ROR_TRUCKC_LAYOUT(Tie, 96);
+ROR_TRUCKC_LAYOUT(TorqueCurve::Sample, 8);    ROR_TRUCKC_LAYOUT(TorqueCurve, 56);           ROR_TRUCKC_LAYOUT(TractionControl, 20);
+ROR_TRUCKC_LAYOUT(TransferCase, 40);          ROR_TRUCKC_LAYOUT(Trigger, 144);              ROR_TRUCKC_LAYOUT(Turbojet, 168);
+ROR_TRUCKC_LAYOUT(Turboprop2, 376);           ROR_TRUCKC_LAYOUT(VideoCamera, 360);          ROR_TRUCKC_LAYOUT(Wheel, 328);
+ROR_TRUCKC_LAYOUT(Wheel2, 336);               ROR_TRUCKC_LAYOUT(WheelDetacher, 8);          ROR_TRUCKC_LAYOUT(Wing, 472);
+ROR_TRUCKC_LAYOUT(Document::Module, 1976);    ROR_TRUCKC_LAYOUT(Document, 144);
+
+#undef ROR_TRUCKC_LAYOUT
+
+// --------------------------------
+// File header
+
+std::string GetBuildStamp() // Parser/Validator behavior is not versioned - any other build may produce a different document.
+{
+    return std::string(ROR_VERSION_STRING) + " " + ROR_BUILD_DATE + " " + ROR_BUILD_TIME;
+}
+
+template <class A> void IoHeader(A& ar, BinarySourceStamp& stamp, uint64_t& payload_checksum)
+{
+    std::string signature = TRUCKC_SIGNATURE;
+    uint32_t version = BinarySerializer::FORMAT_VERSION;
+    uint32_t byte_order_mark = TRUCKC_BYTE_ORDER_MARK;
+    std::string build = GetBuildStamp();
+    Io(ar, signature);
+    Io(ar, version);
+    Io(ar, byte_order_mark);
+    Io(ar, build);
+    if (signature != TRUCKC_SIGNATURE || version != BinarySerializer::FORMAT_VERSION || byte_order_mark != TRUCKC_BYTE_ORDER_MARK
+        || build != GetBuildStamp())
+    {
+        throw std::runtime_error("incompatible format");
+    }
+    Io(ar, stamp.bss_filename);
+    Io(ar, stamp.bss_filetime);
+    Io(ar, stamp.bss_filesize);
+    Io(ar, payload_checksum);
+}
+
+} // namespace
+
+std::string BinarySerializer::Serialize(DocumentPtr def, BinarySourceStamp const& stamp)
+{
+    BinaryWriter payload;
+    Io(payload, *def);
+
+    BinaryWriter header;
+    BinarySourceStamp header_stamp = stamp;
+    uint64_t payload_checksum = HashBytes(payload.GetOutput().data(), payload.GetOutput().size());
+    IoHeader(header, header_stamp, payload_checksum);
+
+    return header.GetOutput() + payload.GetOutput();
+}
+
+DocumentPtr BinarySerializer::Deserialize(const char* data, size_t size, BinarySourceStamp const& stamp)
+{
+    try
+    {
+        BinaryReader reader(data, size);
+        BinarySourceStamp file_stamp;
+        uint64_t payload_checksum = 0;
+        IoHeader(reader, file_stamp, payload_checksum);
+        if (file_stamp.bss_filename != stamp.bss_filename
+            || file_stamp.bss_filetime != stamp.bss_filetime
+            || file_stamp.bss_filesize != stamp.bss_filesize)
+        {
+            return nullptr; // Stale
+        }
+
+        // The header has a fixed layout up to the checksum; the payload is the rest.
+        BinaryWriter header;
+        IoHeader(header, file_stamp, payload_checksum);
+        const size_t header_size = header.GetOutput().size();
+        if (HashBytes(data + header_size, size - header_size) != payload_checksum)
+        {
+            return nullptr; // Damaged
+        }
+
+        DocumentPtr def = std::make_shared<Document>();
+        Io(reader, *def);
+        if (!reader.IsAtEnd())
+        {
+            return nullptr;
+        }
+        return def;
+    }
+    catch (std::exception&)
+    {
+        return nullptr;
+    }
+}
+
+bool BinarySerializer::SaveFile(DocumentPtr def, BinarySourceStamp const& stamp, std::string const& path)
+{
+    const std::string data = BinarySerializer::Serialize(def, stamp);
+
+    // Write to a temporary file first - a half-written '.truckc' must never be seen.
+    const std::string tmp_path = path + ".tmp";
+    FILE* file = fopen(tmp_path.c_str(), "wb");
+    if (!file)
+    {
+        return false;
+    }
+    const bool written = (fwrite(data.data(), 1, data.size(), file) == data.size());
+    const bool closed = (fclose(file) == 0);
+    if (!written || !closed)
+    {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+
+    std::remove(path.c_str()); // Required on Windows
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+    {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+DocumentPtr BinarySerializer::LoadFile(BinarySourceStamp const& stamp, std::string const& path)
+{
+    RoR::MappedFile mapping;
+    if (!mapping.Open(path))
+    {
+        return nullptr;
+    }
+    return BinarySerializer::Deserialize(reinterpret_cast<const char*>(mapping.GetData()), mapping.GetSize(), stamp);
+}
+
+bool BinarySerializer::Verify(DocumentPtr def)
+{
+    const BinarySourceStamp stamp;
+    const std::string data = BinarySerializer::Serialize(def, stamp);
+    DocumentPtr copy = BinarySerializer::Deserialize(data.data(), data.size(), stamp);
+    if (!copy)
+    {
+        return false;
+    }
+
+    Serializer orig_text(def);
+    orig_text.Serialize();
+    Serializer copy_text(copy);
+    copy_text.Serialize();
+    return orig_text.GetOutput() == copy_text.GetOutput();
+}
@@ -0,0 +1,62 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+/// @brief  Precompiled binary form of truckfiles ('.truckc'), see `RigDef::BinarySerializer`.
+
+#pragma once
+
+#include "RigDef_File.h"
+
+#include <cstdint>
+#include <string>
+
+namespace RigDef
+{
+
+/// Identifies the truckfile a '.truckc' was compiled from; any difference means the '.truckc' is stale.
+struct BinarySourceStamp
+{
+    std::string   bss_filename;      //!< Truckfile name (as in mod cache).
+    int64_t       bss_filetime = 0;  //!< Last modification of the truckfile or the ZIP containing it.
+    uint64_t      bss_filesize = 0;  //!< Size of the truckfile.
+};
+
+/// @class  BinarySerializer
+///
+/// @brief Saves/loads the `RigDef::Document` data structure in a versioned binary format,
+///        so known truckfiles can be spawned without running `RigDef::Parser` and `RigDef::Validator`.
+///        Files are also tied to the game build which wrote them, since parsing rules change between builds.
+///        The text round-trip (`RigDef::Serializer`) remains the reference format, see `Verify()`.
+class BinarySerializer
+{
+public:
+    static const uint32_t FORMAT_VERSION = 2; //!< Bump on any change of `RigDef` data structures! (Enforced by size checks in RigDef_BinarySerializer.cpp)
+
+    static bool          SaveFile(DocumentPtr def, BinarySourceStamp const& stamp, std::string const& path);
+    static DocumentPtr   LoadFile(BinarySourceStamp const& stamp, std::string const& path); //!< Returns nullptr if missing, stale or damaged.
+
+    static std::string   Serialize(DocumentPtr def, BinarySourceStamp const& stamp);
+    static DocumentPtr   Deserialize(const char* data, size_t size, BinarySourceStamp const& stamp); //!< Returns nullptr on any mismatch.
+
+    /// Checks the binary round-trip by comparing text serializations (`RigDef::Serializer`) of the original and the copy.
+    static bool          Verify(DocumentPtr def);
+};
+
+} // namespace RigDef
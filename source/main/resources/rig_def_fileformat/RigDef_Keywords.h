@@ -0,0 +1,153 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+/// @brief  List of truckfile keywords and their syntax, for the keyword lexer in `RigDef::Parser::IdentifyKeyword()`.
+///
+/// KEYWORD SYNTAX (case-insensitive, the keyword must start at column 0):
+///   BLOCK              ~ Keyword alone on the line, optionally followed by blanks.
+///   INLINE             ~ Keyword followed by a separator (space/tab/comma/colon/pipe) and arguments.
+///   INLINE_UNSEPARATED ~ Keyword directly followed by arguments, see BEWARE OF QUIRKS in `ProcessForsetLine()`.
+///
+/// Usage: define `RIGDEF_KEYWORD(_ENUM_, _NAME_, _SYNTAX_)`, expand `RIGDEF_KEYWORD_LIST`, undefine.
+/// IMPORTANT! If you add a value here, you must also modify `RigDef::Keyword` enum in Application.h
+
+#pragma once
+
+#define RIGDEF_KEYWORD_LIST \
+    RIGDEF_KEYWORD( ADD_ANIMATION,                "add_animation",                 INLINE ) \
+    RIGDEF_KEYWORD( AIRBRAKES,                    "airbrakes",                     BLOCK ) \
+    RIGDEF_KEYWORD( ANIMATORS,                    "animators",                     BLOCK ) \
+    RIGDEF_KEYWORD( ANTILOCKBRAKES,               "AntiLockBrakes",                INLINE ) \
+    RIGDEF_KEYWORD( ASSETPACKS,                   "assetpacks",                    BLOCK ) \
+    RIGDEF_KEYWORD( AUTHOR,                       "author",                        INLINE ) \
+    RIGDEF_KEYWORD( AXLES,                        "axles",                         BLOCK ) \
+    RIGDEF_KEYWORD( BACKMESH,                     "backmesh",                      BLOCK ) \
+    RIGDEF_KEYWORD( BEAMS,                        "beams",                         BLOCK ) \
+    RIGDEF_KEYWORD( BRAKES,                       "brakes",                        BLOCK ) \
+    RIGDEF_KEYWORD( CAB,                          "cab",                           BLOCK ) \
+    RIGDEF_KEYWORD( CAMERARAIL,                   "camerarail",                    BLOCK ) \
+    RIGDEF_KEYWORD( CAMERAS,                      "cameras",                       BLOCK ) \
+    RIGDEF_KEYWORD( CINECAM,                      "cinecam",                       BLOCK ) \
+    RIGDEF_KEYWORD( COLLISIONBOXES,               "collisionboxes",                BLOCK ) \
+    RIGDEF_KEYWORD( COMMANDS,                     "commands",                      BLOCK ) \
+    RIGDEF_KEYWORD( COMMANDS2,                    "commands2",                     BLOCK ) \
+    RIGDEF_KEYWORD( COMMENT,                      "comment",                       BLOCK ) \
+    RIGDEF_KEYWORD( CONTACTERS,                   "contacters",                    BLOCK ) \
+    RIGDEF_KEYWORD( CRUISECONTROL,                "cruisecontrol",                 INLINE ) \
+    RIGDEF_KEYWORD( CUSTOMDASHBOARDINPUTS,        "customdashboardinputs",         BLOCK ) \
+    RIGDEF_KEYWORD( DEFAULT_SKIN,                 "default_skin",                  INLINE ) \
+    RIGDEF_KEYWORD( DESCRIPTION,                  "description",                   BLOCK ) \
+    RIGDEF_KEYWORD( DETACHER_GROUP,               "detacher_group",                INLINE ) \
+    RIGDEF_KEYWORD( DISABLEDEFAULTSOUNDS,         "disabledefaultsounds",          BLOCK ) \
+    RIGDEF_KEYWORD( ENABLE_ADVANCED_DEFORMATION,  "enable_advanced_deformation",   BLOCK ) \
+    RIGDEF_KEYWORD( END,                          "end",                           BLOCK ) \
+    RIGDEF_KEYWORD( END_COMMENT,                  "end_comment",                   BLOCK ) \
+    RIGDEF_KEYWORD( END_DESCRIPTION,              "end_description",               BLOCK ) \
+    RIGDEF_KEYWORD( END_SECTION,                  "end_section",                   BLOCK ) \
+    RIGDEF_KEYWORD( ENGINE,                       "engine",                        BLOCK ) \
+    RIGDEF_KEYWORD( ENGOPTION,                    "engoption",                     BLOCK ) \
+    RIGDEF_KEYWORD( ENGTURBO,                     "engturbo",                      BLOCK ) \
+    RIGDEF_KEYWORD( ENVMAP,                       "envmap",                        BLOCK ) \
+    RIGDEF_KEYWORD( EXHAUSTS,                     "exhausts",                      BLOCK ) \
+    RIGDEF_KEYWORD( EXTCAMERA,                    "extcamera",                     INLINE ) \
+    RIGDEF_KEYWORD( FILEFORMATVERSION,            "fileformatversion",             INLINE ) \
+    RIGDEF_KEYWORD( FILEINFO,                     "fileinfo",                      INLINE ) \
+    RIGDEF_KEYWORD( FIXES,                        "fixes",                         BLOCK ) \
+    RIGDEF_KEYWORD( FLARES,                       "flares",                        BLOCK ) \
+    RIGDEF_KEYWORD( FLARES2,                      "flares2",                       BLOCK ) \
+    RIGDEF_KEYWORD( FLARES3,                      "flares3",                       BLOCK ) \
+    RIGDEF_KEYWORD( FLAREGROUPS_NO_IMPORT,        "flaregroups_no_import",         BLOCK ) \
+    RIGDEF_KEYWORD( FLEXBODIES,                   "flexbodies",                    BLOCK ) \
+    RIGDEF_KEYWORD( FLEXBODY_CAMERA_MODE,         "flexbody_camera_mode",          INLINE ) \
+    RIGDEF_KEYWORD( FLEXBODYWHEELS,               "flexbodywheels",                BLOCK ) \
+    RIGDEF_KEYWORD( FORSET,                       "forset",                        INLINE_UNSEPARATED ) \
+    RIGDEF_KEYWORD( FORVERT,                      "forvert",                       INLINE ) \
+    RIGDEF_KEYWORD( FORWARDCOMMANDS,              "forwardcommands",               BLOCK ) \
+    RIGDEF_KEYWORD( FUSEDRAG,                     "fusedrag",                      BLOCK ) \
+    RIGDEF_KEYWORD( GLOBALS,                      "globals",                       BLOCK ) \
+    RIGDEF_KEYWORD( GUID,                         "guid",                          INLINE ) \
+    RIGDEF_KEYWORD( GUISETTINGS,                  "guisettings",                   BLOCK ) \
+    RIGDEF_KEYWORD( HELP,                         "help",                          BLOCK ) \
+    RIGDEF_KEYWORD( HIDEINCHOOSER,                "hideInChooser",                 BLOCK ) \
+    RIGDEF_KEYWORD( HOOKGROUP,                    "hookgroup",                     BLOCK ) \
+    RIGDEF_KEYWORD( HOOKS,                        "hooks",                         BLOCK ) \
+    RIGDEF_KEYWORD( HYDROS,                       "hydros",                        BLOCK ) \
+    RIGDEF_KEYWORD( IMPORTCOMMANDS,               "importcommands",                BLOCK ) \
+    RIGDEF_KEYWORD( INTERAXLES,                   "interaxles",                    BLOCK ) \
+    RIGDEF_KEYWORD( LOCKGROUPS,                   "lockgroups",                    BLOCK ) \
+    RIGDEF_KEYWORD( LOCKGROUP_DEFAULT_NOLOCK,     "lockgroup_default_nolock",      BLOCK ) \
+    RIGDEF_KEYWORD( MANAGEDMATERIALS,             "managedmaterials",              BLOCK ) \
+    RIGDEF_KEYWORD( MATERIALFLAREBINDINGS,        "materialflarebindings",         BLOCK ) \
+    RIGDEF_KEYWORD( MESHWHEELS,                   "meshwheels",                    BLOCK ) \
+    RIGDEF_KEYWORD( MESHWHEELS2,                  "meshwheels2",                   BLOCK ) \
+    RIGDEF_KEYWORD( MINIMASS,                     "minimass",                      BLOCK ) \
+    RIGDEF_KEYWORD( NODECOLLISION,                "nodecollision",                 BLOCK ) \
+    RIGDEF_KEYWORD( NODES,                        "nodes",                         BLOCK ) \
+    RIGDEF_KEYWORD( NODES2,                       "nodes2",                        BLOCK ) \
+    RIGDEF_KEYWORD( PARTICLES,                    "particles",                     BLOCK ) \
+    RIGDEF_KEYWORD( PISTONPROPS,                  "pistonprops",                   BLOCK ) \
+    RIGDEF_KEYWORD( PROP_CAMERA_MODE,             "prop_camera_mode",              INLINE ) \
+    RIGDEF_KEYWORD( PROPS,                        "props",                         BLOCK ) \
+    RIGDEF_KEYWORD( RAILGROUPS,                   "railgroups",                    BLOCK ) \
+    RIGDEF_KEYWORD( RESCUER,                      "rescuer",                       BLOCK ) \
+    RIGDEF_KEYWORD( RIGIDIFIERS,                  "rigidifiers",                   BLOCK ) \
+    RIGDEF_KEYWORD( ROLLON,                       "rollon",                        BLOCK ) \
+    RIGDEF_KEYWORD( ROPABLES,                     "ropables",                      BLOCK ) \
+    RIGDEF_KEYWORD( ROPES,                        "ropes",                         BLOCK ) \
+    RIGDEF_KEYWORD( ROTATORS,                     "rotators",                      BLOCK ) \
+    RIGDEF_KEYWORD( ROTATORS2,                    "rotators2",                     BLOCK ) \
+    RIGDEF_KEYWORD( SCREWPROPS,                   "screwprops",                    BLOCK ) \
+    RIGDEF_KEYWORD( SCRIPTS,                      "scripts",                       BLOCK ) \
+    RIGDEF_KEYWORD( SECTION,                      "section",                       INLINE ) \
+    RIGDEF_KEYWORD( SECTIONCONFIG,                "sectionconfig",                 INLINE ) \
+    RIGDEF_KEYWORD( SET_BEAM_DEFAULTS,            "set_beam_defaults",             INLINE ) \
+    RIGDEF_KEYWORD( SET_BEAM_DEFAULTS_SCALE,      "set_beam_defaults_scale",       INLINE ) \
+    RIGDEF_KEYWORD( SET_COLLISION_RANGE,          "set_collision_range",           INLINE ) \
+    RIGDEF_KEYWORD( SET_DEFAULT_MINIMASS,         "set_default_minimass",          INLINE ) \
+    RIGDEF_KEYWORD( SET_INERTIA_DEFAULTS,         "set_inertia_defaults",          INLINE ) \
+    RIGDEF_KEYWORD( SET_MANAGEDMATERIALS_OPTIONS, "set_managedmaterials_options",  INLINE ) \
+    RIGDEF_KEYWORD( SET_NODE_DEFAULTS,            "set_node_defaults",             INLINE ) \
+    RIGDEF_KEYWORD( SET_SHADOWS,                  "set_shadows",                   BLOCK ) \
+    RIGDEF_KEYWORD( SET_SKELETON_SETTINGS,        "set_skeleton_settings",         INLINE ) \
+    RIGDEF_KEYWORD( SHOCKS,                       "shocks",                        BLOCK ) \
+    RIGDEF_KEYWORD( SHOCKS2,                      "shocks2",                       BLOCK ) \
+    RIGDEF_KEYWORD( SHOCKS3,                      "shocks3",                       BLOCK ) \
+    RIGDEF_KEYWORD( SLIDENODE_CONNECT_INSTANTLY,  "slidenode_connect_instantly",   BLOCK ) \
+    RIGDEF_KEYWORD( SLIDENODES,                   "slidenodes",                    BLOCK ) \
+    RIGDEF_KEYWORD( SLOPE_BRAKE,                  "SlopeBrake",                    INLINE ) \
+    RIGDEF_KEYWORD( SOUNDSOURCES,                 "soundsources",                  BLOCK ) \
+    RIGDEF_KEYWORD( SOUNDSOURCES2,                "soundsources2",                 BLOCK ) \
+    RIGDEF_KEYWORD( SPEEDLIMITER,                 "speedlimiter",                  INLINE ) \
+    RIGDEF_KEYWORD( SUBMESH,                      "submesh",                       BLOCK ) \
+    RIGDEF_KEYWORD( SUBMESH_GROUNDMODEL,          "submesh_groundmodel",           INLINE ) \
+    RIGDEF_KEYWORD( TEXCOORDS,                    "texcoords",                     BLOCK ) \
+    RIGDEF_KEYWORD( TIES,                         "ties",                          BLOCK ) \
+    RIGDEF_KEYWORD( TORQUECURVE,                  "torquecurve",                   BLOCK ) \
+    RIGDEF_KEYWORD( TRACTIONCONTROL,              "TractionControl",               INLINE ) \
+    RIGDEF_KEYWORD( TRANSFERCASE,                 "transfercase",                  BLOCK ) \
+    RIGDEF_KEYWORD( TRIGGERS,                     "triggers",                      BLOCK ) \
+    RIGDEF_KEYWORD( TURBOJETS,                    "turbojets",                     BLOCK ) \
+    RIGDEF_KEYWORD( TURBOPROPS,                   "turboprops",                    BLOCK ) \
+    RIGDEF_KEYWORD( TURBOPROPS2,                  "turboprops2",                   BLOCK ) \
+    RIGDEF_KEYWORD( VIDEOCAMERA,                  "videocamera",                   BLOCK ) \
+    RIGDEF_KEYWORD( WHEELDETACHERS,               "wheeldetachers",                BLOCK ) \
+    RIGDEF_KEYWORD( WHEELS,                       "wheels",                        BLOCK ) \
+    RIGDEF_KEYWORD( WHEELS2,                      "wheels2",                       BLOCK ) \
+    RIGDEF_KEYWORD( WINGS,                        "wings",                         BLOCK )
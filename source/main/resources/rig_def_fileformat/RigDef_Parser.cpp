@@ -32,7 +32,7 @@
 #include "CacheSystem.h"
 #include "Console.h"
 #include "RigDef_File.h"
-#include "RigDef_Regexes.h"
+#include "RigDef_Keywords.h"
 #include "Utils.h"
 
 #include <OgreException.h>
@@ -41,6 +41,8 @@
 #include <OgreStringConverter.h>
 
 #include <algorithm>
+#include <cctype>
+#include <cstring>
 
 using namespace RoR;
 
@@ -67,6 +69,170 @@ inline bool StrEqualsNocase(std::string const & s1, std::string const & s2)
     return true;
 }
 
+// --------------------------------------------------------------------------
+// Keyword lexer
+// --------------------------------------------------------------------------
+
+enum class KeywordSyntax
+{
+    BLOCK,
+    INLINE,
+    INLINE_UNSEPARATED
+};
+
+inline bool IsDigit(char c)
+{
+    return (c >= '0') && (c <= '9');
+}
+
+inline bool IsKeywordChar(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || IsDigit(c) || (c == '_');
+}
+
+inline bool IsLineTerminator(char c)
+{
+    return (c == '\n') || (c == '\r');
+}
+
+constexpr char ToLowerAscii(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+/// Case-insensitive FNV-1a; evaluated at compile time for the keyword table,
+/// so a collision between 2 keywords is a compile error (duplicate case label).
+constexpr uint32_t HashKeyword(const char* str, uint32_t hash = 2166136261u)
+{
+    return (*str == '\0')
+        ? hash
+        : HashKeyword(str + 1, (hash ^ static_cast<uint8_t>(ToLowerAscii(*str))) * 16777619u);
+}
+
+/// Checks what follows a keyword; equivalent to the former regex `[[:blank:]]*$`, `[[:blank:],:|]+.*$` and `.*$` respectively.
+bool CheckKeywordSyntax(const std::string& line, size_t keyword_len, KeywordSyntax syntax)
+{
+    switch (syntax)
+    {
+    case KeywordSyntax::BLOCK:
+        for (size_t i = keyword_len; i < line.size(); i++)
+        {
+            if (!IsWhitespace(line[i])) { return false; }
+        }
+        return true;
+
+    case KeywordSyntax::INLINE:
+        if (keyword_len >= line.size() || !IsSeparator(line[keyword_len])) { return false; }
+        // fall through
+
+    case KeywordSyntax::INLINE_UNSEPARATED:
+        return std::find_if(line.begin() + keyword_len, line.end(), IsLineTerminator) == line.end();
+    }
+    return false;
+}
+
+bool StartsWithNocase(const std::string& line, const char* prefix)
+{
+    size_t i = 0;
+    for (; prefix[i] != '\0'; i++)
+    {
+        if (i >= line.size() || ToLowerAscii(line[i]) != ToLowerAscii(prefix[i])) { return false; }
+    }
+    return true;
+}
+
+// --------------------------------------------------------------------------
+// Argument lexers (formerly regexes)
+// --------------------------------------------------------------------------
+
+inline bool IsNodeIdChar(char c)
+{
+    return IsKeywordChar(c) || (c == '-');
+}
+
+inline size_t SkipWhitespace(const std::string& str, size_t pos)
+{
+    while (pos < str.size() && IsWhitespace(str[pos])) { pos++; }
+    return pos;
+}
+
+/// One comma-separated property of 'axles'/'interaxles': `[w1(node node)] [d(olsv)] [;comment | //comment]`, blanks allowed between.
+struct AxleProperty
+{
+    char        ap_wheel_digit = '\0'; //!< '1' or '2'; '\0' if the wheel part is not present.
+    std::string ap_wheel_nodes[2];
+    bool        ap_has_diff = false;
+    std::string ap_diff_types;
+};
+
+/// @return false if the token is malformed.
+bool LexAxleProperty(const std::string& token, AxleProperty& out)
+{
+    size_t pos = SkipWhitespace(token, 0);
+
+    if (pos < token.size() && token[pos] == 'w')
+    {
+        pos++;
+        if (pos >= token.size() || (token[pos] != '1' && token[pos] != '2')) { return false; }
+        out.ap_wheel_digit = token[pos++];
+        if (pos >= token.size() || token[pos++] != '(') { return false; }
+        for (int i = 0; i < 2; i++)
+        {
+            const size_t start = pos;
+            while (pos < token.size() && IsNodeIdChar(token[pos])) { pos++; }
+            if (pos == start) { return false; }
+            out.ap_wheel_nodes[i] = token.substr(start, pos - start);
+            if (i == 0)
+            {
+                if (pos >= token.size() || !IsWhitespace(token[pos])) { return false; }
+                pos = SkipWhitespace(token, pos);
+            }
+        }
+        if (pos >= token.size() || token[pos++] != ')') { return false; }
+        pos = SkipWhitespace(token, pos);
+    }
+
+    if (pos < token.size() && token[pos] == 'd')
+    {
+        pos++;
+        if (pos >= token.size() || token[pos++] != '(') { return false; }
+        const size_t start = pos;
+        while (pos < token.size() && (token[pos] == 'o' || token[pos] == 'l' || token[pos] == 's' || token[pos] == 'v')) { pos++; }
+        if (pos >= token.size() || token[pos] != ')') { return false; }
+        out.ap_has_diff = true;
+        out.ap_diff_types = token.substr(start, pos - start);
+        pos = SkipWhitespace(token, pos + 1);
+    }
+
+    // Trailing comment
+    if (pos < token.size() && (token[pos] == ';' || token.compare(pos, 2, "//") == 0))
+    {
+        return std::find_if(token.begin() + pos, token.end(), IsLineTerminator) == token.end();
+    }
+    return pos == token.size();
+}
+
+/// Animator option like `throttle1`: `[[:blank:]]*(throttle|rpm|aerotorq|aeropit|aerostatus)([[:digit:]])[[:blank:]]*`
+/// @return Length of the keyword, or 0 if not matched.
+size_t LexAnimatorNumberedKeyword(const std::string& token, size_t& out_digit_pos)
+{
+    static const char* const KEYWORDS[] = { "throttle", "rpm", "aerotorq", "aeropit", "aerostatus" };
+
+    const size_t start = SkipWhitespace(token, 0);
+    for (const char* keyword: KEYWORDS)
+    {
+        const size_t len = std::strlen(keyword);
+        if (token.compare(start, len, keyword) == 0
+            && start + len < token.size() && IsDigit(token[start + len])
+            && SkipWhitespace(token, start + len + 1) == token.size())
+        {
+            out_digit_pos = start + len;
+            return len;
+        }
+    }
+    return 0;
+}
+
 Parser::Parser()
 {
     // Push defaults 
@@ -952,31 +1118,45 @@ void Parser::ParseDirectiveForvert()
         return;
     }
 
+    // Scan for numbers `N` or ranges `N-M` (whitespace allowed around the dash), anything else is skipped.
     std::string input = input_pos;
-    std::regex pattern(R"((\d+)\s*-\s*(\d+)|(\d+))");
-    std::smatch matches;
+    auto scan_digits = [&input](size_t pos) { while (pos < input.size() && IsDigit(input[pos])) { pos++; } return pos; };
+    auto skip_space = [&input](size_t pos) { while (pos < input.size() && std::isspace(static_cast<unsigned char>(input[pos]))) { pos++; } return pos; };
 
-    std::string::const_iterator searchStart(input.cbegin());
-    while (std::regex_search(searchStart, input.cend(), matches, pattern))
+    size_t pos = 0;
+    while (pos < input.size())
     {
-        if (matches[1].matched && matches[2].matched)
+        if (!IsDigit(input[pos]))
         {
-            // Range found - unroll it into the `Forvert` array.
-            int start = std::stoi(matches[1].str());
-            int end = std::stoi(matches[2].str());
-            for (int i = start; i <= end; ++i)
-            {
-                forvert.vert_index = i; // Update the temp object
-                m_current_module->flexbodies.back().forvert.push_back(forvert); // Copy the temp object
-            }
+            pos++;
+            continue;
         }
-        else if (matches[3].matched)
+
+        const size_t first_end = scan_digits(pos);
+        size_t dash = skip_space(first_end);
+        if (dash < input.size() && input[dash] == '-')
         {
-            // Single number found
-            forvert.vert_index = std::stoi(matches[3].str()); // Update the temp object
-            m_current_module->flexbodies.back().forvert.push_back(forvert); // Copy the temp object
+            const size_t second_start = skip_space(dash + 1);
+            const size_t second_end = scan_digits(second_start);
+            if (second_end > second_start)
+            {
+                // Range found - unroll it into the `Forvert` array.
+                int start = std::stoi(input.substr(pos, first_end - pos));
+                int end = std::stoi(input.substr(second_start, second_end - second_start));
+                for (int i = start; i <= end; ++i)
+                {
+                    forvert.vert_index = i; // Update the temp object
+                    m_current_module->flexbodies.back().forvert.push_back(forvert); // Copy the temp object
+                }
+                pos = second_end;
+                continue;
+            }
         }
-        searchStart = matches.suffix().first;
+
+        // Single number found
+        forvert.vert_index = std::stoi(input.substr(pos, first_end - pos)); // Update the temp object
+        m_current_module->flexbodies.back().forvert.push_back(forvert); // Copy the temp object
+        pos = first_end;
     }
 }
 
@@ -1702,23 +1882,22 @@ void Parser::ParseAxles()
     Ogre::StringVector::iterator iter = tokens.begin();
     for ( ; iter != tokens.end(); iter++)
     {
-        std::smatch results;
-        if (! std::regex_search(*iter, results, Regexes::SECTION_AXLES_PROPERTY))
+        AxleProperty property;
+        if (! LexAxleProperty(*iter, property))
         {
             this->LogMessage(Console::CONSOLE_SYSTEM_ERROR, "Invalid property, ignoring whole line...");
             return;
         }
-        // NOTE: Positions in 'results' array match E_CAPTURE*() positions (starting with 1) in the respective regex. 
 
-        if (results[1].matched)
+        if (property.ap_wheel_digit != '\0')
         {
-            unsigned int wheel_index = PARSEINT(results[2]) - 1;
-            axle.wheels[wheel_index][0] = _ParseNodeRef(results[3]);
-            axle.wheels[wheel_index][1] = _ParseNodeRef(results[4]);
+            unsigned int wheel_index = (property.ap_wheel_digit - '0') - 1;
+            axle.wheels[wheel_index][0] = _ParseNodeRef(property.ap_wheel_nodes[0]);
+            axle.wheels[wheel_index][1] = _ParseNodeRef(property.ap_wheel_nodes[1]);
         }
-        else if (results[5].matched)
+        else if (property.ap_has_diff)
         {
-            this->_ParseDifferentialTypes(axle.options, results[6].str());
+            this->_ParseDifferentialTypes(axle.options, property.ap_diff_types);
         }
     }
 
@@ -1736,17 +1915,16 @@ void Parser::ParseInterAxles()
     interaxle.a1 = this->ParseArgInt(args[0].c_str()) - 1;
     interaxle.a2 = this->ParseArgInt(args[1].c_str()) - 1;
 
-    std::smatch results;
-    if (! std::regex_search(args[2], results, Regexes::SECTION_AXLES_PROPERTY))
+    AxleProperty property;
+    if (! LexAxleProperty(args[2], property))
     {
         this->LogMessage(Console::CONSOLE_SYSTEM_ERROR, "Invalid property, ignoring whole line...");
         return;
     }
-    // NOTE: Positions in 'results' array match E_CAPTURE*() positions (starting with 1) in the respective regex. 
 
-    if (results[5].matched)
+    if (property.ap_has_diff)
     {
-        this->_ParseDifferentialTypes(interaxle.options, results[6].str());
+        this->_ParseDifferentialTypes(interaxle.options, property.ap_diff_types);
     }
 
     m_current_module->interaxles.push_back(interaxle);
@@ -2769,19 +2947,21 @@ void Parser::ParseAnimator()
     {
         Ogre::String token = *itor;
         Ogre::StringUtil::trim(token);
-        std::smatch results;
+        size_t digit_pos = 0;
+        const size_t numbered_keyword_len = LexAnimatorNumberedKeyword(token, digit_pos);
         bool is_shortlimit = false;
 
         // Numbered keywords 
-        if (std::regex_search(token, results, Regexes::PARSE_ANIMATORS_NUMBERED_KEYWORD))
+        if (numbered_keyword_len > 0)
         {
-                 if (results[1] == "throttle")   animator.aero_animator.flags |= AeroAnimator::OPTION_THROTTLE;
-            else if (results[1] == "rpm")        animator.aero_animator.flags |= AeroAnimator::OPTION_RPM;
-            else if (results[1] == "aerotorq")   animator.aero_animator.flags |= AeroAnimator::OPTION_TORQUE;
-            else if (results[1] == "aeropit")    animator.aero_animator.flags |= AeroAnimator::OPTION_PITCH;
-            else if (results[1] == "aerostatus") animator.aero_animator.flags |= AeroAnimator::OPTION_STATUS;
-
-            animator.aero_animator.engine_idx = this->ParseArgUint(results[2].str().c_str()) - 1;
+            const std::string keyword = token.substr(digit_pos - numbered_keyword_len, numbered_keyword_len);
+                 if (keyword == "throttle")   animator.aero_animator.flags |= AeroAnimator::OPTION_THROTTLE;
+            else if (keyword == "rpm")        animator.aero_animator.flags |= AeroAnimator::OPTION_RPM;
+            else if (keyword == "aerotorq")   animator.aero_animator.flags |= AeroAnimator::OPTION_TORQUE;
+            else if (keyword == "aeropit")    animator.aero_animator.flags |= AeroAnimator::OPTION_PITCH;
+            else if (keyword == "aerostatus") animator.aero_animator.flags |= AeroAnimator::OPTION_STATUS;
+
+            animator.aero_animator.engine_idx = this->ParseArgUint(token.substr(digit_pos, 1).c_str()) - 1;
         }
         else if ((is_shortlimit = (token.compare(0, 10, "shortlimit") == 0)) || (token.compare(0, 9, "longlimit") == 0))
         {
@@ -2867,20 +3047,41 @@ void Parser::LogMessage(Console::MessageType type, std::string const& msg)
 
 Keyword Parser::IdentifyKeyword(const std::string& line)
 {
-    // Search and ignore lettercase
-    std::smatch results;
-    std::regex_search(line, results, Regexes::IDENTIFY_KEYWORD_IGNORE_CASE); // Always returns true.
+    // All keywords consist of [a-zA-Z0-9_] and must be followed by a non-keyword character,
+    // so the leading word of the line is the only candidate - look it up by hash, ignoring lettercase.
+    uint32_t hash = 2166136261u;
+    size_t word_len = 0;
+    for (; word_len < line.size() && IsKeywordChar(line[word_len]); word_len++)
+    {
+        hash = (hash ^ static_cast<uint8_t>(ToLowerAscii(line[word_len]))) * 16777619u;
+    }
+    if (word_len == 0)
+    {
+        return Keyword::INVALID;
+    }
 
-    // The 'results' array contains a complete match at positon [0] and sub-matches starting with [1], 
-    //    so we get exact positions in Regexes::IDENTIFY_KEYWORD, which again match Keyword enum members
-    for (unsigned int i = 1; i < results.size(); i++)
+    switch (hash)
     {
-        std::ssub_match sub  = results[i];
-        if (sub.matched)
-        {
-            // Build enum value directly from result offset
-            return Keyword(i);
-        }
+#define RIGDEF_KEYWORD(_ENUM_, _NAME_, _SYNTAX_)                                                         \
+    case HashKeyword(_NAME_):                                                                            \
+        if (word_len == sizeof(_NAME_) - 1 && StartsWithNocase(line, _NAME_)                             \
+            && CheckKeywordSyntax(line, word_len, KeywordSyntax::_SYNTAX_))                              \
+        {                                                                                                \
+            return Keyword::_ENUM_;                                                                      \
+        }                                                                                                \
+        break;
+
+    RIGDEF_KEYWORD_LIST
+
+#undef RIGDEF_KEYWORD
+    default:
+        break;
+    }
+
+    // BEWARE OF QUIRKS: 'forset' doesn't require a separator, the leading word may include arguments.
+    if (StartsWithNocase(line, "forset") && CheckKeywordSyntax(line, 6, KeywordSyntax::INLINE_UNSEPARATED))
+    {
+        return Keyword::FORSET;
     }
 
     return Keyword::INVALID;
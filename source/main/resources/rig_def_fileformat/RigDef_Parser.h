@@ -33,7 +33,6 @@
 
 #include <memory>
 #include <string>
-#include <regex>
 
 namespace RigDef
 {
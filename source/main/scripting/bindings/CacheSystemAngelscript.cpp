@@ -158,5 +158,6 @@ void RoR::RegisterCacheSystem(asIScriptEngine *engine)
     result = engine->RegisterObjectMethod("CacheSystemClass", "CacheEntryClassPtr @findEntryByFilename(LoaderType, bool, const string &in)", asMETHOD(CacheSystem,FindEntryByFilename), asCALL_THISCALL); ROR_ASSERT(result>=0);
     result = engine->RegisterObjectMethod("CacheSystemClass", "CacheEntryClassPtr @getEntryByNumber(int)", asMETHOD(CacheSystem,GetEntryByNumber), asCALL_THISCALL); ROR_ASSERT(result>=0);
     result = engine->RegisterObjectMethod("CacheSystemClass", "dictionary@ query(dictionary@)", asFUNCTION(CacheSystemQueryWrapper), asCALL_CDECL_OBJFIRST); ROR_ASSERT(result>=0);
+    result = engine->RegisterObjectMethod("CacheSystemClass", "Ogre::TexturePtr fetchThumbnail(CacheEntryClassPtr @)", asFUNCTIONPR([](CacheSystem* self, CacheEntryPtr entry) -> Ogre::TexturePtr {return (entry) ? self->FetchThumbnail(entry) : Ogre::TexturePtr();}, (CacheSystem*, CacheEntryPtr), Ogre::TexturePtr), asCALL_CDECL_OBJFIRST); ROR_ASSERT(result>=0);
 
 }
@@ -39,6 +39,7 @@ void Console::cVarSetupBuiltins()
     App::app_extra_mod_path      = this->cVarCreate("app_extra_mod_path",      "Extra mod path",             CVAR_ARCHIVE);
     App::app_force_cache_purge   = this->cVarCreate("app_force_cache_purge",   "",                           CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "false");
     App::app_force_cache_update  = this->cVarCreate("app_force_cache_update",  "",                           CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "false");
+    App::app_watch_mod_dirs      = this->cVarCreate("app_watch_mod_dirs",      "Watch mod directories",      CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "true");
     App::app_disable_online_api  = this->cVarCreate("app_disable_online_api",  "Disable Online API",         CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "false");
     App::app_config_long_names   = this->cVarCreate("app_config_long_names",   "Config uses long names",     CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "true");
     App::app_custom_scripts      = this->cVarCreate("app_custom_scripts",      "",                           CVAR_ARCHIVE,                     "");
@@ -108,6 +109,7 @@ void Console::cVarSetupBuiltins()
     App::diag_load_devel_scripts = this->cVarCreate("diag_load_devel_scripts", "",                           CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "false");
     App::diag_profiler_enabled   = this->cVarCreate("diag_profiler_enabled",   "",                           CVAR_TYPE_BOOL,                   "false");
     App::diag_profiler_rate      = this->cVarCreate("diag_profiler_rate",      "",                           CVAR_ARCHIVE | CVAR_TYPE_INT,     "10");
+    App::diag_truckc_verify      = this->cVarCreate("diag_truckc_verify",      "",                           CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "false");
 
     App::sys_process_dir         = this->cVarCreate("sys_process_dir",         "",                           0);
     App::sys_user_dir            = this->cVarCreate("sys_user_dir",            "",                           0);
@@ -203,6 +205,7 @@ void Console::cVarSetupBuiltins()
     App::gfx_fps_limit           = this->cVarCreate("gfx_fps_limit",           "FPS-Limiter",                CVAR_ARCHIVE | CVAR_TYPE_INT,     "0");
     App::gfx_speedo_imperial     = this->cVarCreate("gfx_speedo_imperial",     "gfx_speedo_imperial",        CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "false");
     App::gfx_flexbody_cache      = this->cVarCreate("gfx_flexbody_cache",      "Flexbody_UseCache",          CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "false");
+    App::gfx_flexbody_lod        = this->cVarCreate("gfx_flexbody_lod",        "Flexbody update LOD",        CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "true");
     App::gfx_reduce_shadows      = this->cVarCreate("gfx_reduce_shadows",      "Shadow optimizations",       CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "true");
     App::gfx_enable_rtshaders    = this->cVarCreate("gfx_enable_rtshaders",    "Use RTShader System",        CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "false");
     App::gfx_alt_actor_materials = this->cVarCreate("gfx_alt_actor_materials", "Use alternate vehicle materials", CVAR_ARCHIVE | CVAR_TYPE_BOOL, "false");
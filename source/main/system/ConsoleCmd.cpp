@@ -32,14 +32,17 @@
 #include "Language.h"
 #include "Network.h"
 #include "OverlayWrapper.h"
+#include "PlatformUtils.h"
 #include "RoRnet.h"
 #include "RoRVersion.h"
 #include "ScriptEngine.h"
 #include "Terrain.h"
 #include "TerrainObjectManager.h"
+#include "TraceRecorder.h"
 #include "Utils.h"
 
 #include <algorithm>
+#include <fstream>
 #include <Ogre.h>
 #include <fmt/core.h>
 
@@ -669,6 +672,107 @@ public:
     }
 };
 
+class PhysprofCmd: public ConsoleCmd
+{
+public:
+    PhysprofCmd(): ConsoleCmd("physprof", "<on/off/reset/csv> [<filename>]", _L("Per-actor physics profiler; 'csv' writes totals to the logs directory")) {}
+
+    void Run(Ogre::StringVector const& args) override
+    {
+        Str<500> reply;
+        reply << m_name << ": ";
+        Console::MessageType reply_type = Console::CONSOLE_SYSTEM_REPLY;
+        PhysicsProfiler& profiler = App::GetGameContext()->GetActorManager()->GetPhysicsProfiler();
+
+        if (args.size() < 2)
+        {
+            reply_type = Console::CONSOLE_HELP;
+            reply << m_usage;
+        }
+        else if (args[1] == "on" || args[1] == "off")
+        {
+            PhysicsProfiler::SetEnabled(args[1] == "on");
+            reply << (PhysicsProfiler::IsEnabled() ? _L("enabled") : _L("disabled"));
+        }
+        else if (args[1] == "reset")
+        {
+            profiler.Reset();
+            reply << _L("reset");
+        }
+        else if (args[1] == "csv")
+        {
+            const std::string filename = (args.size() > 2) ? args[2] : "physics_profile.csv";
+            const std::string path = PathCombine(App::sys_logs_dir->getStr(), filename);
+            std::ofstream file(path);
+            if (file.is_open())
+            {
+                profiler.WriteCsv(file);
+                reply << _L("written to ") << path;
+            }
+            else
+            {
+                reply_type = Console::CONSOLE_SYSTEM_ERROR;
+                reply << _L("cannot open file ") << path;
+            }
+        }
+        else
+        {
+            reply_type = Console::CONSOLE_SYSTEM_ERROR;
+            reply << _L("unknown argument: ") << args[1];
+        }
+
+        App::GetConsole()->putMessage(Console::CONSOLE_MSGTYPE_INFO, reply_type, reply.ToCStr());
+    }
+};
+
+class TraceCmd: public ConsoleCmd
+{
+public:
+    TraceCmd(): ConsoleCmd("trace", "<on/off/dump> [<seconds>] [<filename>]", _L("Records a timeline of all threads; 'dump' writes Chrome trace JSON (chrome://tracing, Perfetto) to the logs directory")) {}
+
+    void Run(Ogre::StringVector const& args) override
+    {
+        Str<500> reply;
+        reply << m_name << ": ";
+        Console::MessageType reply_type = Console::CONSOLE_SYSTEM_REPLY;
+
+        if (args.size() < 2)
+        {
+            reply_type = Console::CONSOLE_HELP;
+            reply << m_usage;
+        }
+        else if (args[1] == "on" || args[1] == "off")
+        {
+            TraceRecorder::SetEnabled(args[1] == "on");
+            reply << (TraceRecorder::IsEnabled() ? _L("recording") : _L("stopped"));
+        }
+        else if (args[1] == "dump")
+        {
+            const float seconds = (args.size() > 2) ? Ogre::StringConverter::parseReal(args[2], 10.f) : 10.f;
+            const std::string filename = (args.size() > 3) ? args[3] : "trace.json";
+            const std::string path = PathCombine(App::sys_logs_dir->getStr(), filename);
+            std::ofstream file(path);
+            if (file.is_open())
+            {
+                TraceRecorder::WriteChromeTrace(file, seconds);
+                reply << _L("written to ") << path;
+            }
+            else
+            {
+                reply_type = Console::CONSOLE_SYSTEM_ERROR;
+                reply << _L("cannot open file ") << path;
+            }
+        }
+        else
+        {
+            reply_type = Console::CONSOLE_SYSTEM_ERROR;
+            reply << _L("unknown argument: ") << args[1];
+        }
+
+        App::GetConsole()->putMessage(Console::CONSOLE_MSGTYPE_INFO, reply_type, reply.ToCStr());
+    }
+};
+
 /// @} // addtogroup ConsoleCmd
 
 // -------------------------------------------------------------------------------------
@@ -694,6 +798,8 @@ void Console::regBuiltinCommands()
     cmd = new ClearCmd();                 m_commands.insert(std::make_pair(cmd->getName(), cmd));
     cmd = new LoadScriptCmd();            m_commands.insert(std::make_pair(cmd->getName(), cmd));
     cmd = new SpeedOfSoundCmd();          m_commands.insert(std::make_pair(cmd->getName(), cmd));
+    cmd = new PhysprofCmd();              m_commands.insert(std::make_pair(cmd->getName(), cmd));
+    cmd = new TraceCmd();                 m_commands.insert(std::make_pair(cmd->getName(), cmd));
     // CVars
     cmd = new SetCmd();                   m_commands.insert(std::make_pair(cmd->getName(), cmd));
     cmd = new SetstringCmd();             m_commands.insert(std::make_pair(cmd->getName(), cmd));
@@ -20,7 +20,9 @@ along with Rigs of Rods.  If not, see <http://www.gnu.org/licenses/>.
 #pragma once
 
 #include "Application.h"
+#include "TraceRecorder.h"
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <functional>
@@ -66,6 +68,14 @@ class Task
         m_finish_cv.wait(lock, [this]{ return m_is_finished; });
     }
 
+    /// Check whether the task has finished, without blocking.
+    bool is_finished() const
+    {
+        // task_mutex is locked while the task is running - don't wait for it.
+        std::unique_lock<std::mutex> lock(m_task_mutex, std::try_to_lock);
+        return lock.owns_lock() && m_is_finished;
+    }
+
     private:
     // Only constructable by friend class ThreadPool
     Task(std::function<void()> task_func) : m_task_func(task_func) {}
@@ -78,6 +88,39 @@ class Task
     const std::function<void()> m_task_func;      //!< Callable object which implements the task to execute.
 };
 
+/** \brief Reusable descriptor for ThreadPool::ParallelFor()
+ *
+ * Owns the helper Task objects and the work counter, so that running a batch of items
+ * repeatedly (i.e. every physics substep) doesn't allocate. Each caller which may run
+ * concurrently with others needs its own instance; one instance must not be used by 2 threads at once.
+ *
+ * \see ThreadPool::ParallelFor()
+ */
+class TaskBatch
+{
+    friend class ThreadPool;
+    public:
+    TaskBatch() {}
+    TaskBatch(TaskBatch &) = delete;
+    TaskBatch & operator=(TaskBatch &) = delete;
+
+    private:
+    /// Claims and runs items until none are left; executed by the caller and the helper tasks.
+    void RunItems()
+    {
+        for (int i = m_next_item.fetch_add(1); i < m_num_items; i = m_next_item.fetch_add(1))
+        {
+            m_invoke(m_context, i);
+        }
+    }
+
+    std::vector<std::shared_ptr<Task>> m_helpers;   //!< Created on first use, re-submitted by every ParallelFor() call.
+    std::atomic<int> m_next_item{0};                 //!< Next item to claim.
+    int m_num_items = 0;
+    void* m_context = nullptr;                       //!< The caller's functor (not copied - no allocation).
+    void (*m_invoke)(void*, int) = nullptr;
+};
+
 /** \brief Facilitates execution of (small) tasks on separate threads.
  *
  * Implements a "rent-a-thread" model where each submitted task is assigned to one of several worker threads managed by the thread pool instance.
@@ -135,6 +178,7 @@ public:
         // instance itself is destructed) which constantly checks the task queue, grabbing
         // and executing the frontmost task while the queue is not empty.
         auto thread_body = [this]{ 
+            TraceRecorder::SetThreadName("Worker");
             while (true) {
                 // Get next task from queue (synchronized access via taskqueue_mutex).
                 // If the queue is empty wait until either
@@ -210,6 +254,48 @@ public:
         for(const auto &h : handles) { h->join(); }
     }
 
+    /** \brief Run `func(int item)` for items [0, num_items) in parallel and wait until all have finished.
+     *
+     * Unlike Parallelize(), this doesn't create any Task objects or copy the functor after the first call
+     * with a given batch - the helper tasks are reset and re-submitted. Items are claimed dynamically,
+     * so uneven item costs balance out. The calling thread participates.
+     */
+    template <typename Func> void ParallelFor(TaskBatch& batch, int num_items, Func& func)
+    {
+        if (num_items <= 0) return;
+
+        batch.m_context = static_cast<void*>(&func);
+        batch.m_invoke = [](void* context, int item) { (*static_cast<Func*>(context))(item); };
+        batch.m_num_items = num_items;
+        batch.m_next_item = 0;
+
+        const int num_helpers = std::min(num_items - 1, static_cast<int>(m_threads.size()));
+        while (static_cast<int>(batch.m_helpers.size()) < num_helpers)
+        {
+            TaskBatch* batch_ptr = &batch;
+            batch.m_helpers.push_back(std::shared_ptr<Task>(new Task([batch_ptr]{ batch_ptr->RunItems(); })));
+        }
+
+        if (num_helpers > 0)
+        {
+            for (int i = 0; i < num_helpers; ++i)
+            {
+                // The helper finished its previous run (it was joined), so it can be re-armed.
+                std::lock_guard<std::mutex> task_lock(batch.m_helpers[i]->m_task_mutex);
+                batch.m_helpers[i]->m_is_finished = false;
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_taskqueue_mutex);
+                for (int i = 0; i < num_helpers; ++i) { m_taskqueue.push(batch.m_helpers[i]); }
+            }
+            m_task_available_cv.notify_all();
+        }
+
+        batch.RunItems();
+
+        for (int i = 0; i < num_helpers; ++i) { batch.m_helpers[i]->join(); }
+    }
+
     std::atomic_bool m_terminate{false};            //!< Indicates destruction of ThreadPool instance to worker threads
     std::vector<std::thread> m_threads;             //!< Collection of worker threads to run tasks
     std::queue<std::shared_ptr<Task>> m_taskqueue;  //!< Queue of submitted tasks pending for execution
@@ -0,0 +1,79 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "AllocationCounter.h"
+
+#ifdef USE_ALLOCATION_COUNTER
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+using namespace RoR;
+
+static thread_local bool   t_counting_active = false;
+static thread_local size_t t_num_allocations = 0;
+static std::atomic<size_t> g_num_allocations{0};
+
+AllocationCounter::Scope::Scope()
+    : m_prev_active(t_counting_active)
+{
+    t_counting_active = true;
+}
+
+AllocationCounter::Scope::~Scope()
+{
+    t_counting_active = m_prev_active;
+    if (!m_prev_active) // Outermost scope - publish.
+    {
+        g_num_allocations.fetch_add(t_num_allocations, std::memory_order_relaxed);
+        t_num_allocations = 0;
+    }
+}
+
+size_t AllocationCounter::GetTotal()
+{
+    return g_num_allocations.load(std::memory_order_relaxed);
+}
+
+// --------------------------------
+// Global allocation functions; the array and nothrow forms forward here by default.
+
+void* operator new(std::size_t size)
+{
+    if (t_counting_active)
+        t_num_allocations++;
+
+    void* ptr = std::malloc(size ? size : 1);
+    if (!ptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+#endif // USE_ALLOCATION_COUNTER
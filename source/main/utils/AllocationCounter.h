@@ -0,0 +1,72 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+/// @brief  Counts heap allocations made inside marked scopes (i.e. the physics hot path).
+
+#pragma once
+
+#include <cstddef>
+
+namespace RoR {
+
+/// @addtogroup Application
+/// @{
+
+/// Global `operator new` is replaced (see AllocationCounter.cpp) to count allocations
+/// made by a thread while it's inside an `AllocationCounter::Scope`. Outside scopes, the cost is a thread-local flag check.
+/// Only built with CMake option `ROR_USE_ALLOCATION_COUNTER`; otherwise scopes are no-ops and the count stays 0.
+namespace AllocationCounter {
+
+#ifdef USE_ALLOCATION_COUNTER
+
+/// Counts allocations made by the current thread during its lifetime; scopes may nest.
+class Scope
+{
+public:
+    Scope();
+    ~Scope(); //!< Adds the thread's count to the global total.
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+private:
+    bool m_prev_active;
+};
+
+size_t GetTotal(); //!< Allocations counted so far, by all threads (monotonic).
+
+#else // USE_ALLOCATION_COUNTER
+
+class Scope
+{
+public:
+    Scope() {}
+    ~Scope() {}
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+};
+
+inline size_t GetTotal() { return 0; }
+
+#endif // USE_ALLOCATION_COUNTER
+
+} // namespace AllocationCounter
+
+/// @} // addtogroup Application
+
+} // namespace RoR
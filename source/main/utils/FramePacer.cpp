@@ -0,0 +1,91 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "FramePacer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+using namespace RoR;
+
+// Out-of-line definitions - C++11 requires them since `std::min()`/`std::max()` take the constants by reference.
+constexpr float FramePacer::MIN_SPIN_TIME;
+constexpr float FramePacer::MAX_SPIN_TIME;
+
+void FramePacer::WaitUntil(Clock::time_point deadline)
+{
+    for (;;)
+    {
+        const Clock::time_point now = Clock::now();
+        const float remaining = std::chrono::duration<float>(deadline - now).count();
+        if (remaining <= m_spin_time)
+            break;
+
+        const float requested = remaining - m_spin_time;
+        std::this_thread::sleep_for(std::chrono::duration<float>(requested));
+        const float slept = std::chrono::duration<float>(Clock::now() - now).count();
+        this->CalibrateSleep(slept - requested);
+    }
+
+    while (Clock::now() < deadline)
+    {
+        std::this_thread::yield();
+    }
+}
+
+void FramePacer::CalibrateSleep(float overshoot)
+{
+    // Exponentially weighted mean and variance of the overshoot.
+    const float WEIGHT = 0.1f;
+    const float diff = overshoot - m_overshoot_mean;
+    m_overshoot_mean += WEIGHT * diff;
+    m_overshoot_variance = (1.f - WEIGHT) * (m_overshoot_variance + WEIGHT * diff * diff);
+
+    const float spin_time = m_overshoot_mean + 2.f * std::sqrt(m_overshoot_variance);
+    m_spin_time = std::min(std::max(spin_time, MIN_SPIN_TIME), MAX_SPIN_TIME);
+}
+
+void FramePacer::RecordFrameTime(float dt)
+{
+    if (m_frame_times.size() < NUM_FRAME_SAMPLES)
+    {
+        m_frame_times.push_back(dt);
+    }
+    else
+    {
+        m_frame_times[m_frame_times_next] = dt;
+    }
+    m_frame_times_next = (m_frame_times_next + 1) % NUM_FRAME_SAMPLES;
+}
+
+FramePacer::FrameTimeStats FramePacer::GetFrameTimeStats() const
+{
+    FrameTimeStats stats;
+    if (m_frame_times.empty())
+        return stats;
+
+    std::vector<float> sorted = m_frame_times;
+    std::sort(sorted.begin(), sorted.end());
+    const size_t last = sorted.size() - 1;
+    stats.fts_p50_ms = sorted[last / 2] * 1000.f;
+    stats.fts_p99_ms = sorted[(last * 99) / 100] * 1000.f;
+    stats.fts_jitter_ms = stats.fts_p99_ms - stats.fts_p50_ms;
+    return stats;
+}
@@ -0,0 +1,69 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+/// @brief  Frame rate limiter and frame time statistics.
+
+#pragma once
+
+#include <chrono>
+#include <vector>
+
+namespace RoR {
+
+/// @addtogroup Application
+/// @{
+
+/// Waits for the frame deadline by sleeping, and spins (yielding) only for the last stretch.
+/// The OS sleep overshoot is measured on every sleep and the spin window follows
+/// its mean + 2 deviations, so coarse timers (i.e. Windows' default 15.6ms tick) just mean more spinning.
+class FramePacer
+{
+public:
+    typedef std::chrono::high_resolution_clock Clock;
+
+    static constexpr float MIN_SPIN_TIME = 0.0002f; //!< Seconds; never trust the sleep closer than this.
+    static constexpr float MAX_SPIN_TIME = 0.02f;
+    static const size_t    NUM_FRAME_SAMPLES = 240;
+
+    struct FrameTimeStats
+    {
+        float fts_p50_ms = 0.f;
+        float fts_p99_ms = 0.f;
+        float fts_jitter_ms = 0.f; //!< p99 - p50
+    };
+
+    void           WaitUntil(Clock::time_point deadline);
+    void           RecordFrameTime(float dt);
+    FrameTimeStats GetFrameTimeStats() const;
+    float          GetSpinTime() const { return m_spin_time; }
+
+private:
+    void           CalibrateSleep(float overshoot);
+
+    float              m_overshoot_mean = 0.001f;
+    float              m_overshoot_variance = 0.f;
+    float              m_spin_time = 0.002f; //!< Calibrated; conservative until the first sleeps are measured.
+    std::vector<float> m_frame_times;        //!< Ring buffer, seconds.
+    size_t             m_frame_times_next = 0;
+};
+
+/// @} // addtogroup Application
+
+} // namespace RoR
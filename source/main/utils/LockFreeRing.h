@@ -0,0 +1,170 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+/// @brief  Bounded lock-free queue for passing data between threads without a mutex.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace RoR {
+
+/// Fixed-capacity ring buffer, safe for any number of producers and consumers (D. Vyukov's bounded queue).
+/// Each slot carries a sequence number which tells whether it's ready to be written or read,
+/// so producers only contend on a single atomic increment. Both operations fail instead of blocking
+/// when the ring is full/empty - callers are expected to have a fallback.
+/// @param CAPACITY Must be a power of 2.
+template <class T, size_t CAPACITY>
+class LockFreeRing
+{
+    static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0, "LockFreeRing capacity must be a power of 2");
+
+public:
+
+    LockFreeRing()
+    {
+        for (size_t i = 0; i < CAPACITY; i++)
+        {
+            m_slots[i].lfr_sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    LockFreeRing(const LockFreeRing&) = delete;
+    LockFreeRing& operator=(const LockFreeRing&) = delete;
+
+    /// @return false if the ring is full (value is left untouched).
+    bool TryPush(T& value)
+    {
+        Slot* slot = nullptr;
+        size_t pos = m_write_pos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            slot = &m_slots[pos & (CAPACITY - 1)];
+            const size_t seq = slot->lfr_sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0)
+            {
+                if (m_write_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+            {
+                return false; // Full
+            }
+            else
+            {
+                pos = m_write_pos.load(std::memory_order_relaxed);
+            }
+        }
+        slot->lfr_value = std::move(value);
+        slot->lfr_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @return false if the ring is empty.
+    bool TryPop(T& out_value)
+    {
+        Slot* slot = nullptr;
+        size_t pos = m_read_pos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            slot = &m_slots[pos & (CAPACITY - 1)];
+            const size_t seq = slot->lfr_sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0)
+            {
+                if (m_read_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+            {
+                return false; // Empty
+            }
+            else
+            {
+                pos = m_read_pos.load(std::memory_order_relaxed);
+            }
+        }
+        out_value = std::move(slot->lfr_value);
+        slot->lfr_value = T();
+        slot->lfr_sequence.store(pos + CAPACITY, std::memory_order_release);
+        return true;
+    }
+
+private:
+
+    struct Slot
+    {
+        std::atomic<size_t> lfr_sequence;
+        T                   lfr_value;
+    };
+
+    // Keep the hot counters on separate cache lines to avoid false sharing between producers and the consumer.
+    alignas(64) std::atomic<size_t> m_write_pos{0};
+    alignas(64) std::atomic<size_t> m_read_pos{0};
+    alignas(64) Slot                m_slots[CAPACITY];
+};
+
+/// Recycles heap-allocated objects through a `LockFreeRing`, so hot paths (i.e. physics workers)
+/// don't hit the allocator. Objects which don't fit the ring are simply deleted; `Acquire()` on an empty
+/// pool falls back to `new`. Released objects may originate from plain `new` - the pool adopts them.
+template <class T, size_t CAPACITY>
+class LockFreePool
+{
+public:
+
+    ~LockFreePool()
+    {
+        T* obj = nullptr;
+        while (m_free.TryPop(obj))
+        {
+            delete obj;
+        }
+    }
+
+    T* Acquire()
+    {
+        T* obj = nullptr;
+        if (m_free.TryPop(obj))
+            return obj;
+        return new T();
+    }
+
+    /// Resets the object to default state and returns it to the pool.
+    void Release(T* obj)
+    {
+        if (!obj)
+            return;
+        *obj = T();
+        if (!m_free.TryPush(obj))
+        {
+            delete obj;
+        }
+    }
+
+private:
+
+    LockFreeRing<T*, CAPACITY> m_free;
+};
+
+} // namespace RoR
@@ -33,6 +33,7 @@
     #include <shellapi.h> // ShellExecute()
 #else
     #include <sys/types.h>
+    #include <sys/resource.h> // setpriority()
     #include <sys/stat.h>
     #include <unistd.h> // readlink()
 #endif
@@ -154,6 +155,11 @@ void OpenUrlInDefaultBrowser(std::string const& url)
     ::ShellExecute(0, 0, url.c_str(), 0, 0 , SW_SHOW );
 }
 
+void LowerCurrentThreadPriority()
+{
+    ::SetThreadPriority(::GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+}
+
 #else
 
 // -------------------------- File/path utils for Linux/*nix --------------------------
@@ -202,6 +208,12 @@ void OpenUrlInDefaultBrowser(std::string const& url)
     ::system(buf.c_str());
 }
 
+void LowerCurrentThreadPriority()
+{
+    // On Linux, the nice value is per-thread (process ID 0 = the calling thread).
+    ::setpriority(PRIO_PROCESS, 0, 10);
+}
+
 #endif // _MSC_VER
 
 // -------------------------- File/path common utils --------------------------
@@ -55,6 +55,8 @@ std::time_t GetFileLastModifiedTime(std::string const & path);
 
 void OpenUrlInDefaultBrowser(std::string const& url);
 
+void LowerCurrentThreadPriority(); //!< For background workers which must not compete with the simulation.
+
 /// @} // addtogroup Application
 
 } // namespace RoR
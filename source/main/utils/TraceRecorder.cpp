@@ -0,0 +1,163 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TraceRecorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace RoR;
+
+namespace {
+
+struct TraceEvent
+{
+    const char* te_name = nullptr;
+    uint64_t    te_time_ns = 0;
+    char        te_phase = 0;
+};
+
+struct ThreadTraceBuffer
+{
+    int                      ttb_thread_id = 0;
+    std::string              ttb_thread_name; //!< Guarded by `g_buffers_mutex`.
+    std::vector<TraceEvent>  ttb_events = std::vector<TraceEvent>(TraceRecorder::EVENTS_PER_THREAD);
+    std::atomic<uint64_t>    ttb_num_written{0}; //!< Total events ever written; slot = count % capacity.
+};
+
+std::mutex                                       g_buffers_mutex;
+std::vector<std::unique_ptr<ThreadTraceBuffer>>  g_buffers; // Never shrinks - threads may be gone, their events stay.
+thread_local ThreadTraceBuffer*                  t_buffer = nullptr;
+thread_local const char*                         t_thread_name = nullptr; // Applied when the buffer is created.
+const std::chrono::steady_clock::time_point      g_epoch = std::chrono::steady_clock::now();
+
+uint64_t GetTimeNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - g_epoch).count());
+}
+
+ThreadTraceBuffer* GetThreadBuffer() // Allocates the ring on first use - only threads which actually record pay for it.
+{
+    if (!t_buffer)
+    {
+        std::lock_guard<std::mutex> lock(g_buffers_mutex);
+        g_buffers.push_back(std::unique_ptr<ThreadTraceBuffer>(new ThreadTraceBuffer()));
+        t_buffer = g_buffers.back().get();
+        t_buffer->ttb_thread_id = static_cast<int>(g_buffers.size());
+        t_buffer->ttb_thread_name = (t_thread_name) ? t_thread_name : "Thread " + std::to_string(t_buffer->ttb_thread_id);
+    }
+    return t_buffer;
+}
+
+void WriteJsonString(std::ostream& out, const char* str)
+{
+    out << '"';
+    for (const char* c = str; *c; ++c)
+    {
+        if (*c == '"' || *c == '\\')
+            out << '\\';
+        if (static_cast<unsigned char>(*c) >= 0x20)
+            out << *c;
+    }
+    out << '"';
+}
+
+} // namespace
+
+std::atomic<bool> TraceRecorder::s_enabled{false};
+
+void TraceRecorder::SetEnabled(bool val)
+{
+    s_enabled.store(val, std::memory_order_relaxed);
+}
+
+void TraceRecorder::Record(const char* name, char phase)
+{
+    ThreadTraceBuffer* buf = GetThreadBuffer();
+    const uint64_t index = buf->ttb_num_written.load(std::memory_order_relaxed);
+    TraceEvent& ev = buf->ttb_events[index & (EVENTS_PER_THREAD - 1)];
+    ev.te_name = name;
+    ev.te_time_ns = GetTimeNs();
+    ev.te_phase = phase;
+    buf->ttb_num_written.store(index + 1, std::memory_order_release);
+}
+
+void TraceRecorder::SetThreadName(const char* name)
+{
+    if (t_thread_name == name)
+        return;
+    t_thread_name = name;
+    if (t_buffer) // Otherwise the name is applied once the thread records something.
+    {
+        std::lock_guard<std::mutex> lock(g_buffers_mutex);
+        t_buffer->ttb_thread_name = name;
+    }
+}
+
+void TraceRecorder::WriteChromeTrace(std::ostream& out, float seconds)
+{
+    const uint64_t now_ns = GetTimeNs();
+    const uint64_t window_ns = static_cast<uint64_t>(std::max(seconds, 0.f) * 1e9);
+    const uint64_t min_time_ns = (seconds > 0.f && now_ns > window_ns) ? (now_ns - window_ns) : 0;
+
+    std::lock_guard<std::mutex> lock(g_buffers_mutex); // Blocks only thread registration/renaming.
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    std::vector<TraceEvent> events;
+    for (const std::unique_ptr<ThreadTraceBuffer>& buf : g_buffers)
+    {
+        // Thread name metadata
+        out << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buf->ttb_thread_id
+            << ",\"args\":{\"name\":";
+        WriteJsonString(out, buf->ttb_thread_name.c_str());
+        out << "}}";
+        first = false;
+
+        // Copy the live range, then drop whatever the owner thread overwrote meanwhile.
+        const uint64_t end = buf->ttb_num_written.load(std::memory_order_acquire);
+        const uint64_t begin = (end > EVENTS_PER_THREAD) ? (end - EVENTS_PER_THREAD) : 0;
+        events.clear();
+        for (uint64_t i = begin; i < end; i++)
+        {
+            events.push_back(buf->ttb_events[i & (EVENTS_PER_THREAD - 1)]);
+        }
+        // The slot of the event being written right now counts as overwritten too, hence the +1.
+        const uint64_t end_after = buf->ttb_num_written.load(std::memory_order_acquire);
+        const uint64_t first_valid = (end_after + 1 > EVENTS_PER_THREAD) ? (end_after + 1 - EVENTS_PER_THREAD) : 0;
+        const size_t skip = (first_valid > begin) ? static_cast<size_t>(std::min<uint64_t>(first_valid - begin, events.size())) : 0;
+
+        for (size_t i = skip; i < events.size(); i++)
+        {
+            const TraceEvent& ev = events[i];
+            if (ev.te_time_ns < min_time_ns || !ev.te_name)
+                continue;
+            out << ",\n{\"name\":";
+            WriteJsonString(out, ev.te_name);
+            out << ",\"ph\":\"" << ev.te_phase << "\",\"ts\":" << (ev.te_time_ns / 1000) << "." << ((ev.te_time_ns / 100) % 10)
+                << ",\"pid\":1,\"tid\":" << buf->ttb_thread_id << "}";
+        }
+    }
+    out << "\n]}\n";
+}
@@ -0,0 +1,86 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+/// @brief  Timeline of begin/end events from all threads, exported as Chrome trace JSON.
+
+#pragma once
+
+#include <OgreProfiler.h>
+
+#include <atomic>
+#include <ostream>
+
+namespace RoR {
+
+/// @addtogroup Application
+/// @{
+
+/// Records begin/end events into per-thread ring buffers (each written only by its owner thread,
+/// so recording takes no locks). `WriteChromeTrace()` merges them into a JSON file
+/// viewable in chrome://tracing or Perfetto. While disabled, recording costs one atomic load.
+/// Event names must be string literals (or otherwise outlive the recorder) - only the pointer is stored.
+class TraceRecorder
+{
+public:
+    static const size_t EVENTS_PER_THREAD = 1 << 17; //!< Must be power of 2.
+
+    static bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+    static void SetEnabled(bool val);
+
+    static void Begin(const char* name) { if (IsEnabled()) Record(name, 'B'); }
+    static void End(const char* name)   { if (IsEnabled()) Record(name, 'E'); }
+    static void SetThreadName(const char* name); //!< Shown as the track label; call from the thread itself.
+
+    /// Writes events from the last `seconds` (all buffered events if <= 0). Safe to call while threads record;
+    /// events overwritten during the copy are dropped.
+    static void WriteChromeTrace(std::ostream& out, float seconds);
+
+private:
+    static void Record(const char* name, char phase);
+
+    static std::atomic<bool> s_enabled;
+};
+
+/// Records begin/end of the enclosing scope.
+class TraceScope
+{
+public:
+    explicit TraceScope(const char* name): m_name(name) { TraceRecorder::Begin(m_name); }
+    ~TraceScope() { TraceRecorder::End(m_name); }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+private:
+    const char* m_name;
+};
+
+/// @} // addtogroup Application
+
+} // namespace RoR
+
+#define ROR_TRACE_CONCAT2(A, B) A##B
+#define ROR_TRACE_CONCAT(A, B) ROR_TRACE_CONCAT2(A, B)
+
+/// Trace-only scope (i.e. worker threads, where Ogre's profiler must not be used).
+#define ROR_TRACE_SCOPE(NAME)        RoR::TraceScope ROR_TRACE_CONCAT(_ror_trace_scope_, __LINE__)(NAME)
+
+/// Drop-in replacements for `OgreProfile*()` macros (main thread) which also feed the trace recorder.
+#define ROR_PROFILE(NAME)            OgreProfile(NAME); ROR_TRACE_SCOPE(NAME)
+#define ROR_PROFILE_BEGIN(NAME)      do { OgreProfileBegin(NAME); RoR::TraceRecorder::Begin(NAME); } while (false)
+#define ROR_PROFILE_END(NAME)        do { RoR::TraceRecorder::End(NAME); OgreProfileEnd(NAME); } while (false)
@@ -0,0 +1,79 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods Community
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+/// @brief  Wait-free hand-over of the latest value from one producer thread to one consumer thread.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace RoR {
+
+/// Three slots: the producer owns one, the consumer owns one, the third is "shared" and is swapped
+/// with either side by a single atomic exchange. Neither side ever waits; the consumer always gets
+/// the most recently published value and intermediate values are simply dropped.
+/// Exactly one producer thread and one consumer thread.
+template <class T>
+class TripleBuffer
+{
+public:
+
+    TripleBuffer() = default;
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // Producer
+
+    T&   GetWriteBuffer() { return m_slots[m_write_index]; }
+
+    /// Makes the write buffer available to the consumer and takes the shared slot for the next write.
+    void Publish()
+    {
+        const uint8_t prev = m_shared.exchange(m_write_index | FRESH_BIT, std::memory_order_acq_rel);
+        m_write_index = prev & INDEX_MASK;
+    }
+
+    // Consumer
+
+    /// @return false if nothing was published since the last call; the read buffer is left as-is.
+    bool AcquireLatest()
+    {
+        if ((m_shared.load(std::memory_order_relaxed) & FRESH_BIT) == 0)
+            return false;
+        const uint8_t prev = m_shared.exchange(m_read_index, std::memory_order_acq_rel);
+        m_read_index = prev & INDEX_MASK;
+        return true;
+    }
+
+    T&   GetReadBuffer() { return m_slots[m_read_index]; }
+
+private:
+
+    static const uint8_t INDEX_MASK = 0x3;
+    static const uint8_t FRESH_BIT = 0x4;
+
+    T                    m_slots[3];
+    uint8_t              m_write_index = 0;  //!< Producer only
+    std::atomic<uint8_t> m_shared{1};        //!< Slot index + `FRESH_BIT`
+    uint8_t              m_read_index = 2;   //!< Consumer only
+};
+
+} // namespace RoR
@@ -2,6 +2,7 @@
 #include "benchmark/benchmark.h"
 #include <regex>
 #include <iostream>
+#include <cstdint>
 
     enum Keyword
     {
@@ -1841,6 +1842,165 @@ static void Bench_sol2b_SwitchPreCond(benchmark::State& state)
 }
 BENCHMARK(Bench_sol2b_SwitchPreCond);
 
+// ################################# Solution 3 - hash of leading word + switch ######################################
+// Mirrors `RigDef::Parser::IdentifyKeyword()`: keywords are [a-zA-Z0-9_]+, so only the leading word can match;
+// its case-insensitive FNV-1a hash selects the candidate, a compile-time collision would be a duplicate case label.
+
+constexpr char ToLowerAscii(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+constexpr uint32_t HashKeyword(const char* str, uint32_t hash = 2166136261u)
+{
+    return (*str == '\0') ? hash : HashKeyword(str + 1, (hash ^ static_cast<uint8_t>(ToLowerAscii(*str))) * 16777619u);
+}
+
+inline bool IsKeywordChar(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || (c == '_');
+}
+
+// Compare the leading word (length known) with the keyword
+#define HASH_MATCH(_STR_, _KWORD_) \
+    case HashKeyword(_STR_): if (len == sizeof(_STR_) - 1 && strnicmp(line, _STR_, len) == 0) { return _KWORD_; } break;
+
+Keyword IdentifyKeywordHash(const char* line)
+{
+    uint32_t hash = 2166136261u;
+    size_t len = 0;
+    for (; IsKeywordChar(line[len]); len++)
+    {
+        hash = (hash ^ static_cast<uint8_t>(ToLowerAscii(line[len]))) * 16777619u;
+    }
+
+    switch (hash)
+    {
+        HASH_MATCH("add_animation",                KEYWORD_ADD_ANIMATION);
+        HASH_MATCH("airbrakes",                    KEYWORD_AIRBRAKES);
+        HASH_MATCH("animators",                    KEYWORD_ANIMATORS);
+        HASH_MATCH("AntiLockBrakes",               KEYWORD_ANTI_LOCK_BRAKES);
+        HASH_MATCH("axles",                        KEYWORD_AXLES);
+        HASH_MATCH("author",                       KEYWORD_AUTHOR);
+        HASH_MATCH("backmesh",                     KEYWORD_BACKMESH);
+        HASH_MATCH("beams",                        KEYWORD_BEAMS);
+        HASH_MATCH("brakes",                       KEYWORD_BRAKES);
+        HASH_MATCH("cab",                          KEYWORD_CAB);
+        HASH_MATCH("camerarail",                   KEYWORD_CAMERARAIL);
+        HASH_MATCH("cameras",                      KEYWORD_CAMERAS);
+        HASH_MATCH("cinecam",                      KEYWORD_CINECAM);
+        HASH_MATCH("collisionboxes",               KEYWORD_COLLISIONBOXES);
+        HASH_MATCH("commands",                     KEYWORD_COMMANDS);
+        HASH_MATCH("commands2",                    KEYWORD_COMMANDS2);
+        HASH_MATCH("contacters",                   KEYWORD_CONTACTERS);
+        HASH_MATCH("cruisecontrol",                KEYWORD_CRUISECONTROL);
+        HASH_MATCH("description",                  KEYWORD_DESCRIPTION);
+        HASH_MATCH("detacher_group",               KEYWORD_DETACHER_GROUP);
+        HASH_MATCH("disabledefaultsounds",         KEYWORD_DISABLEDEFAULTSOUNDS);
+        HASH_MATCH("enable_advanced_deformation",  KEYWORD_ENABLE_ADVANCED_DEFORMATION);
+        HASH_MATCH("end",                          KEYWORD_END);
+        HASH_MATCH("end_section",                  KEYWORD_END_SECTION);
+        HASH_MATCH("engine",                       KEYWORD_ENGINE);
+        HASH_MATCH("engoption",                    KEYWORD_ENGOPTION);
+        HASH_MATCH("engturbo",                     KEYWORD_ENGTURBO);
+        HASH_MATCH("envmap",                       KEYWORD_ENVMAP);
+        HASH_MATCH("exhausts",                     KEYWORD_EXHAUSTS);
+        HASH_MATCH("extcamera",                    KEYWORD_EXTCAMERA);
+        HASH_MATCH("fileformatversion",            KEYWORD_FILEFORMATVERSION);
+        HASH_MATCH("fileinfo",                     KEYWORD_FILEINFO);
+        HASH_MATCH("fixes",                        KEYWORD_FIXES);
+        HASH_MATCH("flares",                       KEYWORD_FLARES);
+        HASH_MATCH("flares2",                      KEYWORD_FLARES2);
+        HASH_MATCH("flexbodies",                   KEYWORD_FLEXBODIES);
+        HASH_MATCH("flexbody_camera_mode",         KEYWORD_FLEXBODY_CAMERA_MODE);
+        HASH_MATCH("flexbodywheels",               KEYWORD_FLEXBODYWHEELS);
+        HASH_MATCH("forwardcommands",              KEYWORD_FORWARDCOMMANDS);
+        HASH_MATCH("fusedrag",                     KEYWORD_FUSEDRAG);
+        HASH_MATCH("globals",                      KEYWORD_GLOBALS);
+        HASH_MATCH("guid",                         KEYWORD_GUID);
+        HASH_MATCH("guisettings",                  KEYWORD_GUISETTINGS);
+        HASH_MATCH("help",                         KEYWORD_HELP);
+        HASH_MATCH("hideInChooser",                KEYWORD_HIDE_IN_CHOOSER);
+        HASH_MATCH("hookgroup",                    KEYWORD_HOOKGROUP);
+        HASH_MATCH("hooks",                        KEYWORD_HOOKS);
+        HASH_MATCH("hydros",                       KEYWORD_HYDROS);
+        HASH_MATCH("importcommands",               KEYWORD_IMPORTCOMMANDS);
+        HASH_MATCH("lockgroups",                   KEYWORD_LOCKGROUPS);
+        HASH_MATCH("lockgroup_default_nolock",     KEYWORD_LOCKGROUP_DEFAULT_NOLOCK);
+        HASH_MATCH("managedmaterials",             KEYWORD_MANAGEDMATERIALS);
+        HASH_MATCH("materialflarebindings",        KEYWORD_MATERIALFLAREBINDINGS);
+        HASH_MATCH("meshwheels",                   KEYWORD_MESHWHEELS);
+        HASH_MATCH("meshwheels2",                  KEYWORD_MESHWHEELS2);
+        HASH_MATCH("minimass",                     KEYWORD_MINIMASS);
+        HASH_MATCH("nodecollision",                KEYWORD_NODECOLLISION);
+        HASH_MATCH("nodes",                        KEYWORD_NODES);
+        HASH_MATCH("nodes2",                       KEYWORD_NODES2);
+        HASH_MATCH("particles",                    KEYWORD_PARTICLES);
+        HASH_MATCH("pistonprops",                  KEYWORD_PISTONPROPS);
+        HASH_MATCH("prop_camera_mode",             KEYWORD_PROP_CAMERA_MODE);
+        HASH_MATCH("props",                        KEYWORD_PROPS);
+        HASH_MATCH("railgroups",                   KEYWORD_RAILGROUPS);
+        HASH_MATCH("rescuer",                      KEYWORD_RESCUER);
+        HASH_MATCH("rigidifiers",                  KEYWORD_RIGIDIFIERS);
+        HASH_MATCH("rollon",                       KEYWORD_ROLLON);
+        HASH_MATCH("ropables",                     KEYWORD_ROPABLES);
+        HASH_MATCH("ropes",                        KEYWORD_ROPES);
+        HASH_MATCH("rotators",                     KEYWORD_ROTATORS);
+        HASH_MATCH("rotators2",                    KEYWORD_ROTATORS2);
+        HASH_MATCH("screwprops",                   KEYWORD_SCREWPROPS);
+        HASH_MATCH("section",                      KEYWORD_SECTION);
+        HASH_MATCH("sectionconfig",                KEYWORD_SECTIONCONFIG);
+        HASH_MATCH("set_beam_defaults",            KEYWORD_SET_BEAM_DEFAULTS);
+        HASH_MATCH("set_beam_defaults_scale",      KEYWORD_SET_BEAM_DEFAULTS_SCALE);
+        HASH_MATCH("set_collision_range",          KEYWORD_SET_COLLISION_RANGE);
+        HASH_MATCH("set_inertia_defaults",         KEYWORD_SET_INERTIA_DEFAULTS);
+        HASH_MATCH("set_managedmaterials_options", KEYWORD_SET_MANAGEDMATERIALS_OPTIONS);
+        HASH_MATCH("set_node_defaults",            KEYWORD_SET_NODE_DEFAULTS);
+        HASH_MATCH("set_shadows",                  KEYWORD_SET_SHADOWS);
+        HASH_MATCH("set_skeleton_settings",        KEYWORD_SET_SKELETON_SETTINGS);
+        HASH_MATCH("shocks",                       KEYWORD_SHOCKS);
+        HASH_MATCH("shocks2",                      KEYWORD_SHOCKS2);
+        HASH_MATCH("slidenode_connect_instantly",  KEYWORD_SLIDENODE_CONNECT_INSTANTLY);
+        HASH_MATCH("slidenodes",                   KEYWORD_SLIDENODES);
+        HASH_MATCH("SlopeBrake",                   KEYWORD_SLOPE_BRAKE);
+        HASH_MATCH("soundsources",                 KEYWORD_SOUNDSOURCES);
+        HASH_MATCH("soundsources2",                KEYWORD_SOUNDSOURCES2);
+        HASH_MATCH("speedlimiter",                 KEYWORD_SPEEDLIMITER);
+        HASH_MATCH("submesh",                      KEYWORD_SUBMESH);
+        HASH_MATCH("submesh_groundmodel",          KEYWORD_SUBMESH_GROUNDMODEL);
+        HASH_MATCH("texcoords",                    KEYWORD_TEXCOORDS);
+        HASH_MATCH("ties",                         KEYWORD_TIES);
+        HASH_MATCH("torquecurve",                  KEYWORD_TORQUECURVE);
+        HASH_MATCH("TractionControl",              KEYWORD_TRACTION_CONTROL);
+        HASH_MATCH("triggers",                     KEYWORD_TRIGGERS);
+        HASH_MATCH("turbojets",                    KEYWORD_TURBOJETS);
+        HASH_MATCH("turboprops",                   KEYWORD_TURBOPROPS);
+        HASH_MATCH("turboprops2",                  KEYWORD_TURBOPROPS2);
+        HASH_MATCH("videocamera",                  KEYWORD_VIDEOCAMERA);
+        HASH_MATCH("wheeldetachers",               KEYWORD_WHEELDETACHERS);
+        HASH_MATCH("wheels",                       KEYWORD_WHEELS);
+        HASH_MATCH("wheels2",                      KEYWORD_WHEELS2);
+        HASH_MATCH("wings",                        KEYWORD_WINGS);
+
+    default:
+        break;
+    }
+    return KEYWORD_INVALID;
+}
+
+static void Bench_sol3__HashSwitch(benchmark::State& state)
+{
+    while (state.KeepRunning()) 
+    {
+        int count = sizeof(trucklines)/sizeof(const char*);
+        for (int i = 0; i < count; ++i)
+        {
+            keyword = (int) IdentifyKeywordHash(trucklines[i]);
+        }
+    }
+}
+BENCHMARK(Bench_sol3__HashSwitch);
+
 int main(int argc, char** argv)
 {
     using namespace std;